@@ -251,6 +251,8 @@ typedef enum
 #define CFG_HW_RNG_POOL_THRESHOLD           (16)
 
 /* USER CODE BEGIN HW_RNG_Configuration */
+/* RNG data ready interrupt priority (pool refill) */
+#define CFG_HW_RNG_IRQ_PRIO                 (14)
 
 /* USER CODE END HW_RNG_Configuration */
 
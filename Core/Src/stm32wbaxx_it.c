@@ -27,6 +27,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "app_bsp.h"
+#include "hw.h"
 
 /* USER CODE END Includes */
 
@@ -291,7 +292,7 @@ void TIM16_IRQHandler(void)
 void RNG_IRQHandler(void)
 {
   /* USER CODE BEGIN RNG_IRQn 0 */
-
+  HW_RNG_IRQHandler();
   /* USER CODE END RNG_IRQn 0 */
   /* USER CODE BEGIN RNG_IRQn 1 */
 
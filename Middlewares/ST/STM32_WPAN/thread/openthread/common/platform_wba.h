@@ -95,6 +95,27 @@ void arcRcpSpinelRx(void);
  */
 int CliUartOutput(void *aContext, const char *aFormat, va_list aArguments);
 
+/**
+ * CLI UART counters.
+ */
+typedef struct
+{
+  uint32_t tx_bytes;              /* Bytes sent over UART */
+  uint32_t tx_dma_count;          /* DMA transfers started */
+  uint32_t tx_dropped_bytes;      /* CLI output bytes dropped (TX buffer full or UART error) */
+  uint32_t tx_backpressure_count; /* CLI outputs that had to wait for UART to free TX buffer */
+  uint32_t rx_bytes;              /* Bytes received over UART */
+  uint32_t rx_dropped_bytes;      /* Bytes dropped (command too long or previous command not processed) */
+} CliUartStats_t;
+
+/**
+ * This function retrieves the CLI UART counters.
+ *
+ * @param[out]  aStats  A pointer to the counters.
+ *
+ */
+void CliUartGetStats(CliUartStats_t *aStats);
+
 /**
  * This function initializes the NCP, definition in examples/apps/ncp.c.
  *
@@ -39,37 +39,74 @@ extern UART_HandleTypeDef huart1;
 
 /* Private function prototypes -----------------------------------------------*/
 static void otUart_TxCpltCallback(UART_HandleTypeDef *huart);
-static void otUart_RxCpltCallback(UART_HandleTypeDef *huart);
+static void otUart_RxEvntCpltCallback(UART_HandleTypeDef *huart, uint16_t size);
+static void otUart_ErrorCallback(UART_HandleTypeDef *huart);
 static void processTransmit(void);
 static void processReceive(void);
+static void cliTxStart(void);
+static uint16_t cliTxWrite(const uint8_t *data, uint16_t size);
+static void cliTxFlush(void);
+static uint8_t cliTxWait(void);
+static void cliRxStart(void);
 
 
 
 /* Private define ------------------------------------------------------------*/
-#define BUFFER_SIZE   1536  /* Data size to read (in bytes) */
-#define CLI_BUFFER_NB 2
+#define CLI_TX_BUFFER_SIZE      2048  /* TX ring size (in bytes), must be a power of 2 */
+#define CLI_FORMAT_BUFFER_SIZE  1536  /* Max size of one CLI output (in bytes) */
+#define CLI_RX_BUFFER_SIZE      64    /* RX DMA buffer size (in bytes) */
+#define CLI_LINE_SIZE           256   /* Max size of one CLI command (in bytes) */
+#define CLI_LINE_NB             2
+
+/* Max time to block on the TX semaphore for the UART to free space in TX ring
+   before dropping output */
+#define CLI_TX_BACKPRESSURE_TIMEOUT_MS  500
+
+#define CLI_TX_BUFFER_MASK      (CLI_TX_BUFFER_SIZE - 1)
 
 #define CLI_ECHO /* command echo on UART, comment to disable */
 
+/** CLI TX ring
+ *  head    : written by OT (CLI output and echo), task context only
+ *  tail    : advanced on UART TX complete, interrupt context only
+ *  dmaSize : size of the segment being sent by DMA (0 when UART TX is idle)
+ *  waiting : set by the task blocked on the TX semaphore, released on UART TX complete
+**/
+typedef struct {
+  uint8_t buffer[CLI_TX_BUFFER_SIZE];
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint16_t dmaSize;
+  volatile uint8_t waiting;
+} CliTx_Ring_t;
+
+/** CLI RX command lines, filled by UART RX event callback
+ *  InIdx  : line being filled from UART
+ *  OutIdx : line to be given to OT by otPlatUartReceived
+**/
 typedef struct {
-  char cli_buffer[BUFFER_SIZE];
+  uint8_t line[CLI_LINE_SIZE];
   uint16_t size;
-} cli_payload_t;
+} CliRx_Line_t;
+
+typedef struct {
+  CliRx_Line_t Line[CLI_LINE_NB];
+  volatile uint8_t InIdx;
+  volatile uint8_t OutIdx;
+} CliRx_Queue_t;
 
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
-uint8_t g_buffer[BUFFER_SIZE] = {0};
-volatile uint8_t buffer_index;
 UART_HandleTypeDef *oTCLIuart = &OT_CLI_UART_HANDLER;
 
-/*
- * Circular buffers index:
- * - uart_buf_idx buffer index to be printed to the UART (0..CLI_BUFFER_NB)
- * - ot_buf_idx index to be filled by info from OT       (0..CLI_BUFFER_NB)
- */
-uint8_t uart_buf_idx, ot_buf_idx;
-uint8_t otUartRX = 0;
-cli_payload_t cli_cmd_buffer[CLI_BUFFER_NB];
+static CliTx_Ring_t CliTxRing;
+static os_semaphore_id CliTxSemaphore = NULL;
+static char cli_format_buffer[CLI_FORMAT_BUFFER_SIZE];
+
+static CliRx_Queue_t CliRxQueue;
+static uint8_t cli_rx_dma_buffer[CLI_RX_BUFFER_SIZE];
+
+static CliUartStats_t CliUartStats;
 
 /* Whether OT UART task is currently scheduled (one each for RX/TX */
 bool otUART_TX_Schdl = FALSE;
@@ -94,9 +131,25 @@ otError otPlatUartEnable(void)
 {
   otError error = OT_ERROR_NONE;
 
-  uart_buf_idx = 0U;
-  ot_buf_idx = 0U;
-  buffer_index = 0U;
+  CliTxRing.head = 0U;
+  CliTxRing.tail = 0U;
+  CliTxRing.dmaSize = 0U;
+  CliTxRing.waiting = 0U;
+
+  /* TX semaphore, only usable when scheduler is running (no blocking on bare metal) */
+  if ((CliTxSemaphore == NULL) && (os_wrapper_is_rtos_used() == TRUE))
+  {
+    CliTxSemaphore = os_semaphore_create(1, 0);
+  }
+
+  CliRxQueue.InIdx = 0U;
+  CliRxQueue.OutIdx = 0U;
+  for (uint8_t i = 0; i < CLI_LINE_NB; i++)
+  {
+    CliRxQueue.Line[i].size = 0U;
+  }
+
+  memset(&CliUartStats, 0, sizeof(CliUartStats));
 
   /*
    * It is assumed that UART1 MSP Init is done by
@@ -106,13 +159,13 @@ otError otPlatUartEnable(void)
 
   /* register callbacks */
   oTCLIuart->TxCpltCallback = otUart_TxCpltCallback;
-  oTCLIuart->RxCpltCallback = otUart_RxCpltCallback;
-  HAL_UART_Receive_IT(oTCLIuart, &otUartRX, 1);
+  oTCLIuart->RxEventCallback = otUart_RxEvntCpltCallback;
+  oTCLIuart->ErrorCallback = otUart_ErrorCallback;
 
-  for (uint8_t i = 0; i < CLI_BUFFER_NB; i++)
-  {
-    cli_cmd_buffer[i].size = 0U;
-  }
+  /* Start Reception in DMA IdleMode, Receive until buffer size has been reached or no activity on UART Rx channel
+     When characters are received, callback otUart_RxEvntCpltCallback is triggered
+  */
+  cliRxStart();
 
   return error;
 }
@@ -129,7 +182,18 @@ otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
 
 otError otPlatUartFlush(void)
 {
-  return OT_ERROR_NOT_IMPLEMENTED;
+  cliTxFlush();
+
+  return OT_ERROR_NONE;
+}
+
+void CliUartGetStats(CliUartStats_t *aStats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *aStats = CliUartStats;
+  __set_PRIMASK(primask);
 }
 
 /* Execution of TX or forwarding of RX to OT stack*/
@@ -142,126 +206,310 @@ void arcUartProcess(void)
     processTransmit();
 }
 
+/* Only needed when UART was not available to start TX: TX segments are
+   otherwise chained from the TX complete callback */
 static void processTransmit(void)
+{
+  otUART_TX_Schdl = FALSE;
+  cliTxStart();
+}
+
+static void processReceive(void)
+{
+  CliRx_Line_t *rx_line;
+
+  LL_LOCK();
+  otUART_RX_Schdl = FALSE;
+
+  while (CliRxQueue.OutIdx != CliRxQueue.InIdx)
+  {
+    rx_line = &CliRxQueue.Line[CliRxQueue.OutIdx];
+
+#ifdef CLI_ECHO
+    cliTxWrite(rx_line->line, rx_line->size);
+#endif /* CLI_ECHO */
+
+    /* In case of "factoryreset" cmd, echo should be returned before giving cmd to OT stack 
+    else device will reset before echo sent by uart   */
+    if ((strncmp((char*)rx_line->line, FACTORYRESET_CMD, 12) == 0) || ((strncmp((char*)rx_line->line, RESET_CMD, 6) == 0)))
+    {
+        /* Waiting for echo to be sent over uart before giving cmd to OT stack */
+        cliTxFlush();
+    }
+
+    otPlatUartReceived(rx_line->line, rx_line->size);
+    rx_line->size = 0;
+
+    CliRxQueue.OutIdx = (CliRxQueue.OutIdx + 1) % CLI_LINE_NB;
+  }
+
+  LL_UNLOCK();
+  return;
+}
+
+/* Start the DMA transfer of the next contiguous segment of TX ring, if UART TX is idle.
+   Called from task context (CLI output) and from UART TX complete interrupt. */
+static void cliTxStart(void)
 {
   HAL_StatusTypeDef HalError;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t used, offset, size;
 
-  /* Check size, processTransmit can be scheduled where as CLI output already
-  printed in previous schedule */
-  if (cli_cmd_buffer[uart_buf_idx].size == 0)
+  __disable_irq();
+
+  used = CliTxRing.head - CliTxRing.tail;
+
+  if ((CliTxRing.dmaSize == 0) && (used != 0))
   {
-    return;
+    offset = CliTxRing.tail & CLI_TX_BUFFER_MASK;
+    size = CLI_TX_BUFFER_SIZE - offset;
+    if (size > used)
+    {
+      size = used;
+    }
+
+    HalError = HAL_UART_Transmit_DMA(oTCLIuart, &CliTxRing.buffer[offset], (uint16_t)size);
+    if (HalError == HAL_OK)
+    {
+      CliTxRing.dmaSize = (uint16_t)size;
+      CliUartStats.tx_dma_count++;
+    }
+    else
+    {
+      /* UART not available, retry from task */
+      otUART_TX_Schdl = TRUE;
+      APP_THREAD_ScheduleUART();
+    }
   }
-  /* Take current buffer index, send it to the UART */
-  ot_buf_idx = uart_buf_idx++;
-  uart_buf_idx %= CLI_BUFFER_NB;
 
-  /* Wait for uart to be ready */
-  while(oTCLIuart->gState != HAL_UART_STATE_READY);
+  __set_PRIMASK(primask);
+}
+
+/* Block until the next UART TX complete, up to CLI_TX_BACKPRESSURE_TIMEOUT_MS.
+   Returns FALSE on timeout, or when there is no scheduler to block on. */
+static uint8_t cliTxWait(void)
+{
+  uint8_t ret = FALSE;
 
-  HalError = HAL_UART_Transmit_DMA(oTCLIuart, (uint8_t*)&cli_cmd_buffer[ot_buf_idx].cli_buffer[0],
-                       cli_cmd_buffer[ot_buf_idx].size); 
-  if (HalError != HAL_UART_ERROR_NONE)
+  if (CliTxSemaphore != NULL)
   {
-    APP_DBG("CLI UART ERROR 0x%x, buff idx : %d, buff size : %d \r\n",HalError, ot_buf_idx, cli_cmd_buffer[ot_buf_idx].size);
+    CliTxRing.waiting = 1U;
+    __DMB();
+
+    /* Segment may have completed before the flag was seen: do not wait for nothing */
+    if (CliTxRing.dmaSize == 0U)
+    {
+      cliTxStart();
+    }
+
+    if ((CliTxRing.dmaSize != 0U) || (CliTxRing.head != CliTxRing.tail))
+    {
+      ret = (os_semaphore_wait(CliTxSemaphore, CLI_TX_BACKPRESSURE_TIMEOUT_MS) == 0) ? TRUE : FALSE;
+    }
+    else
+    {
+      ret = TRUE;
+    }
+
+    CliTxRing.waiting = 0U;
   }
 
-  cli_cmd_buffer[ot_buf_idx].size = 0; /* Reset buffer */
+  return ret;
 }
 
-static void processReceive(void)
+/* Copy data in TX ring and start the transfer. If TX ring is full, block on the
+   TX semaphore while UART sends pending data (backpressure), then drop what does
+   not fit. Returns the number of bytes written in TX ring. */
+static uint16_t cliTxWrite(const uint8_t *data, uint16_t size)
 {
-  LL_LOCK();
-  if (buffer_index > 0){
-    
-    /* In case of "factoryreset" cmd, echo should be returned before giving cmd to OT stack 
-    else device will reset before echo sent by uart   */
-    if ((strncmp((char*)g_buffer, FACTORYRESET_CMD, 12) == 0) || ((strncmp((char*)g_buffer, RESET_CMD, 6) == 0)))
+  uint32_t head = CliTxRing.head;
+  uint32_t free_size = CLI_TX_BUFFER_SIZE - (head - CliTxRing.tail);
+  uint32_t offset, first;
+
+  if (free_size < size)
+  {
+    CliUartStats.tx_backpressure_count++;
+    cliTxStart();
+
+    while ((free_size < size) && (cliTxWait() == TRUE))
     {
-        processTransmit();
-        /* Waiting for echo to be sent over uart before giving cmd to OT stack */
-        while(oTCLIuart->gState != HAL_UART_STATE_READY);
+      free_size = CLI_TX_BUFFER_SIZE - (head - CliTxRing.tail);
+    }
+
+    if (free_size < size)
+    {
+      CliUartStats.tx_dropped_bytes += size - free_size;
+      size = (uint16_t)free_size;
     }
-    
-    otPlatUartReceived(g_buffer, buffer_index);
-    buffer_index = 0;
-    memset(g_buffer, 0x0, BUFFER_SIZE);
   }
-  otUART_RX_Schdl = FALSE;
-  LL_UNLOCK();
-  return;
+
+  offset = head & CLI_TX_BUFFER_MASK;
+  first = CLI_TX_BUFFER_SIZE - offset;
+  if (first > size)
+  {
+    first = size;
+  }
+
+  memcpy(&CliTxRing.buffer[offset], data, first);
+  memcpy(&CliTxRing.buffer[0], &data[first], size - first);
+
+  __DMB();
+  CliTxRing.head = head + size;
+
+  cliTxStart();
+
+  return size;
 }
 
-#if defined(CLI_ECHO)
-static void processEcho(uint8_t *cmd, uint8_t cmd_size)
+/* Block until TX ring has been sent over UART (no wait without scheduler) */
+static void cliTxFlush(void)
 {
-  /* Fill the buffer with CLI output */
-  uint16_t size = cli_cmd_buffer[uart_buf_idx].size;
+  cliTxStart();
+
+  while ((CliTxRing.head != CliTxRing.tail) && (cliTxWait() == TRUE));
+}
 
-  memcpy(&cli_cmd_buffer[uart_buf_idx].cli_buffer[size], cmd, cmd_size);
-  cli_cmd_buffer[uart_buf_idx].size += cmd_size ;
+static void cliRxStart(void)
+{
+  HAL_StatusTypeDef HalStatus;
 
-  /* Schedule the task if not */
-  APP_THREAD_ScheduleUART();
-  otUART_TX_Schdl = TRUE;
+  HalStatus = HAL_UARTEx_ReceiveToIdle_DMA(oTCLIuart, cli_rx_dma_buffer, CLI_RX_BUFFER_SIZE);
+  __HAL_DMA_DISABLE_IT(oTCLIuart->hdmarx, DMA_IT_HT); //Disable Half Transfer IT (not used but always set by HAL_UARTEx_ReceiveToIdle_DMA)
+  if (HalStatus != HAL_OK)
+  {
+    APP_DBG("CLI UART RX start ERROR 0x%x\r\n", HalStatus);
+  }
 }
-#endif /* CLI_ECHO */
 
 static void otUart_TxCpltCallback(UART_HandleTypeDef *huart)
 {
   UNUSED(huart);
-  /* Re-schedule task if current buffer being filled by OT is non-empty */
-  if (cli_cmd_buffer[uart_buf_idx].size)
-    APP_THREAD_ScheduleUART();
-  else
-    otUART_TX_Schdl = FALSE;
+
+  /* Release the segment sent and chain the next one */
+  CliUartStats.tx_bytes += CliTxRing.dmaSize;
+  CliTxRing.tail += CliTxRing.dmaSize;
+  CliTxRing.dmaSize = 0;
+
+  cliTxStart();
+
+  /* Wake up the task waiting for TX ring space */
+  if (CliTxRing.waiting != 0U)
+  {
+    CliTxRing.waiting = 0U;
+    os_semaphore_release_isr(CliTxSemaphore);
+  }
 }
 
-static void otUart_RxCpltCallback(UART_HandleTypeDef *huart)
+static void otUart_RxEvntCpltCallback(UART_HandleTypeDef *huart, uint16_t size)
 {
   UNUSED(huart);
-  HAL_UART_Receive_IT(oTCLIuart, &otUartRX, 1);
-  g_buffer[buffer_index] = otUartRX;
-  buffer_index++;
+  CliRx_Line_t *rx_line = &CliRxQueue.Line[CliRxQueue.InIdx];
+  uint8_t rx_char;
 
-  /* If ENTER, forward the command if non-empty*/
-  if ( (otUartRX == '\r') && (buffer_index > 1)) {
+  CliUartStats.rx_bytes += size;
 
-#ifdef CLI_ECHO
-    if (otUartRX == '\r')
-      g_buffer[buffer_index++] = '\n';
+  for (uint16_t i = 0; i < size; i++)
+  {
+    rx_char = cli_rx_dma_buffer[i];
 
-    processEcho(g_buffer, buffer_index);
+    /* Keep room for '\n' added after ENTER. The end of a too long command is
+       dropped, and the whole command at ENTER so that the next one is read */
+    if (rx_line->size >= (CLI_LINE_SIZE - 1))
+    {
+      CliUartStats.rx_dropped_bytes++;
+      if (rx_char == '\r')
+      {
+        CliUartStats.rx_dropped_bytes += rx_line->size;
+        rx_line->size = 0;
+      }
+      continue;
+    }
+
+    rx_line->line[rx_line->size++] = rx_char;
+
+    /* If ENTER, forward the command if non-empty*/
+    if ((rx_char == '\r') && (rx_line->size > 1))
+    {
+#ifdef CLI_ECHO
+      rx_line->line[rx_line->size++] = '\n';
 #endif /* CLI_ECHO */
-    if (otUART_RX_Schdl == FALSE) {
-      otUART_RX_Schdl = TRUE;
-      APP_THREAD_ScheduleUART();
+
+      if (((CliRxQueue.InIdx + 1) % CLI_LINE_NB) == CliRxQueue.OutIdx)
+      {
+        /* Previous command not yet processed by OT, drop this one */
+        CliUartStats.rx_dropped_bytes += rx_line->size;
+        rx_line->size = 0;
+      }
+      else
+      {
+        CliRxQueue.InIdx = (CliRxQueue.InIdx + 1) % CLI_LINE_NB;
+        rx_line = &CliRxQueue.Line[CliRxQueue.InIdx];
+        rx_line->size = 0;
+      }
+
+      if (otUART_RX_Schdl == FALSE) {
+        otUART_RX_Schdl = TRUE;
+        APP_THREAD_ScheduleUART();
+      }
+    }
+  }
+
+  /* Restart Uart Rx for next characters */
+  cliRxStart();
+}
+
+static void otUart_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  UNUSED(huart);
+
+  /* TX aborted: the segment is lost, continue with the next one */
+  if ((CliTxRing.dmaSize != 0) && (oTCLIuart->gState == HAL_UART_STATE_READY))
+  {
+    CliUartStats.tx_dropped_bytes += CliTxRing.dmaSize;
+    CliTxRing.tail += CliTxRing.dmaSize;
+    CliTxRing.dmaSize = 0;
+    cliTxStart();
+
+    if (CliTxRing.waiting != 0U)
+    {
+      CliTxRing.waiting = 0U;
+      os_semaphore_release_isr(CliTxSemaphore);
     }
   }
+
+  /* Trying restart Uart RX */
+  cliRxStart();
 }
 
 int CliUartOutput(void *aContext, const char *aFormat, va_list aArguments)
 {
   UNUSED(aContext);
-  uint16_t ret,size;
+  int ret;
+  uint16_t size;
 
-  /* Fill the buffer with CLI output */
-  size = cli_cmd_buffer[uart_buf_idx].size;
+  /* Format the CLI output */
+  ret = vsnprintf(cli_format_buffer, CLI_FORMAT_BUFFER_SIZE, aFormat, aArguments);
+  if (ret <= 0)
+  {
+    return 0;
+  }
 
-  ret = (uint16_t)vsnprintf(&cli_cmd_buffer[uart_buf_idx].cli_buffer[size],
-                            BUFFER_SIZE, aFormat, aArguments);
+  size = (uint16_t)ret;
+  if (size >= CLI_FORMAT_BUFFER_SIZE)
+  {
+    CliUartStats.tx_dropped_bytes += size - (CLI_FORMAT_BUFFER_SIZE - 1);
+    size = CLI_FORMAT_BUFFER_SIZE - 1;
+  }
 
   /* Do not print "> ", allign with WB for CubeMonitorRF */
-  if ((strncmp(&cli_cmd_buffer[uart_buf_idx].cli_buffer[size], "> ", 2) != 0)&&(ret != 0))
+  if (strncmp(cli_format_buffer, "> ", 2) == 0)
   {
-    cli_cmd_buffer[uart_buf_idx].size += ret;
-
-    /* Schedule the task if not */
-    APP_THREAD_ScheduleUART();
-    otUART_TX_Schdl = TRUE;
+    return ret;
   }
 
-  return ret;
+  /* Return the number of bytes accepted by UART: less than requested when
+     output had to be dropped because UART could not keep up */
+  return cliTxWrite((const uint8_t *)cli_format_buffer, size);
 }
 
 #endif /* OT_CLI_USE */
@@ -448,29 +448,20 @@ exit:
     return error;
 }
 
-void CoapBase::ScheduleRetransmissionTimer(void)
+bool CoapBase::ShouldTimeOut(const Message &aMessage, const Metadata &aMetadata)
 {
-    NextFireTime nextTime;
-    Metadata     metadata;
-
-    for (const Message &message : mPendingRequests)
-    {
-        metadata.ReadFrom(message);
+    bool shouldTimeOut = true;
 
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-        if (message.IsRequest() && metadata.mObserve && metadata.mAcknowledged)
-        {
-            // This is an RFC7641 subscription which is already acknowledged.
-            // We do not time it out, so skip it when determining the next
-            // fire time.
-            continue;
-        }
+    // An RFC7641 subscription which is already acknowledged is not
+    // timed out.
+    shouldTimeOut = !(aMessage.IsRequest() && aMetadata.mObserve && aMetadata.mAcknowledged);
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMetadata);
 #endif
 
-        nextTime.UpdateIfEarlier(metadata.mNextTimerShot);
-    }
-
-    mRetransmissionTimer.FireAt(nextTime);
+    return shouldTimeOut;
 }
 
 void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
@@ -480,7 +471,13 @@ void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
 
 void CoapBase::HandleRetransmissionTimer(void)
 {
+    // The timer is only moved earlier when requests are added and is
+    // left running when they are removed, so it may fire with nothing
+    // due. The next fire time is determined in the same pass that
+    // handles the due requests.
+
     TimeMilli        now = TimerMilli::GetNow();
+    NextFireTime     nextTime(now);
     Metadata         metadata;
     Ip6::MessageInfo messageInfo;
 
@@ -488,47 +485,50 @@ void CoapBase::HandleRetransmissionTimer(void)
     {
         metadata.ReadFrom(message);
 
-        if (now >= metadata.mNextTimerShot)
+        if (!ShouldTimeOut(message, metadata))
         {
-#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-            if (message.IsRequest() && metadata.mObserve && metadata.mAcknowledged)
-            {
-                // This is a RFC7641 subscription.  Do not time out.
-                continue;
-            }
-#endif
+            continue;
+        }
 
-            if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
-            {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorResponseTimeout);
-                continue;
-            }
+        if (now < metadata.mNextTimerShot)
+        {
+            nextTime.UpdateIfEarlier(metadata.mNextTimerShot);
+            continue;
+        }
 
-            // Increment retransmission counter and timer.
-            metadata.mRetransmissionsRemaining--;
-            metadata.mRetransmissionTimeout *= 2;
-            metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
-            metadata.UpdateIn(message);
+        if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+        {
+            // No expected response or acknowledgment.
+            FinalizeCoapTransaction(message, metadata, nullptr, nullptr, kErrorResponseTimeout);
+            continue;
+        }
 
-            // Retransmit
-            if (!metadata.mAcknowledged)
-            {
-                messageInfo.SetPeerAddr(metadata.mDestinationAddress);
-                messageInfo.SetPeerPort(metadata.mDestinationPort);
-                messageInfo.SetSockAddr(metadata.mSourceAddress);
+        // Increment retransmission counter and timer.
+        metadata.mRetransmissionsRemaining--;
+        metadata.mRetransmissionTimeout *= 2;
+        metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
+        metadata.UpdateIn(message);
+        nextTime.UpdateIfEarlier(metadata.mNextTimerShot);
+
+        // Retransmit
+        if (!metadata.mAcknowledged)
+        {
+            messageInfo.SetPeerAddr(metadata.mDestinationAddress);
+            messageInfo.SetPeerPort(metadata.mDestinationPort);
+            messageInfo.SetSockAddr(metadata.mSourceAddress);
 #if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-                messageInfo.SetHopLimit(metadata.mHopLimit);
-                messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
+            messageInfo.SetHopLimit(metadata.mHopLimit);
+            messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
 #endif
-                messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
+            messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
 
-                SendCopy(message, messageInfo);
-            }
+            SendCopy(message, messageInfo);
         }
     }
 
-    ScheduleRetransmissionTimer();
+    // Response handlers invoked above may have sent new requests
+    // which already started the timer.
+    mRetransmissionTimer.FireAtIfEarlier(nextTime);
 }
 
 void CoapBase::FinalizeCoapTransaction(Message                &aRequest,
@@ -583,7 +583,7 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
     SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
 
     mPendingRequests.Enqueue(*messageCopy);
-    ScheduleRetransmissionTimer();
+    mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
 
 exit:
     FreeAndNullMessageOnError(messageCopy, error);
@@ -593,7 +593,15 @@ exit:
 void CoapBase::DequeueMessage(Message &aMessage)
 {
     mPendingRequests.DequeueAndFree(aMessage);
-    ScheduleRetransmissionTimer();
+
+    // The timer is not rescheduled here (which would require reading
+    // the metadata of all pending requests). If it fires early,
+    // `HandleRetransmissionTimer()` reschedules it.
+
+    if (mPendingRequests.GetHead() == nullptr)
+    {
+        mRetransmissionTimer.Stop();
+    }
 }
 
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
@@ -1018,38 +1026,42 @@ Message *CoapBase::FindRelatedRequest(const Message          &aResponse,
 
     for (Message &message : mPendingRequests)
     {
-        aMetadata.ReadFrom(message);
+        // The message ID and token are in the CoAP header of the
+        // request, so they are checked before reading the metadata
+        // from the end of the message to check the peer.
 
-        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr() &&
-              aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()) ||
-             aMetadata.mDestinationAddress.IsMulticast() || aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()))
+        switch (aResponse.GetType())
         {
-            switch (aResponse.GetType())
+        case kTypeReset:
+        case kTypeAck:
+            if (aResponse.GetMessageId() != message.GetMessageId())
             {
-            case kTypeReset:
-            case kTypeAck:
-                if (aResponse.GetMessageId() == message.GetMessageId())
-                {
-                    request = &message;
-                    ExitNow();
-                }
-
-                break;
+                continue;
+            }
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aResponse.IsTokenEqual(message))
-                {
-                    request = &message;
-                    ExitNow();
-                }
+            break;
 
-                break;
+        case kTypeConfirmable:
+        case kTypeNonConfirmable:
+            if (!aResponse.IsTokenEqual(message))
+            {
+                continue;
             }
+
+            break;
+        }
+
+        aMetadata.ReadFrom(message);
+
+        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr() &&
+              aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()) ||
+             aMetadata.mDestinationAddress.IsMulticast() || aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()))
+        {
+            request = &message;
+            break;
         }
     }
 
-exit:
     return request;
 }
 
@@ -1473,47 +1485,55 @@ exit:
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
     : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
+    , mNumEntries(0)
 {
 }
 
+uint32_t ResponsesQueue::HashPeer(const Ip6::MessageInfo &aMessageInfo)
+{
+    return HashObject(aMessageInfo.GetPeerPort(), HashObject(aMessageInfo.GetPeerAddr()));
+}
+
 Error ResponsesQueue::GetMatchedResponseCopy(const Message          &aRequest,
                                              const Ip6::MessageInfo &aMessageInfo,
                                              Message               **aResponse)
 {
-    Error          error = kErrorNone;
-    const Message *cacheResponse;
+    Error        error = kErrorNone;
+    const Entry *entry;
 
-    cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
-    VerifyOrExit(cacheResponse != nullptr, error = kErrorNotFound);
+    entry = FindMatchedEntry(aRequest, aMessageInfo);
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
-    *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+    *aResponse = entry->mMessage->Clone(entry->mMessage->GetLength() - sizeof(ResponseMetadata));
     VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
 
 exit:
     return error;
 }
 
-const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+const ResponsesQueue::Entry *ResponsesQueue::FindMatchedEntry(const Message          &aRequest,
+                                                              const Ip6::MessageInfo &aMessageInfo) const
 {
-    const Message *response = nullptr;
+    const Entry *match    = nullptr;
+    uint32_t     peerHash = HashPeer(aMessageInfo);
 
-    for (const Message &message : mQueue)
+    for (const Entry *entry = &mEntries[0]; entry < &mEntries[mNumEntries]; entry++)
     {
-        if (message.GetMessageId() == aRequest.GetMessageId())
+        if ((entry->mMessageId == aRequest.GetMessageId()) && (entry->mPeerHash == peerHash))
         {
             ResponseMetadata metadata;
 
-            metadata.ReadFrom(message);
+            metadata.ReadFrom(*entry->mMessage);
 
             if (metadata.mMessageInfo.HasSamePeerAddrAndPort(aMessageInfo))
             {
-                response = &message;
+                match = entry;
                 break;
             }
         }
     }
 
-    return response;
+    return match;
 }
 
 void ResponsesQueue::EnqueueResponse(Message                &aMessage,
@@ -1522,11 +1542,12 @@ void ResponsesQueue::EnqueueResponse(Message                &aMessage,
 {
     Message         *responseCopy;
     ResponseMetadata metadata;
+    Entry           *entry;
 
     metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
     metadata.mMessageInfo = aMessageInfo;
 
-    VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == nullptr);
+    VerifyOrExit(FindMatchedEntry(aMessage, aMessageInfo) == nullptr);
 
     UpdateQueue();
 
@@ -1536,6 +1557,12 @@ void ResponsesQueue::EnqueueResponse(Message                &aMessage,
 
     mQueue.Enqueue(*responseCopy);
 
+    entry               = &mEntries[mNumEntries++];
+    entry->mMessage     = responseCopy;
+    entry->mDequeueTime = metadata.mDequeueTime;
+    entry->mPeerHash    = HashPeer(aMessageInfo);
+    entry->mMessageId   = aMessage.GetMessageId();
+
     mTimer.FireAtIfEarlier(metadata.mDequeueTime);
 
 exit:
@@ -1544,40 +1571,41 @@ exit:
 
 void ResponsesQueue::UpdateQueue(void)
 {
-    uint16_t  msgCount    = 0;
-    Message  *earliestMsg = nullptr;
-    TimeMilli earliestDequeueTime(0);
+    Entry *earliest = nullptr;
 
     // Check the number of messages in the queue and if number is at
     // `kMaxCachedResponses` remove the one with earliest dequeue
     // time.
 
-    for (Message &message : mQueue)
-    {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(message);
+    VerifyOrExit(mNumEntries >= kMaxCachedResponses);
 
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
+    for (Entry *entry = &mEntries[0]; entry < &mEntries[mNumEntries]; entry++)
+    {
+        if ((earliest == nullptr) || (entry->mDequeueTime < earliest->mDequeueTime))
         {
-            earliestMsg         = &message;
-            earliestDequeueTime = metadata.mDequeueTime;
+            earliest = entry;
         }
-
-        msgCount++;
     }
 
-    if (msgCount >= kMaxCachedResponses)
-    {
-        DequeueResponse(*earliestMsg);
-    }
+    DequeueResponse(*earliest);
+
+exit:
+    return;
 }
 
-void ResponsesQueue::DequeueResponse(Message &aMessage) { mQueue.DequeueAndFree(aMessage); }
+void ResponsesQueue::DequeueResponse(Entry &aEntry)
+{
+    // The last entry is moved into the freed slot, so the order of
+    // `mEntries` does not follow the order of `mQueue`.
+
+    mQueue.DequeueAndFree(*aEntry.mMessage);
+    aEntry = mEntries[--mNumEntries];
+}
 
 void ResponsesQueue::DequeueAllResponses(void)
 {
     mQueue.DequeueAndFreeAll();
+    mNumEntries = 0;
     mTimer.Stop();
 }
 
@@ -1589,20 +1617,21 @@ void ResponsesQueue::HandleTimer(Timer &aTimer)
 void ResponsesQueue::HandleTimer(void)
 {
     NextFireTime nextDequeueTime;
+    uint16_t     index = 0;
 
-    for (Message &message : mQueue)
+    while (index < mNumEntries)
     {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(message);
+        Entry &entry = mEntries[index];
 
-        if (nextDequeueTime.GetNow() >= metadata.mDequeueTime)
+        if (nextDequeueTime.GetNow() >= entry.mDequeueTime)
         {
-            DequeueResponse(message);
+            // `DequeueResponse()` moves the last entry into `index`.
+            DequeueResponse(entry);
             continue;
         }
 
-        nextDequeueTime.UpdateIfEarlier(metadata.mDequeueTime);
+        nextDequeueTime.UpdateIfEarlier(entry.mDequeueTime);
+        index++;
     }
 
     mTimer.FireAt(nextDequeueTime);
@@ -37,6 +37,7 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/debug.hpp"
+#include "common/hash.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -321,15 +322,31 @@ private:
         Ip6::MessageInfo mMessageInfo;
     };
 
-    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
-    void           DequeueResponse(Message &aMessage);
-    void           UpdateQueue(void);
+    // Each cached response has an `Entry` holding the fields needed
+    // for matching and expiry, so that these do not require reading
+    // the `ResponseMetadata` footer of every cached message. The
+    // footer is only read to confirm the peer of a candidate.
+    struct Entry
+    {
+        Message  *mMessage;
+        TimeMilli mDequeueTime;
+        uint32_t  mPeerHash;
+        uint16_t  mMessageId;
+    };
+
+    static uint32_t HashPeer(const Ip6::MessageInfo &aMessageInfo);
+
+    const Entry *FindMatchedEntry(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
+    void         DequeueResponse(Entry &aEntry);
+    void         UpdateQueue(void);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
     MessageQueue      mQueue;
     TimerMilliContext mTimer;
+    Entry             mEntries[kMaxCachedResponses];
+    uint16_t          mNumEntries;
 };
 
 /**
@@ -817,7 +834,7 @@ private:
     Message *InitMessage(Message *aMessage, Type aType, Uri aUri);
     Message *InitResponse(Message *aMessage, const Message &aRequest);
 
-    void        ScheduleRetransmissionTimer(void);
+    static bool ShouldTimeOut(const Message &aMessage, const Metadata &aMetadata);
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
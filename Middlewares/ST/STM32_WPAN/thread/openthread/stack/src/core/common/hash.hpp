@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2025, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for hashing helpers used by the lookup indexes in OpenThread core.
+ */
+
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/type_traits.hpp"
+
+namespace ot {
+
+constexpr uint32_t kHashInitValue = 2166136261u; ///< Initial hash value (FNV-1a 32-bit offset basis).
+constexpr uint32_t kHashPrime     = 16777619u;   ///< FNV-1a 32-bit prime.
+
+/**
+ * Computes a 32-bit FNV-1a hash over a given buffer.
+ *
+ * @param[in] aBuffer  A pointer to the buffer.
+ * @param[in] aLength  Number of bytes in @p aBuffer.
+ * @param[in] aHash    The initial hash value (allows a hash to be computed over multiple non-contiguous fields).
+ *
+ * @returns The FNV-1a hash value.
+ */
+inline uint32_t HashBytes(const void *aBuffer, uint16_t aLength, uint32_t aHash = kHashInitValue)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBuffer);
+
+    while (aLength-- > 0)
+    {
+        aHash ^= *bytes++;
+        aHash *= kHashPrime;
+    }
+
+    return aHash;
+}
+
+/**
+ * Computes a 32-bit FNV-1a hash over all bytes of a given object.
+ *
+ * The object should not contain padding bytes (e.g., a packed address type), as these would be included in the hash.
+ *
+ * @tparam ObjectType   The object type.
+ *
+ * @param[in] aObject   A reference to the object to hash.
+ * @param[in] aHash     The initial hash value.
+ *
+ * @returns The FNV-1a hash value.
+ */
+template <typename ObjectType> uint32_t HashObject(const ObjectType &aObject, uint32_t aHash = kHashInitValue)
+{
+    static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+
+    return HashBytes(&aObject, sizeof(ObjectType), aHash);
+}
+
+} // namespace ot
+
+#endif // HASH_HPP_
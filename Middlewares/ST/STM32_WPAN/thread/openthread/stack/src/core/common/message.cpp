@@ -864,6 +864,34 @@ void Message::SetPriorityQueue(PriorityQueue *aPriorityQueue)
     GetMetadata().mInPriorityQ = true;
 }
 
+void Message::UpdateTxState(bool aDirectTx, bool aResolvingAddress)
+{
+    // Updates the direct tx and resolving address flags, moving the
+    // message between the views of its priority queue (if any).
+
+    PriorityQueue *priorityQueue;
+
+    VerifyOrExit((IsDirectTransmission() != aDirectTx) || (IsResolvingAddress() != aResolvingAddress));
+
+    priorityQueue = GetPriorityQueue();
+
+    if (priorityQueue != nullptr)
+    {
+        priorityQueue->RemoveFromView(*this);
+    }
+
+    GetMetadata().mDirectTx         = aDirectTx;
+    GetMetadata().mResolvingAddress = aResolvingAddress;
+
+    if (priorityQueue != nullptr)
+    {
+        priorityQueue->AddToView(*this);
+    }
+
+exit:
+    return;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // MessageQueue
 
@@ -1017,6 +1045,136 @@ const Message *PriorityQueue::GetHeadForPriority(Message::Priority aPriority) co
 
 const Message *PriorityQueue::GetTail(void) const { return FindFirstNonNullTail(Message::kPriorityLow); }
 
+const Message *PriorityQueue::GetHeadReady(void) const
+{
+    const Message *head = nullptr;
+
+    for (uint8_t priority = Message::kNumPriorities; priority > 0; priority--)
+    {
+        if (mReadyHeads[priority - 1] != nullptr)
+        {
+            head = mReadyHeads[priority - 1];
+            break;
+        }
+    }
+
+    return head;
+}
+
+const Message *PriorityQueue::GetNextReady(const Message &aMessage) const
+{
+    const Message *next;
+
+    OT_ASSERT(aMessage.GetPriorityQueue() == this);
+
+    if (IsReady(aMessage))
+    {
+        next = aMessage.ReadyNext();
+
+        for (uint8_t priority = aMessage.GetPriority(); (next == nullptr) && (priority > 0); priority--)
+        {
+            next = mReadyHeads[priority - 1];
+        }
+    }
+    else
+    {
+        // `aMessage` is not in the ready view (e.g., it was just
+        // removed from it), so its position in the view is lost. The
+        // ready view is not in queue order, restart from its head.
+
+        next = GetHeadReady();
+    }
+
+    return next;
+}
+
+PriorityQueue::View PriorityQueue::ViewOf(const Message &aMessage)
+{
+    View view;
+
+    if (!aMessage.IsDirectTransmission())
+    {
+        view = kViewIndirect;
+    }
+    else if (aMessage.IsResolvingAddress())
+    {
+        view = kViewResolving;
+    }
+    else
+    {
+        view = kViewReady;
+    }
+
+    return view;
+}
+
+void PriorityQueue::AddToView(Message &aMessage)
+{
+    // Adds `aMessage` (which is already linked in the queue) to its
+    // view. A ready message is appended to the ready list of its
+    // priority level, so the list is in the order the messages
+    // became ready.
+
+    View     view     = ViewOf(aMessage);
+    uint8_t  priority = aMessage.GetPriority();
+    Message *prev     = mReadyTails[priority];
+
+    mViewCounts[view]++;
+
+    VerifyOrExit(view == kViewReady);
+
+    aMessage.ReadyPrev() = prev;
+    aMessage.ReadyNext() = nullptr;
+
+    if (prev != nullptr)
+    {
+        prev->ReadyNext() = &aMessage;
+    }
+    else
+    {
+        mReadyHeads[priority] = &aMessage;
+    }
+
+    mReadyTails[priority] = &aMessage;
+
+exit:
+    return;
+}
+
+void PriorityQueue::RemoveFromView(Message &aMessage)
+{
+    View    view     = ViewOf(aMessage);
+    uint8_t priority = aMessage.GetPriority();
+
+    mViewCounts[view]--;
+
+    VerifyOrExit(view == kViewReady);
+
+    if (aMessage.ReadyPrev() != nullptr)
+    {
+        aMessage.ReadyPrev()->ReadyNext() = aMessage.ReadyNext();
+    }
+    else
+    {
+        mReadyHeads[priority] = aMessage.ReadyNext();
+    }
+
+    if (aMessage.ReadyNext() != nullptr)
+    {
+        aMessage.ReadyNext()->ReadyPrev() = aMessage.ReadyPrev();
+    }
+    else
+    {
+        mReadyTails[priority] = aMessage.ReadyPrev();
+    }
+
+    aMessage.ReadyNext() = nullptr;
+    aMessage.ReadyPrev() = nullptr;
+
+exit:
+    return;
+}
+
 void PriorityQueue::Enqueue(Message &aMessage)
 {
     Message::Priority priority;
@@ -1047,6 +1205,8 @@ void PriorityQueue::Enqueue(Message &aMessage)
     }
 
     mTails[priority] = &aMessage;
+
+    AddToView(aMessage);
 }
 
 void PriorityQueue::Dequeue(Message &aMessage)
@@ -1056,6 +1216,8 @@ void PriorityQueue::Dequeue(Message &aMessage)
 
     OT_ASSERT(aMessage.GetPriorityQueue() == this);
 
+    RemoveFromView(aMessage);
+
     priority = aMessage.GetPriority();
 
     tail = mTails[priority];
@@ -1112,5 +1274,12 @@ void PriorityQueue::GetInfo(Info &aInfo) const
     }
 }
 
+void PriorityQueue::GetViewInfo(ViewInfo &aViewInfo) const
+{
+    aViewInfo.mNumReady     = mViewCounts[kViewReady];
+    aViewInfo.mNumResolving = mViewCounts[kViewResolving];
+    aViewInfo.mNumIndirect  = mViewCounts[kViewIndirect];
+}
+
 } // namespace ot
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
@@ -230,6 +230,8 @@ protected:
         TimeMilli    mTimestamp;   // The message timestamp.
         Message     *mNext;        // Next message in a doubly linked list.
         Message     *mPrev;        // Previous message in a doubly linked list.
+        Message     *mReadyNext;   // Next message in the priority queue "ready" view.
+        Message     *mReadyPrev;   // Previous message in the priority queue "ready" view.
         MessagePool *mMessagePool; // Message pool for this message.
         void        *mQueue;       // The queue where message is queued (if any). Queue type from `mInPriorityQ`.
         RssAverager  mRssAverager; // The averager maintaining the received signal strength (RSS) average.
@@ -1173,12 +1175,12 @@ public:
     /**
      * Unschedules forwarding using direct transmission.
      */
-    void ClearDirectTransmission(void) { GetMetadata().mDirectTx = false; }
+    void ClearDirectTransmission(void) { UpdateTxState(/* aDirectTx */ false, IsResolvingAddress()); }
 
     /**
      * Schedules forwarding using direct transmission.
      */
-    void SetDirectTransmission(void) { GetMetadata().mDirectTx = true; }
+    void SetDirectTransmission(void) { UpdateTxState(/* aDirectTx */ true, IsResolvingAddress()); }
 
     /**
      * Indicates whether the direct transmission of message was successful.
@@ -1224,7 +1226,7 @@ public:
      *
      * @param[in] aResolvingAddress    TRUE if message is waiting for address resolution, FALSE otherwise.
      */
-    void SetResolvingAddress(bool aResolvingAddress) { GetMetadata().mResolvingAddress = aResolvingAddress; }
+    void SetResolvingAddress(bool aResolvingAddress) { UpdateTxState(IsDirectTransmission(), aResolvingAddress); }
 
     /**
      * Indicates whether the message is allowed to be looped back to host.
@@ -1552,6 +1554,7 @@ private:
     bool IsInAQueue(void) const { return (GetMetadata().mQueue != nullptr); }
     void SetMessageQueue(MessageQueue *aMessageQueue);
     void SetPriorityQueue(PriorityQueue *aPriorityQueue);
+    void UpdateTxState(bool aDirectTx, bool aResolvingAddress);
 
     void SetRssAverager(const RssAverager &aRssAverager) { GetMetadata().mRssAverager = aRssAverager; }
     void SetLqiAverager(const LqiAverager &aLqiAverager) { GetMetadata().mLqiAverager = aLqiAverager; }
@@ -1559,6 +1562,9 @@ private:
     Message       *&Next(void) { return GetMetadata().mNext; }
     Message *const &Next(void) const { return GetMetadata().mNext; }
     Message       *&Prev(void) { return GetMetadata().mPrev; }
+    Message       *&ReadyNext(void) { return GetMetadata().mReadyNext; }
+    Message *const &ReadyNext(void) const { return GetMetadata().mReadyNext; }
+    Message       *&ReadyPrev(void) { return GetMetadata().mReadyPrev; }
 
     static Message       *NextOf(Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
     static const Message *NextOf(const Message *aMessage) { return (aMessage != nullptr) ? aMessage->Next() : nullptr; }
@@ -1744,6 +1750,46 @@ public:
      */
     const Message *GetHeadForPriority(Message::Priority aPriority) const;
 
+    /**
+     * Returns a pointer to the first message in the "ready" view.
+     *
+     * The "ready" view contains the messages scheduled for direct transmission that are not waiting for an address
+     * query resolution. Higher priority messages come first. Within a priority level, messages are in the order they
+     * became ready (enqueued, or moved from another view).
+     *
+     * @returns A pointer to the first ready message or `nullptr` if there is no ready message.
+     */
+    Message *GetHeadReady(void) { return AsNonConst(AsConst(this)->GetHeadReady()); }
+
+    /**
+     * Returns a pointer to the first message in the "ready" view.
+     *
+     * @returns A pointer to the first ready message or `nullptr` if there is no ready message.
+     */
+    const Message *GetHeadReady(void) const;
+
+    /**
+     * Returns a pointer to the next ready message following a given message in the queue.
+     *
+     * @p aMessage MUST be in the queue, but is not required to be itself in the "ready" view. When it is not (e.g.,
+     * it just left the view while being processed), the first ready message is returned, so a caller iterating over
+     * the view continues from its head: the messages visited before are expected to have left the view too.
+     *
+     * @param[in] aMessage   A message in the queue.
+     *
+     * @returns A pointer to the next ready message after @p aMessage or `nullptr` if there is none.
+     */
+    Message *GetNextReady(const Message &aMessage) { return AsNonConst(AsConst(this)->GetNextReady(aMessage)); }
+
+    /**
+     * Returns a pointer to the next ready message following a given message in the queue.
+     *
+     * @param[in] aMessage   A message in the queue.
+     *
+     * @returns A pointer to the next ready message after @p aMessage or `nullptr` if there is none.
+     */
+    const Message *GetNextReady(const Message &aMessage) const;
+
     /**
      * Adds a message to the queue.
      *
@@ -1796,6 +1842,25 @@ public:
      */
     void GetInfo(Info &aInfo) const;
 
+    /**
+     * Represents the number of queued messages in each view of the priority queue.
+     */
+    struct ViewInfo
+    {
+        uint16_t mNumReady;     ///< Number of messages scheduled for direct tx and ready to be sent.
+        uint16_t mNumResolving; ///< Number of messages scheduled for direct tx waiting for address resolution.
+        uint16_t mNumIndirect;  ///< Number of messages not scheduled for direct tx (e.g., indirect tx only).
+    };
+
+    /**
+     * Gets the number of messages in each view (ready, resolving, indirect) of the priority queue.
+     *
+     * Unlike `GetInfo()`, this method does not iterate over the queued messages.
+     *
+     * @param[out] aViewInfo  A reference to a `ViewInfo` to populate.
+     */
+    void GetViewInfo(ViewInfo &aViewInfo) const;
+
     // The following methods are intended to support range-based `for`
     // loop iteration over the queue entries and should not be used
     // directly. The range-based `for` works correctly even if the
@@ -1808,6 +1873,28 @@ public:
     Message::ConstIterator end(void) const { return Message::ConstIterator(); }
 
 private:
+    // Every queued message belongs to exactly one view, determined
+    // by its direct tx and resolving address flags. The messages in
+    // `kViewReady` are also linked in a per-priority intrusive list
+    // with a tail pointer, so that moving a message into the view
+    // and finding the next message ready for direct tx are done
+    // without walking over the resolving or indirect ones.
+
+    enum View : uint8_t
+    {
+        kViewReady,
+        kViewResolving,
+        kViewIndirect,
+    };
+
+    static constexpr uint8_t kNumViews = 3;
+
+    static View ViewOf(const Message &aMessage);
+    static bool IsReady(const Message &aMessage) { return ViewOf(aMessage) == kViewReady; }
+
+    void AddToView(Message &aMessage);
+    void RemoveFromView(Message &aMessage);
+
     uint8_t PrevPriority(uint8_t aPriority) const
     {
         return (aPriority == Message::kNumPriorities - 1) ? 0 : (aPriority + 1);
@@ -1820,7 +1907,10 @@ private:
         return AsNonConst(AsConst(this)->FindFirstNonNullTail(aStartPriorityLevel));
     }
 
-    Message *mTails[Message::kNumPriorities]; // Tail pointers associated with different priority levels.
+    Message *mTails[Message::kNumPriorities];      // Tail pointers associated with different priority levels.
+    Message *mReadyHeads[Message::kNumPriorities]; // Head pointers of the ready view for each priority level.
+    Message *mReadyTails[Message::kNumPriorities]; // Tail pointers of the ready view for each priority level.
+    uint16_t mViewCounts[kNumViews];               // Number of messages in each view.
 };
 
 /**
@@ -78,6 +78,20 @@ exit:
     return error;
 }
 
+Error Tlv::FindTlv(const TlvIndex &aIndex, uint8_t aType, uint16_t aMaxSize, Tlv &aTlv)
+{
+    Error      error;
+    ParsedInfo info;
+
+    SuccessOrExit(error = info.FindIn(aIndex, aType));
+
+    info.mTlvOffsetRange.ShrinkLength(aMaxSize);
+    aIndex.GetMessage().ReadBytes(info.mTlvOffsetRange, &aTlv);
+
+exit:
+    return error;
+}
+
 Error Tlv::FindTlvValueOffsetRange(const Message &aMessage, uint8_t aType, OffsetRange &aOffsetRange)
 {
     Error      error;
@@ -90,6 +104,18 @@ exit:
     return error;
 }
 
+Error Tlv::FindTlvValueOffsetRange(const TlvIndex &aIndex, uint8_t aType, OffsetRange &aOffsetRange)
+{
+    Error      error;
+    ParsedInfo info;
+
+    SuccessOrExit(error = info.FindIn(aIndex, aType));
+    aOffsetRange = info.mValueOffsetRange;
+
+exit:
+    return error;
+}
+
 Error Tlv::ParsedInfo::ParseFrom(const Message &aMessage, uint16_t aOffset)
 {
     OffsetRange offsetRange;
@@ -162,6 +188,24 @@ exit:
     return error;
 }
 
+Error Tlv::ParsedInfo::FindIn(const TlvIndex &aIndex, uint8_t aType)
+{
+    Error             error = kErrorNone;
+    const ParsedInfo *info  = aIndex.Find(aType);
+
+    if (info != nullptr)
+    {
+        *this = *info;
+        ExitNow();
+    }
+
+    VerifyOrExit(!aIndex.IsComplete(), error = kErrorNotFound);
+    error = FindIn(aIndex.GetMessage(), aType);
+
+exit:
+    return error;
+}
+
 Error Tlv::ReadStringTlv(const Message &aMessage, uint16_t aOffset, uint8_t aMaxStringLength, char *aValue)
 {
     Error      error = kErrorNone;
@@ -221,6 +265,18 @@ exit:
     return error;
 }
 
+Error Tlv::FindStringTlv(const TlvIndex &aIndex, uint8_t aType, uint8_t aMaxStringLength, char *aValue)
+{
+    Error      error;
+    ParsedInfo info;
+
+    SuccessOrExit(error = info.FindIn(aIndex, aType));
+    error = ReadStringTlv(aIndex.GetMessage(), info.mTlvOffsetRange.GetOffset(), aMaxStringLength, aValue);
+
+exit:
+    return error;
+}
+
 template <typename UintType> Error Tlv::FindUintTlv(const Message &aMessage, uint8_t aType, UintType &aValue)
 {
     Error      error;
@@ -238,6 +294,23 @@ template Error Tlv::FindUintTlv<uint8_t>(const Message &aMessage, uint8_t aType,
 template Error Tlv::FindUintTlv<uint16_t>(const Message &aMessage, uint8_t aType, uint16_t &aValue);
 template Error Tlv::FindUintTlv<uint32_t>(const Message &aMessage, uint8_t aType, uint32_t &aValue);
 
+template <typename UintType> Error Tlv::FindUintTlv(const TlvIndex &aIndex, uint8_t aType, UintType &aValue)
+{
+    Error      error;
+    ParsedInfo info;
+
+    SuccessOrExit(error = info.FindIn(aIndex, aType));
+    error = ReadUintTlv<UintType>(aIndex.GetMessage(), info.mTlvOffsetRange.GetOffset(), aValue);
+
+exit:
+    return error;
+}
+
+// Explicit instantiations of `FindUintTlv<>()` using `TlvIndex`
+template Error Tlv::FindUintTlv<uint8_t>(const TlvIndex &aIndex, uint8_t aType, uint8_t &aValue);
+template Error Tlv::FindUintTlv<uint16_t>(const TlvIndex &aIndex, uint8_t aType, uint16_t &aValue);
+template Error Tlv::FindUintTlv<uint32_t>(const TlvIndex &aIndex, uint8_t aType, uint32_t &aValue);
+
 Error Tlv::FindTlv(const Message &aMessage, uint8_t aType, void *aValue, uint16_t aLength)
 {
     Error       error;
@@ -250,6 +323,18 @@ exit:
     return error;
 }
 
+Error Tlv::FindTlv(const TlvIndex &aIndex, uint8_t aType, void *aValue, uint16_t aLength)
+{
+    Error       error;
+    OffsetRange offsetRange;
+
+    SuccessOrExit(error = FindTlvValueOffsetRange(aIndex, aType, offsetRange));
+    error = aIndex.GetMessage().Read(offsetRange, aValue, aLength);
+
+exit:
+    return error;
+}
+
 Error Tlv::AppendStringTlv(Message &aMessage, uint8_t aType, uint8_t aMaxStringLength, const char *aValue)
 {
     uint16_t length = (aValue == nullptr) ? 0 : StringLength(aValue, aMaxStringLength);
@@ -323,4 +408,50 @@ exit:
     return tlv;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// TlvIndex
+
+TlvIndex::TlvIndex(const Message &aMessage)
+    : mMessage(aMessage)
+    , mNumEntries(0)
+    , mIsComplete(true)
+{
+    OffsetRange     offsetRange;
+    Tlv::ParsedInfo info;
+
+    offsetRange.InitFromMessageOffsetToEnd(aMessage);
+
+    while (info.ParseFrom(aMessage, offsetRange) == kErrorNone)
+    {
+        if (Find(info.mType) == nullptr)
+        {
+            if (mNumEntries == kMaxEntries)
+            {
+                mIsComplete = false;
+                break;
+            }
+
+            mEntries[mNumEntries++] = info;
+        }
+
+        offsetRange.AdvanceOffset(info.mTlvOffsetRange.GetLength());
+    }
+}
+
+const Tlv::ParsedInfo *TlvIndex::Find(uint8_t aType) const
+{
+    const Tlv::ParsedInfo *info = nullptr;
+
+    for (uint8_t i = 0; i < mNumEntries; i++)
+    {
+        if (mEntries[i].mType == aType)
+        {
+            info = &mEntries[i];
+            break;
+        }
+    }
+
+    return info;
+}
+
 } // namespace ot
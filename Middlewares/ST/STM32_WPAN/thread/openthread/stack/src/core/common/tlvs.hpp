@@ -48,6 +48,7 @@
 namespace ot {
 
 class Message;
+class TlvIndex;
 
 /**
  * Implements TLV generation and parsing.
@@ -275,6 +276,20 @@ public:
          */
         Error FindIn(const Message &aMessage, uint8_t aType);
 
+        /**
+         * Looks up a TLV of given type in a `TlvIndex` and if found, sets the parsed info of the TLV.
+         *
+         * If the index could not record all TLV types present in its message, a type not in the index is searched
+         * for in the message (same as `FindIn(const Message &, uint8_t)`).
+         *
+         * @param[in] aIndex    The TLV index to search in.
+         * @param[in] aType     The TLV type to search for.
+         *
+         * @retval kErrorNone      Successfully found and parsed the TLV.
+         * @retval kErrorNotFound  Could not find the TLV, or the TLV was not well-formed.
+         */
+        Error FindIn(const TlvIndex &aIndex, uint8_t aType);
+
         /**
          * Returns the full TLV size in bytes.
          *
@@ -439,6 +454,49 @@ public:
      */
     static Error FindTlvValueOffsetRange(const Message &aMessage, uint8_t aType, OffsetRange &aOffsetRange);
 
+    /**
+     * Searches for and reads a requested TLV using a `TlvIndex` of a message.
+     *
+     * Behaves the same as `FindTlv(const Message &, uint8_t, uint16_t, Tlv &)` on the indexed message.
+     *
+     * @param[in]   aIndex      A reference to the TLV index.
+     * @param[in]   aType       The Type value to search for.
+     * @param[in]   aMaxSize    Maximum number of bytes to read.
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval kErrorNone       Successfully copied the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     */
+    static Error FindTlv(const TlvIndex &aIndex, uint8_t aType, uint16_t aMaxSize, Tlv &aTlv);
+
+    /**
+     * Searches for and reads a requested TLV using a `TlvIndex` of a message.
+     *
+     * @tparam      TlvType     The TlvType to search for (must be a sub-class of `Tlv`).
+     *
+     * @param[in]   aIndex      A reference to the TLV index.
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval kErrorNone       Successfully copied the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     */
+    template <typename TlvType> static Error FindTlv(const TlvIndex &aIndex, TlvType &aTlv)
+    {
+        return FindTlv(aIndex, TlvType::kType, sizeof(TlvType), aTlv);
+    }
+
+    /**
+     * Finds the offset range of the TLV value for a given TLV type using a `TlvIndex` of a message.
+     *
+     * @param[in]   aIndex        A reference to the TLV index.
+     * @param[in]   aType         The Type value to search for.
+     * @param[out]  aOffsetRange  A reference to return the offset range of the TLV value when found.
+     *
+     * @retval kErrorNone       Successfully found the TLV.
+     * @retval kErrorNotFound   Could not find the TLV with Type @p aType.
+     */
+    static Error FindTlvValueOffsetRange(const TlvIndex &aIndex, uint8_t aType, OffsetRange &aOffsetRange);
+
     /**
      * Searches for a TLV with a given type in a message, ensures its length is same or larger than
      * an expected minimum value, and then reads its value into a given buffer.
@@ -489,6 +547,26 @@ public:
         return FindTlv(aMessage, SimpleTlvType::kType, &aValue, sizeof(aValue));
     }
 
+    /**
+     * Searches for a simple TLV with a single non-integral value using a `TlvIndex` of a message and reads its value.
+     *
+     * Behaves the same as `Find<SimpleTlvType>(const Message &, ValueType &)` on the indexed message.
+     *
+     * @tparam       SimpleTlvType   The simple TLV type to find (must be a sub-class of `SimpleTlvInfo`)
+     *
+     * @param[in]    aIndex          A reference to the TLV index.
+     * @param[out]   aValue          A reference to the value object to output the read value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV with Type @p aType.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     */
+    template <typename SimpleTlvType>
+    static Error Find(const TlvIndex &aIndex, typename SimpleTlvType::ValueType &aValue)
+    {
+        return FindTlv(aIndex, SimpleTlvType::kType, &aValue, sizeof(aValue));
+    }
+
     /**
      * Searches for a simple TLV with a single integral value in a message, and then reads its value
      * into a given `uint` reference variable.
@@ -511,6 +589,26 @@ public:
         return FindUintTlv(aMessage, UintTlvType::kType, aValue);
     }
 
+    /**
+     * Searches for a simple TLV with a single integral value using a `TlvIndex` of a message and reads its value.
+     *
+     * Behaves the same as `Find<UintTlvType>(const Message &, UintValueType &)` on the indexed message.
+     *
+     * @tparam       UintTlvType     The simple TLV type to find (must be a sub-class of `UintTlvInfo`)
+     *
+     * @param[in]    aIndex          A reference to the TLV index.
+     * @param[out]   aValue          A reference to an unsigned int value to output the TLV's value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV with Type @p aType.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     */
+    template <typename UintTlvType>
+    static Error Find(const TlvIndex &aIndex, typename UintTlvType::UintValueType &aValue)
+    {
+        return FindUintTlv(aIndex, UintTlvType::kType, aValue);
+    }
+
     /**
      * Searches for a simple TLV with a UTF-8 string value in a message, and then reads its value
      * into a given string buffer.
@@ -536,6 +634,26 @@ public:
         return FindStringTlv(aMessage, StringTlvType::kType, StringTlvType::kMaxStringLength, aValue);
     }
 
+    /**
+     * Searches for a simple TLV with a UTF-8 string value using a `TlvIndex` of a message and reads its value.
+     *
+     * Behaves the same as `Find<StringTlvType>(const Message &, StringType &)` on the indexed message.
+     *
+     * @tparam       StringTlvType  The simple TLV type to find (must be a sub-class of `StringTlvInfo`)
+     *
+     * @param[in]    aIndex          A reference to the TLV index.
+     * @param[out]   aValue          A reference to a string buffer to output the TLV's value.
+     *
+     * @retval kErrorNone         The TLV was found and read successfully. @p aValue is updated.
+     * @retval kErrorNotFound     Could not find the TLV with Type @p aType.
+     * @retval kErrorParse        TLV was found but it was not well-formed and could not be parsed.
+     */
+    template <typename StringTlvType>
+    static Error Find(const TlvIndex &aIndex, typename StringTlvType::StringType &aValue)
+    {
+        return FindStringTlv(aIndex, StringTlvType::kType, StringTlvType::kMaxStringLength, aValue);
+    }
+
     /**
      * Appends a TLV with a given type and value to a message.
      *
@@ -696,11 +814,14 @@ protected:
 
 private:
     static Error FindTlv(const Message &aMessage, uint8_t aType, void *aValue, uint16_t aLength);
+    static Error FindTlv(const TlvIndex &aIndex, uint8_t aType, void *aValue, uint16_t aLength);
     static Error ReadStringTlv(const Message &aMessage, uint16_t aOffset, uint8_t aMaxStringLength, char *aValue);
     static Error FindStringTlv(const Message &aMessage, uint8_t aType, uint8_t aMaxStringLength, char *aValue);
+    static Error FindStringTlv(const TlvIndex &aIndex, uint8_t aType, uint8_t aMaxStringLength, char *aValue);
     static Error AppendStringTlv(Message &aMessage, uint8_t aType, uint8_t aMaxStringLength, const char *aValue);
     template <typename UintType> static Error ReadUintTlv(const Message &aMessage, uint16_t aOffset, UintType &aValue);
     template <typename UintType> static Error FindUintTlv(const Message &aMessage, uint8_t aType, UintType &aValue);
+    template <typename UintType> static Error FindUintTlv(const TlvIndex &aIndex, uint8_t aType, UintType &aValue);
     template <typename UintType> static Error AppendUintTlv(Message &aMessage, uint8_t aType, UintType aValue);
 
     uint8_t mType;
@@ -731,6 +852,62 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * Represents an index of the TLVs in a message.
+ *
+ * The index is built by a single scan over the TLVs in a message (from the message offset to its end) and records
+ * the parsed info of the first occurrence of each TLV type. It is intended to be used on-stack by handlers that look
+ * up many TLVs in the same received message, so that each lookup does not re-read the message from the start.
+ *
+ * The message MUST NOT be changed (content, length or offset) while the index is in use.
+ *
+ * Up to `kMaxEntries` distinct TLV types are recorded. The scan stops at the first TLV that is not well-formed (TLVs
+ * after it are not found, same as the `Tlv::Find` methods on the message). If the message contains more distinct
+ * types than can be recorded, lookups of types not in the index fall back to searching the message.
+ */
+class TlvIndex
+{
+public:
+    static constexpr uint8_t kMaxEntries = 16; ///< Maximum number of distinct TLV types recorded.
+
+    /**
+     * Initializes the `TlvIndex` by scanning the TLVs in a given message.
+     *
+     * @param[in] aMessage   The message to index.
+     */
+    explicit TlvIndex(const Message &aMessage);
+
+    /**
+     * Returns the indexed message.
+     *
+     * @returns The message.
+     */
+    const Message &GetMessage(void) const { return mMessage; }
+
+    /**
+     * Looks up the parsed info of a TLV of a given type in the index.
+     *
+     * @param[in] aType   The TLV type.
+     *
+     * @returns A pointer to the parsed info of the first TLV with @p aType, or `nullptr` if not in the index.
+     */
+    const Tlv::ParsedInfo *Find(uint8_t aType) const;
+
+    /**
+     * Indicates whether all TLV types in the message were recorded in the index.
+     *
+     * @retval TRUE   A type not in the index is not present in the message.
+     * @retval FALSE  The index is full and the message contains TLVs which were not recorded.
+     */
+    bool IsComplete(void) const { return mIsComplete; }
+
+private:
+    const Message  &mMessage;
+    uint8_t         mNumEntries;
+    bool            mIsComplete;
+    Tlv::ParsedInfo mEntries[kMaxEntries];
+};
+
 /**
  * Casts a `Tlv` pointer to a given subclass `TlvType` pointer.
  *
@@ -146,6 +146,8 @@
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
  * The number of MPL Seed Set entries for duplicate detection.
+ *
+ * Each entry tracks one MPL seed, along with a window of the most recently received sequence numbers from that seed.
  */
 #ifndef OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
 #define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES 35
@@ -160,6 +162,18 @@
 #define OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME 5
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE
+ *
+ * The maximum number of MPL Data Messages buffered for retransmission at the same time.
+ *
+ * Applicable only to FTD builds. A received MPL Data Message is not retransmitted (it is still forwarded once) when
+ * the buffered message set is full.
+ */
+#ifndef OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE
+#define OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_DYNAMIC_INTERVAL_ENABLE
  *
@@ -69,6 +69,35 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
+ *
+ * The maximum number of datagrams being reassembled at the same time from 6LoWPAN fragments.
+ *
+ * When the limit is reached, the least recently updated datagram is evicted to accept a new first fragment.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE
+ *
+ * The maximum number of datagrams being reassembled at the same time from the same MAC source.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS
+ *
+ * The maximum number of message buffers used by all the datagrams being reassembled.
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS / 2)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_NUM_FRAGMENT_PRIORITY_ENTRIES
  *
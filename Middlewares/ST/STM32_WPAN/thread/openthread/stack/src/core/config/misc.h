@@ -401,6 +401,19 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+ *
+ * The maximum number of valid settings records tracked by the in-RAM index of the flash settings driver.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is enabled. The index lets settings reads and
+ * deletes avoid scanning all record headers in flash. If the number of valid records exceeds this size, the driver
+ * falls back to scanning flash until a swap compacts the records enough for them to fit again.
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -577,6 +590,45 @@
 #define OPENTHREAD_CONFIG_OPERATIONAL_DATASET_AUTO_INIT 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE
+ *
+ * The number of derived MLE/MAC key pairs (one per key sequence) cached by the key manager.
+ *
+ * The keys for the current key sequence and its previous and next key sequences are always kept in the cache. The
+ * remaining entries hold the most recently used keys for other key sequences (e.g., from MLE messages received from
+ * a neighbor with an older or newer key sequence). Must be at least 4.
+ *
+ * The cache is not used when OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE is set, the derived keys are then
+ * computed each time so that they are not kept in RAM.
+ */
+#ifndef OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE
+#define OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE 5
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS
+ *
+ * The number of sets of the Network Data route lookup cache, selected by a hash of the (source, destination) pair.
+ *
+ * The cache holds `OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS * OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS` flows of
+ * 40 bytes each. It is cleared when the Network Data or the router table changes. Must be at least 1.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS
+ *
+ * The number of flows of a set of the Network Data route lookup cache, replaced in least recently used order.
+ *
+ * Must be at least 1 and at most 255; 1 makes the cache direct-mapped.
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_BLE_TCAT_ENABLE
  *
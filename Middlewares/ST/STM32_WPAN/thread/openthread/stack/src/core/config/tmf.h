@@ -117,6 +117,33 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY 120
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST
+ *
+ * Maximum number of address queries that can be sent back-to-back before the address queries are paced.
+ *
+ * When many EIDs need to be resolved at once (e.g., a border router forwarding traffic to many new destinations),
+ * the address queries beyond the burst are queued and sent one per pacing interval (refer to
+ * `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL`).
+ *
+ * Default: 4
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL
+ *
+ * Interval (in milliseconds) at which paced address queries are sent (and at which the burst allowance
+ * `OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST` is replenished).
+ *
+ * Default: 100 milliseconds
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL
+#define OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL 100
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
  *
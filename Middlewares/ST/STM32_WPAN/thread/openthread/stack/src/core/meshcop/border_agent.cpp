@@ -1437,8 +1437,9 @@ void BorderAgent::CoapDtlsSession::HandleTmfProxyTx(Coap::Message &aMessage)
     Ip6::MessageInfo          messageInfo;
     OffsetRange               offsetRange;
     UdpEncapsulationTlvHeader udpEncapHeader;
+    TlvIndex                  tlvIndex(aMessage);
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(aMessage, Tlv::kUdpEncapsulation, offsetRange));
+    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(tlvIndex, Tlv::kUdpEncapsulation, offsetRange));
 
     SuccessOrExit(error = aMessage.Read(offsetRange, udpEncapHeader));
     offsetRange.AdvanceOffset(sizeof(UdpEncapsulationTlvHeader));
@@ -1452,7 +1453,7 @@ void BorderAgent::CoapDtlsSession::HandleTmfProxyTx(Coap::Message &aMessage)
     messageInfo.SetSockAddr(mCommissionerAloc.GetAddress());
     messageInfo.SetPeerPort(udpEncapHeader.GetDestinationPort());
 
-    SuccessOrExit(error = Tlv::Find<Ip6AddressTlv>(aMessage, messageInfo.GetPeerAddr()));
+    SuccessOrExit(error = Tlv::Find<Ip6AddressTlv>(tlvIndex, messageInfo.GetPeerAddr()));
 
     SuccessOrExit(error = Get<Ip6::Udp>().SendDatagram(*message, messageInfo));
 
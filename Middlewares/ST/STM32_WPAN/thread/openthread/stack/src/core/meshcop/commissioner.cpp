@@ -883,16 +883,17 @@ template <> void Commissioner::HandleTmf<kUriRelayRx>(Coap::Message &aMessage, c
     uint16_t                 joinerRloc;
     Ip6::MessageInfo         joinerMessageInfo;
     OffsetRange              offsetRange;
+    TlvIndex                 tlvIndex(aMessage);
 
     VerifyOrExit(mState == kStateActive, error = kErrorInvalidState);
 
     VerifyOrExit(aMessage.IsNonConfirmablePostRequest());
 
-    SuccessOrExit(error = Tlv::Find<JoinerUdpPortTlv>(aMessage, joinerPort));
-    SuccessOrExit(error = Tlv::Find<JoinerIidTlv>(aMessage, joinerIid));
-    SuccessOrExit(error = Tlv::Find<JoinerRouterLocatorTlv>(aMessage, joinerRloc));
+    SuccessOrExit(error = Tlv::Find<JoinerUdpPortTlv>(tlvIndex, joinerPort));
+    SuccessOrExit(error = Tlv::Find<JoinerIidTlv>(tlvIndex, joinerIid));
+    SuccessOrExit(error = Tlv::Find<JoinerRouterLocatorTlv>(tlvIndex, joinerRloc));
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(aMessage, Tlv::kJoinerDtlsEncapsulation, offsetRange));
+    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(tlvIndex, Tlv::kJoinerDtlsEncapsulation, offsetRange));
 
     if (!Get<Tmf::SecureAgent>().IsConnectionActive())
     {
@@ -121,14 +121,15 @@ template <> void Leader::HandleTmf<kUriLeaderKeepAlive>(Coap::Message &aMessage,
     uint16_t               sessionId;
     BorderAgentLocatorTlv *borderAgentLocator;
     StateTlv::State        responseState;
+    TlvIndex               tlvIndex(aMessage);
 
     LogInfo("Received %s", UriToString<kUriLeaderKeepAlive>());
 
     VerifyOrExit(Get<Mle::Mle>().IsLeader());
 
-    SuccessOrExit(Tlv::Find<StateTlv>(aMessage, state));
+    SuccessOrExit(Tlv::Find<StateTlv>(tlvIndex, state));
 
-    SuccessOrExit(Tlv::Find<CommissionerSessionIdTlv>(aMessage, sessionId));
+    SuccessOrExit(Tlv::Find<CommissionerSessionIdTlv>(tlvIndex, sessionId));
 
     borderAgentLocator = Get<NetworkData::Leader>().FindInCommissioningData<BorderAgentLocatorTlv>();
 
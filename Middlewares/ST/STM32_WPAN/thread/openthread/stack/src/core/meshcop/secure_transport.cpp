@@ -672,6 +672,7 @@ SecureTransport::SecureTransport(Instance &aInstance, LinkSecurityMode aLayerTwo
     , mPskLength(0)
     , mMaxConnectionAttempts(0)
     , mRemainingConnectionAttempts(0)
+    , mLastRxSession(nullptr)
     , mSocket(aInstance, *this)
     , mTimer(aInstance, HandleTimer, this)
     , mUpdateTask(aInstance, HandleUpdateTask, this)
@@ -718,10 +719,23 @@ void SecureTransport::HandleReceive(Message &aMessage, const Ip6::MessageInfo &a
 
     VerifyOrExit(mIsOpen);
 
-    session = mSessions.FindMatching(aMessageInfo);
+    // Consecutive datagrams (e.g., the flights of a handshake) are
+    // usually from the same peer, so check the session that received
+    // the previous one before searching the list. `mLastRxSession`
+    // is cleared whenever sessions are removed from `mSessions`.
+
+    if ((mLastRxSession != nullptr) && mLastRxSession->Matches(aMessageInfo))
+    {
+        session = mLastRxSession;
+    }
+    else
+    {
+        session = mSessions.FindMatching(aMessageInfo);
+    }
 
     if (session != nullptr)
     {
+        mLastRxSession = session;
         session->HandleTransportReceive(aMessage);
         ExitNow();
     }
@@ -810,6 +824,7 @@ void SecureTransport::RemoveDisconnectedSessions(void)
     SecureSession            *session;
 
     mSessions.RemoveAllMatching(disconnectedSessions, SecureSession::kStateDisconnected);
+    mLastRxSession = nullptr;
 
     while ((session = disconnectedSessions.Pop()) != nullptr)
     {
@@ -823,6 +823,7 @@ private:
     uint16_t                        mMaxConnectionAttempts;
     uint16_t                        mRemainingConnectionAttempts;
     LinkedList<SecureSession>       mSessions;
+    SecureSession                  *mLastRxSession;
     TransportSocket                 mSocket;
     uint8_t                         mPsk[kPskMaxLength];
     TimerMilliContext               mTimer;
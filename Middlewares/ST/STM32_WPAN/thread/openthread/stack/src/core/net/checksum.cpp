@@ -67,17 +67,60 @@ void Checksum::AddUint8(uint8_t aUint8)
 
 void Checksum::AddUint16(uint16_t aUint16)
 {
-    // BigEndian encoding
-    AddUint8(static_cast<uint8_t>(aUint16 >> 8));
-    AddUint8(static_cast<uint8_t>(aUint16 & 0xff));
+    uint8_t bytes[sizeof(uint16_t)];
+
+    BigEndian::WriteUint16(aUint16, bytes);
+    AddData(bytes, sizeof(bytes));
 }
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    for (uint16_t i = 0; i < aLength; i++)
+    // The data is summed as big-endian 16-bit words into a 32-bit
+    // accumulator and the carries are folded back at the end. With
+    // `aLength` limited to 16 bits, the accumulator cannot overflow.
+    // Deferring the end-around carry gives the same one's complement
+    // sum as adding the bytes one at a time.
+
+    uint32_t sum = mValue;
+
+    VerifyOrExit(aLength > 0);
+
+    if (mAtOddIndex)
+    {
+        // Previous data ended on an odd index, so the first byte is
+        // the LSB of the current 16-bit word.
+
+        sum += *aBuffer++;
+        aLength--;
+        mAtOddIndex = false;
+    }
+
+    for (; aLength >= 4; aBuffer += 4, aLength -= 4)
+    {
+        sum += BigEndian::ReadUint16(aBuffer);
+        sum += BigEndian::ReadUint16(aBuffer + 2);
+    }
+
+    for (; aLength >= 2; aBuffer += 2, aLength -= 2)
     {
-        AddUint8(aBuffer[i]);
+        sum += BigEndian::ReadUint16(aBuffer);
     }
+
+    if (aLength > 0)
+    {
+        sum += static_cast<uint32_t>(*aBuffer) << 8;
+        mAtOddIndex = true;
+    }
+
+    while ((sum >> 16) != 0)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    mValue = static_cast<uint16_t>(sum);
+
+exit:
+    return;
 }
 
 void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
@@ -45,7 +45,6 @@ Mpl::Mpl(Instance &aInstance)
     , mRetransmissionTimer(aInstance)
 #endif
 {
-    ClearAllBytes(mSeedSet);
 }
 
 void MplOption::Init(SeedIdLength aSeedIdLength)
@@ -115,7 +114,16 @@ Error Mpl::ProcessOption(Message &aMessage, const OffsetRange &aOffsetRange, con
     if (error == kErrorNone)
     {
 #if OPENTHREAD_FTD
-        AddBufferedMessage(aMessage, option.GetSeedId(), option.GetSequence());
+        if ((AddBufferedMessage(aMessage, option.GetSeedId(), option.GetSequence()) == kErrorNoBufs) &&
+            aMessage.IsOriginThreadNetif())
+        {
+            // A received MPL Data Message is only forwarded from the
+            // buffered message set. It is not recorded as received
+            // when it could not be forwarded, so that a retransmission
+            // from a neighbor can still be.
+
+            mSeedSet.Remove(option.GetSeedId(), option.GetSequence());
+        }
 #endif
     }
     else if (!aMessage.IsOriginThreadNetif())
@@ -130,176 +138,224 @@ exit:
     return error;
 }
 
-/*
- * mSeedSet stores recently received (Seed ID, Sequence) values.
- * - (Seed ID, Sequence) values are grouped by Seed ID.
- * - (Seed ID, Sequence) groups are not sorted by Seed ID relative to other groups.
- * - (Seed ID, Sequence) values within a group are sorted by Sequence.
- * - All unused entries (marked by 0 lifetime) are grouped at the end.
- *
- * Update process:
- *
- * - Eviction selection:
- *   - If there are unused entries, mark the first unused entry for "eviction"
- *   - Otherwise, pick the first entry of the group that has the most entries.
- *
- * - Insert selection:
- *   - If there exists a group matching the Seed ID, select insert entry based on Sequence ordering.
- *   - Otherwise, set insert entry equal to evict entry.
- *
- * - If evicting a valid entry (lifetime non-zero):
- *   - Require group size to have >=2 entries.
- *   - If inserting into existing group, require Sequence to be larger than oldest stored Sequence in group.
- */
 Error Mpl::UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence)
 {
-    Error      error    = kErrorNone;
-    SeedEntry *insert   = nullptr;
-    SeedEntry *group    = mSeedSet;
-    SeedEntry *evict    = mSeedSet;
-    uint8_t    curCount = 0;
-    uint8_t    maxCount = 0;
-
-    for (uint32_t i = 0; i < kNumSeedEntries; i++, curCount++)
+    Error error = mSeedSet.Update(aSeedId, aSequence, kSeedEntryLifetime);
+
+    Get<TimeTicker>().RegisterReceiver(TimeTicker::kIp6Mpl);
+
+    return error;
+}
+
+void Mpl::HandleTimeTick(void)
+{
+    if (!mSeedSet.HandleTimeTick())
     {
-        if (mSeedSet[i].mLifetime == 0)
-        {
-            // unused entries exist
+        Get<TimeTicker>().UnregisterReceiver(TimeTicker::kIp6Mpl);
+    }
+}
 
-            if (insert == nullptr)
-            {
-                // no existing group, set insert and evict entry to be the same
-                insert = &mSeedSet[i];
-            }
+//---------------------------------------------------------------------------------------------------------------------
+// Mpl::SeedSet
+
+void Mpl::SeedSet::Clear(void)
+{
+    memset(mHeads, kInvalidIndex, sizeof(mHeads));
+    ClearAllBytes(mEntries);
+}
+
+Mpl::SeedSet::Entry *Mpl::SeedSet::Allocate(uint16_t aSeedId)
+{
+    // Uses an unused entry if there is one. Otherwise evicts the
+    // entry closest to expiring among the seeds having more than one
+    // entry, the last entry of a seed is never evicted. Returns
+    // `nullptr` if no entry can be evicted.
 
-            // mark first unused entry for eviction
-            evict = &mSeedSet[i];
+    Entry  *entry  = nullptr;
+    uint8_t bucket = GetBucket(aSeedId);
+
+    for (Entry &candidate : mEntries)
+    {
+        if (candidate.mLifetime == 0)
+        {
+            entry = &candidate;
             break;
         }
 
-        if (mSeedSet[i].mSeedId != group->mSeedId)
+        if (((entry == nullptr) || (candidate.mLifetime < entry->mLifetime)) && HasOtherEntry(candidate))
         {
-            // processing new group
+            entry = &candidate;
+        }
+    }
 
-            if (aSeedId == group->mSeedId && insert == nullptr)
-            {
-                // insert at end of existing group
-                insert = &mSeedSet[i];
-                curCount++;
-            }
+    VerifyOrExit(entry != nullptr);
 
-            if (maxCount < curCount)
-            {
-                // look to evict an entry from the seed with the most entries
-                evict    = group;
-                maxCount = curCount;
-            }
+    if (entry->mLifetime != 0)
+    {
+        Unlink(*entry);
+    }
 
-            group    = &mSeedSet[i];
-            curCount = 0;
-        }
+    entry->mSeedId = aSeedId;
+    entry->mNext   = mHeads[bucket];
+    mHeads[bucket] = static_cast<uint8_t>(entry - mEntries);
 
-        if (aSeedId == mSeedSet[i].mSeedId)
-        {
-            // have existing entries for aSeedId
+exit:
+    return entry;
+}
 
-            if (aSequence == mSeedSet[i].mSequence)
-            {
-                // already received, drop message
+bool Mpl::SeedSet::HasOtherEntry(const Entry &aEntry) const
+{
+    bool hasOther = false;
 
-                mSeedSet[i].mLifetime = kSeedEntryLifetime;
-                ExitNow(error = kErrorDrop);
-            }
-            else if (insert == nullptr && SerialNumber::IsLess(aSequence, mSeedSet[i].mSequence))
-            {
-                // insert in order of sequence
-                insert = &mSeedSet[i];
-                curCount++;
-            }
+    for (uint8_t index = mHeads[GetBucket(aEntry.mSeedId)]; index != kInvalidIndex; index = mEntries[index].mNext)
+    {
+        if ((mEntries[index].mSeedId == aEntry.mSeedId) && (&mEntries[index] != &aEntry))
+        {
+            hasOther = true;
+            break;
         }
     }
 
-    if (evict->mLifetime != 0)
+    return hasOther;
+}
+
+void Mpl::SeedSet::Unlink(Entry &aEntry)
+{
+    uint8_t  index = static_cast<uint8_t>(&aEntry - mEntries);
+    uint8_t *link  = &mHeads[GetBucket(aEntry.mSeedId)];
+
+    while ((*link != index) && (*link != kInvalidIndex))
     {
-        // no free entries available, look to evict an existing entry
-        OT_ASSERT(curCount != 0);
+        link = &mEntries[*link].mNext;
+    }
 
-        if (aSeedId == group->mSeedId && insert == nullptr)
-        {
-            // insert at end of existing group
-            insert = &mSeedSet[kNumSeedEntries];
-            curCount++;
-        }
+    if (*link == index)
+    {
+        *link = aEntry.mNext;
+    }
+
+    aEntry.mLifetime = 0;
+}
+
+Error Mpl::SeedSet::Update(uint16_t aSeedId, uint8_t aSequence, uint8_t aLifetime)
+{
+    // Returns `kErrorNone` if (`aSeedId`, `aSequence`) is new and is
+    // now recorded, or `kErrorDrop` if it was already received or
+    // cannot be recorded because the seed set is full.
+
+    Error  error   = kErrorNone;
+    Entry *covered = nullptr;
+    Entry *below   = nullptr;
+    Entry *entry   = nullptr;
 
-        if (maxCount < curCount)
+    for (uint8_t index = mHeads[GetBucket(aSeedId)]; index != kInvalidIndex; index = mEntries[index].mNext)
+    {
+        Entry &candidate = mEntries[index];
+
+        if (candidate.mSeedId != aSeedId)
         {
-            // look to evict an entry from the seed with the most entries
-            evict    = group;
-            maxCount = curCount;
+            continue;
         }
 
-        // require evict group size to have >= 2 entries
-        VerifyOrExit(maxCount > 1, error = kErrorDrop);
-
-        if (insert == nullptr)
+        if (candidate.Covers(aSequence))
         {
-            // no existing entries for aSeedId
-            insert = evict;
+            if ((candidate.mWindow & candidate.GetMask(aSequence)) != 0)
+            {
+                candidate.mLifetime = aLifetime;
+                ExitNow(error = kErrorDrop);
+            }
+
+            if (covered == nullptr)
+            {
+                covered = &candidate;
+            }
         }
-        else
+        else if (SerialNumber::IsGreater(aSequence, candidate.mHighestSequence) &&
+                 ((below == nullptr) || SerialNumber::IsGreater(candidate.mHighestSequence, below->mHighestSequence)))
         {
-            // require Sequence to be larger than oldest stored Sequence in group
-            VerifyOrExit(insert > mSeedSet && aSeedId == (insert - 1)->mSeedId, error = kErrorDrop);
+            below = &candidate;
         }
     }
 
-    if (evict > insert)
+    if (covered != nullptr)
     {
-        OT_ASSERT(insert >= mSeedSet);
-        memmove(insert + 1, insert, static_cast<size_t>(evict - insert) * sizeof(SeedEntry));
+        entry = covered;
+        entry->mWindow |= entry->GetMask(aSequence);
     }
-    else if (evict < insert)
+    else if (below != nullptr)
     {
-        OT_ASSERT(evict >= mSeedSet);
-        memmove(evict, evict + 1, static_cast<size_t>(insert - 1 - evict) * sizeof(SeedEntry));
-        insert--;
+        // Slide the window of the closest entry below the sequence.
+
+        uint8_t distance = aSequence - below->mHighestSequence;
+
+        entry                   = below;
+        entry->mWindow          = (distance < kWindowSize) ? ((entry->mWindow << distance) | 1) : 1;
+        entry->mHighestSequence = aSequence;
     }
+    else
+    {
+        // New seed, or a sequence below all the windows of the seed.
 
-    insert->mSeedId   = aSeedId;
-    insert->mSequence = aSequence;
-    insert->mLifetime = kSeedEntryLifetime;
+        entry = Allocate(aSeedId);
+        VerifyOrExit(entry != nullptr, error = kErrorDrop);
 
-    Get<TimeTicker>().RegisterReceiver(TimeTicker::kIp6Mpl);
+        entry->mHighestSequence = aSequence;
+        entry->mWindow          = 1;
+    }
+
+    entry->mLifetime = aLifetime;
 
 exit:
     return error;
 }
 
-void Mpl::HandleTimeTick(void)
+void Mpl::SeedSet::Remove(uint16_t aSeedId, uint8_t aSequence)
 {
-    bool continueRxingTicks = false;
-    int  j                  = 0;
+    // Forgets a sequence recorded by `Update()`.
 
-    for (int i = 0; i < kNumSeedEntries && mSeedSet[i].mLifetime; i++)
+    for (uint8_t index = mHeads[GetBucket(aSeedId)]; index != kInvalidIndex; index = mEntries[index].mNext)
     {
-        mSeedSet[i].mLifetime--;
+        Entry &entry = mEntries[index];
 
-        if (mSeedSet[i].mLifetime > 0)
+        if ((entry.mSeedId == aSeedId) && entry.Covers(aSequence) && ((entry.mWindow & entry.GetMask(aSequence)) != 0))
         {
-            mSeedSet[j++]      = mSeedSet[i];
-            continueRxingTicks = true;
+            entry.mWindow &= ~entry.GetMask(aSequence);
+
+            if (entry.mWindow == 0)
+            {
+                Unlink(entry);
+            }
+
+            break;
         }
     }
+}
 
-    for (; j < kNumSeedEntries && mSeedSet[j].mLifetime; j++)
-    {
-        mSeedSet[j].mLifetime = 0;
-    }
+bool Mpl::SeedSet::HandleTimeTick(void)
+{
+    // Ages all entries by one tick and frees the expired ones.
+    // Returns whether any entry is still in use.
+
+    bool inUse = false;
 
-    if (!continueRxingTicks)
+    for (Entry &entry : mEntries)
     {
-        Get<TimeTicker>().UnregisterReceiver(TimeTicker::kIp6Mpl);
+        if (entry.mLifetime == 0)
+        {
+            continue;
+        }
+
+        if (entry.mLifetime == 1)
+        {
+            Unlink(entry);
+            continue;
+        }
+
+        entry.mLifetime--;
+        inUse = true;
     }
+
+    return inUse;
 }
 
 #if OPENTHREAD_FTD
@@ -327,7 +383,7 @@ uint8_t Mpl::DetermineMaxRetransmissions(void) const
     return maxRetx;
 }
 
-void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence)
+Error Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence)
 {
     Error    error       = kErrorNone;
     Message *messageCopy = nullptr;
@@ -343,6 +399,11 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
 #endif
 
     VerifyOrExit(DetermineMaxRetransmissions() > 0);
+
+    // A message from the host is forwarded by `Ip6` itself, it is
+    // only retransmitted from here.
+    VerifyOrExit(aMessage.IsOriginThreadNetif() || !mRetxSchedule.IsFull());
+
     VerifyOrExit((messageCopy = aMessage.Clone()) != nullptr, error = kErrorNoBufs);
 
     if (aMessage.IsOriginThreadNetif())
@@ -352,6 +413,17 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
         messageCopy->Write(Header::kHopLimitFieldOffset, hopLimit);
     }
 
+    if (mRetxSchedule.IsFull())
+    {
+        // No retransmission can be scheduled, forward the received
+        // message once now.
+
+        messageCopy->SetLoopbackToHostAllowed(true);
+        messageCopy->SetOrigin(Message::kOriginHostTrusted);
+        Get<Ip6>().EnqueueDatagram(*messageCopy);
+        ExitNow();
+    }
+
     // If the message originates from Thread Netif (i.e., it was
     // received over Thread radio), set the `mTransmissionCount` to
     // zero. Otherwise, the message originates from the host and will
@@ -367,31 +439,32 @@ void Mpl::AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSeque
 
     SuccessOrExit(error = metadata.AppendTo(*messageCopy));
     mBufferedMessageSet.Enqueue(*messageCopy);
+    mRetxSchedule.Push(*messageCopy, metadata.mTransmissionTime);
 
     mRetransmissionTimer.FireAtIfEarlier(metadata.mTransmissionTime);
 
 exit:
     FreeMessageOnError(messageCopy, error);
+    return error;
 }
 
 void Mpl::HandleRetransmissionTimer(void)
 {
     NextFireTime nextTime;
 
-    for (Message &message : mBufferedMessageSet)
+    // Only the messages whose transmission time has been reached are
+    // visited, in order of their transmission time.
+
+    while (!mRetxSchedule.IsEmpty() && !(nextTime.GetNow() < mRetxSchedule.GetTop().mTime))
     {
+        Message &message = *mRetxSchedule.GetTop().mMessage;
         Metadata metadata;
         Message *messageCopy;
         uint8_t  maxRetx;
 
-        metadata.ReadFrom(message);
-
-        if (nextTime.GetNow() < metadata.mTransmissionTime)
-        {
-            nextTime.UpdateIfEarlier(metadata.mTransmissionTime);
-            continue;
-        }
+        mRetxSchedule.Pop();
 
+        metadata.ReadFrom(message);
         metadata.mTransmissionCount++;
 
         maxRetx = DetermineMaxRetransmissions();
@@ -412,7 +485,7 @@ void Mpl::HandleRetransmissionTimer(void)
             metadata.GenerateNextTransmissionTime(nextTime.GetNow(), kDataMessageInterval);
             metadata.UpdateIn(message);
 
-            nextTime.UpdateIfEarlier(metadata.mTransmissionTime);
+            mRetxSchedule.Push(message, metadata.mTransmissionTime);
 
             messageCopy = message.Clone();
         }
@@ -443,9 +516,74 @@ void Mpl::HandleRetransmissionTimer(void)
         }
     }
 
+    if (!mRetxSchedule.IsEmpty())
+    {
+        nextTime.UpdateIfEarlier(mRetxSchedule.GetTop().mTime);
+    }
+
     mRetransmissionTimer.FireAt(nextTime);
 }
 
+void Mpl::RetxSchedule::Push(Message &aMessage, TimeMilli aTime)
+{
+    uint16_t index = mLength++;
+
+    OT_ASSERT(index < kMaxBufferedMessages);
+
+    // Sift up.
+    while (index > 0)
+    {
+        uint16_t parent = (index - 1) / 2;
+
+        if (!(aTime < mEntries[parent].mTime))
+        {
+            break;
+        }
+
+        mEntries[index] = mEntries[parent];
+        index           = parent;
+    }
+
+    mEntries[index].mTime    = aTime;
+    mEntries[index].mMessage = &aMessage;
+}
+
+void Mpl::RetxSchedule::Pop(void)
+{
+    Entry    last;
+    uint16_t index = 0;
+
+    OT_ASSERT(mLength > 0);
+
+    last = mEntries[--mLength];
+
+    // Sift down the last entry from the root.
+    while (true)
+    {
+        uint16_t child = 2 * index + 1;
+
+        if (child >= mLength)
+        {
+            break;
+        }
+
+        if ((child + 1 < mLength) && (mEntries[child + 1].mTime < mEntries[child].mTime))
+        {
+            child++;
+        }
+
+        if (!(mEntries[child].mTime < last.mTime))
+        {
+            break;
+        }
+
+        mEntries[index] = mEntries[child];
+        index           = child;
+    }
+
+    mEntries[index] = last;
+}
+
 void Mpl::Metadata::GenerateNextTransmissionTime(TimeMilli aCurrentTime, uint8_t aInterval)
 {
     // Emulate Trickle timer behavior and set up the next retransmission within [0,I) range.
@@ -202,18 +202,68 @@ private:
     static constexpr uint32_t kSeedEntryLifetimeDt = 1000;
     static constexpr uint8_t  kDataMessageInterval = 64;
 
-    struct SeedEntry
+    class SeedSet
     {
-        uint16_t mSeedId;
-        uint8_t  mSequence;
-        uint8_t  mLifetime;
+        // Tracks the recently received MPL Data Messages per seed.
+        // Entries are indexed by a hash of the Seed ID. Each entry
+        // keeps a highest sequence and a bitmap window of the
+        // `kWindowSize` sequences at or below it (bit `n` is set when
+        // sequence `highest - n` was received). A seed gets another
+        // entry for a sequence below all its windows (e.g., after the
+        // seed restarted), so such a sequence is still accepted.
+
+    public:
+        SeedSet(void) { Clear(); }
+
+        void  Clear(void);
+        Error Update(uint16_t aSeedId, uint8_t aSequence, uint8_t aLifetime);
+        void  Remove(uint16_t aSeedId, uint8_t aSequence);
+        bool  HandleTimeTick(void);
+
+    private:
+        static constexpr uint8_t kWindowSize   = 32;
+        static constexpr uint8_t kNumBuckets   = 16;
+        static constexpr uint8_t kInvalidIndex = 0xff;
+
+        static_assert(kNumSeedEntries < kInvalidIndex, "OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES is too large");
+
+        struct Entry
+        {
+            bool Covers(uint8_t aSequence) const
+            {
+                return static_cast<uint8_t>(mHighestSequence - aSequence) < kWindowSize;
+            }
+
+            uint32_t GetMask(uint8_t aSequence) const
+            {
+                return static_cast<uint32_t>(1) << static_cast<uint8_t>(mHighestSequence - aSequence);
+            }
+
+            uint32_t mWindow;
+            uint16_t mSeedId;
+            uint8_t  mHighestSequence;
+            uint8_t  mLifetime; // Zero when entry is unused.
+            uint8_t  mNext;
+        };
+
+        static uint8_t GetBucket(uint16_t aSeedId)
+        {
+            return static_cast<uint8_t>((aSeedId ^ (aSeedId >> 8)) % kNumBuckets);
+        }
+
+        Entry *Allocate(uint16_t aSeedId);
+        bool   HasOtherEntry(const Entry &aEntry) const;
+        void   Unlink(Entry &aEntry);
+
+        uint8_t mHeads[kNumBuckets];
+        Entry   mEntries[kNumSeedEntries];
     };
 
     void  HandleTimeTick(void);
     Error UpdateSeedSet(uint16_t aSeedId, uint8_t aSequence);
 
-    SeedEntry mSeedSet[kNumSeedEntries];
-    uint8_t   mSequence;
+    SeedSet mSeedSet;
+    uint8_t mSequence;
 
 #if OPENTHREAD_FTD
     static constexpr uint8_t kChildRetransmissions  = 0; // MPL retransmissions for Children.
@@ -230,13 +280,45 @@ private:
         uint8_t   mIntervalOffset;
     };
 
+    static constexpr uint16_t kMaxBufferedMessages = OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE;
+
+    class RetxSchedule
+    {
+        // Binary min-heap of the buffered messages ordered by their
+        // next transmission time, so that the next due message is
+        // found (and rescheduled) in O(log n).
+
+    public:
+        struct Entry
+        {
+            TimeMilli mTime;
+            Message  *mMessage;
+        };
+
+        RetxSchedule(void)
+            : mLength(0)
+        {
+        }
+
+        bool         IsEmpty(void) const { return (mLength == 0); }
+        bool         IsFull(void) const { return (mLength == kMaxBufferedMessages); }
+        const Entry &GetTop(void) const { return mEntries[0]; }
+        void         Push(Message &aMessage, TimeMilli aTime);
+        void         Pop(void);
+
+    private:
+        Entry    mEntries[kMaxBufferedMessages];
+        uint16_t mLength;
+    };
+
     uint8_t DetermineMaxRetransmissions(void) const;
     void    HandleRetransmissionTimer(void);
-    void    AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence);
+    Error   AddBufferedMessage(Message &aMessage, uint16_t aSeedId, uint8_t aSequence);
 
     using RetxTimer = TimerMilliIn<Mpl, &Mpl::HandleRetransmissionTimer>;
 
     MessageQueue mBufferedMessageSet;
+    RetxSchedule mRetxSchedule;
     RetxTimer    mRetransmissionTimer;
 #endif // OPENTHREAD_FTD
 };
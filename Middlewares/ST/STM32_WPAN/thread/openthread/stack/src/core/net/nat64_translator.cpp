@@ -70,6 +70,8 @@ Translator::Translator(Instance &aInstance)
 {
     Random::NonCrypto::Fill(mNextMappingId);
 
+    ClearAllBytes(mIp6Index);
+    ClearAllBytes(mIp4Index);
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
     mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
@@ -345,8 +347,158 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
     }
 }
 
+bool Translator::AddressMapping::Matches(const Ip6::Address &aIp6, uint16_t aPort) const
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return (mIp6 == aIp6) && (mSrcPortOrId == aPort);
+#else
+    OT_UNUSED_VARIABLE(aPort);
+    return (mIp6 == aIp6);
+#endif
+}
+
+bool Translator::AddressMapping::Matches(const Ip4::Address &aIp4, uint16_t aPort) const
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return (mIp4 == aIp4) && (mTranslatedPortOrId == aPort);
+#else
+    OT_UNUSED_VARIABLE(aPort);
+    return (mIp4 == aIp4);
+#endif
+}
+
+void Translator::ExpiryQueue::Append(AddressMapping &aMapping)
+{
+    aMapping.mQueueNext = nullptr;
+    aMapping.mQueuePrev = mTail;
+
+    if (mTail != nullptr)
+    {
+        mTail->mQueueNext = &aMapping;
+    }
+    else
+    {
+        mHead = &aMapping;
+    }
+
+    mTail = &aMapping;
+}
+
+void Translator::ExpiryQueue::Remove(AddressMapping &aMapping)
+{
+    if (aMapping.mQueuePrev != nullptr)
+    {
+        aMapping.mQueuePrev->mQueueNext = aMapping.mQueueNext;
+    }
+    else
+    {
+        mHead = aMapping.mQueueNext;
+    }
+
+    if (aMapping.mQueueNext != nullptr)
+    {
+        aMapping.mQueueNext->mQueuePrev = aMapping.mQueuePrev;
+    }
+    else
+    {
+        mTail = aMapping.mQueuePrev;
+    }
+
+    aMapping.mQueueNext = nullptr;
+    aMapping.mQueuePrev = nullptr;
+}
+
+Translator::ExpiryQueue &Translator::GetExpiryQueue(const AddressMapping &aMapping)
+{
+    return aMapping.mIsIcmp ? mIcmpQueue : mIdleQueue;
+}
+
+uint16_t Translator::GetIp6Bucket(const Ip6::Address &aIp6, uint16_t aPort)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    return static_cast<uint16_t>(HashObject(aPort, HashObject(aIp6)) % kNumHashBuckets);
+#else
+    OT_UNUSED_VARIABLE(aPort);
+    return static_cast<uint16_t>(HashObject(aIp6) % kNumHashBuckets);
+#endif
+}
+
+uint16_t Translator::GetIp4Bucket(const Ip4::Address &aIp4, uint16_t aPort)
+{
+#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
+    // Translated ports are allocated randomly, so they are used
+    // directly as the hash.
+    OT_UNUSED_VARIABLE(aIp4);
+    return GetPortBucket(aPort);
+#else
+    OT_UNUSED_VARIABLE(aPort);
+    return static_cast<uint16_t>(HashObject(aIp4) % kNumHashBuckets);
+#endif
+}
+
+void Translator::AddToIndex(AddressMapping &aMapping)
+{
+    AddressMapping *&ip6Head = mIp6Index[GetIp6Bucket(aMapping.mIp6, aMapping.mSrcPortOrId)];
+    AddressMapping *&ip4Head = mIp4Index[GetIp4Bucket(aMapping.mIp4, aMapping.mTranslatedPortOrId)];
+
+    // New mappings are added at the head of each bucket so that a
+    // lookup finds the most recently created match first.
+
+    aMapping.mIp6HashNext = ip6Head;
+    ip6Head               = &aMapping;
+    aMapping.mIp4HashNext = ip4Head;
+    ip4Head               = &aMapping;
+}
+
+void Translator::RemoveFromIndex(AddressMapping &aMapping)
+{
+    AddressMapping **link;
+
+    for (link = &mIp6Index[GetIp6Bucket(aMapping.mIp6, aMapping.mSrcPortOrId)]; *link != nullptr;
+         link = &(*link)->mIp6HashNext)
+    {
+        if (*link == &aMapping)
+        {
+            *link = aMapping.mIp6HashNext;
+            break;
+        }
+    }
+
+    for (link = &mIp4Index[GetIp4Bucket(aMapping.mIp4, aMapping.mTranslatedPortOrId)]; *link != nullptr;
+         link = &(*link)->mIp4HashNext)
+    {
+        if (*link == &aMapping)
+        {
+            *link = aMapping.mIp4HashNext;
+            break;
+        }
+    }
+}
+
+void Translator::ClearMappings(void)
+{
+    mAddressMappingPool.FreeAll();
+    mIdleQueue.Clear();
+    mIcmpQueue.Clear();
+    ClearAllBytes(mIp6Index);
+    ClearAllBytes(mIp4Index);
+}
+
+void Translator::TouchMapping(AddressMapping &aMapping, uint8_t aProtocol)
+{
+    // Moves the mapping to the tail of the queue matching its new
+    // idle timeout.
+
+    GetExpiryQueue(aMapping).Remove(aMapping);
+    aMapping.Touch(TimerMilli::GetNow(), aProtocol);
+    GetExpiryQueue(aMapping).Append(aMapping);
+}
+
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    GetExpiryQueue(aMapping).Remove(aMapping);
+    RemoveFromIndex(aMapping);
+
     if (mIp4Cidr.mLength <= kMaxCidrLenForValidAddrPool)
     {
         // IPv4 addresses are allocated from the pool only when the pool size is above a minimum value.
@@ -357,11 +509,30 @@ void Translator::ReleaseMapping(AddressMapping &aMapping)
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
 }
 
-uint16_t Translator::ReleaseMappings(LinkedList<AddressMapping> &aMappings)
+void Translator::ReleaseAllMappings(void)
 {
-    uint16_t numRemoved = 0;
+    AddressMapping *mapping;
+
+    while ((mapping = mIdleQueue.GetHead()) != nullptr)
+    {
+        ReleaseMapping(*mapping);
+    }
+
+    while ((mapping = mIcmpQueue.GetHead()) != nullptr)
+    {
+        ReleaseMapping(*mapping);
+    }
+}
+
+uint16_t Translator::ReleaseExpiredMappings(ExpiryQueue &aQueue, TimeMilli aNow)
+{
+    uint16_t        numRemoved = 0;
+    AddressMapping *mapping;
+
+    // The queue is sorted by expiry, so stop at the first mapping
+    // that has not expired yet.
 
-    for (AddressMapping *mapping = aMappings.Pop(); mapping != nullptr; mapping = aMappings.Pop())
+    while (((mapping = aQueue.GetHead()) != nullptr) && (mapping->mExpiry < aNow))
     {
         numRemoved++;
         ReleaseMapping(*mapping);
@@ -372,12 +543,11 @@ uint16_t Translator::ReleaseMappings(LinkedList<AddressMapping> &aMappings)
 
 uint16_t Translator::ReleaseExpiredMappings(void)
 {
-    LinkedList<AddressMapping> idleMappings;
+    TimeMilli now = TimerMilli::GetNow();
 
-    mActiveAddressMappings.RemoveAllMatching(idleMappings, TimerMilli::GetNow());
-
-    return ReleaseMappings(idleMappings);
+    return ReleaseExpiredMappings(mIdleQueue, now) + ReleaseExpiredMappings(mIcmpQueue, now);
 }
+
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
 uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
 {
@@ -395,10 +565,25 @@ uint16_t Translator::AllocateSourcePort(uint16_t aSrcPort)
         {
             retPort++;
         }
-    } while (mActiveAddressMappings.ContainsMatching(retPort));
+    } while (IsTranslatedPortInUse(retPort));
 
     return retPort;
 }
+
+bool Translator::IsTranslatedPortInUse(uint16_t aPort) const
+{
+    const AddressMapping *mapping;
+
+    for (mapping = mIp4Index[GetPortBucket(aPort)]; mapping != nullptr; mapping = mapping->mIp4HashNext)
+    {
+        if (mapping->mTranslatedPortOrId == aPort)
+        {
+            break;
+        }
+    }
+
+    return (mapping != nullptr);
+}
 #endif
 
 Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Headers &aIp6Headers)
@@ -432,7 +617,6 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Headers &aIp6
     // translation.
     VerifyOrExit(mapping != nullptr);
 
-    mActiveAddressMappings.Push(*mapping);
     mapping->mCounters.Clear();
     mapping->mId  = ++mNextMappingId;
     mapping->mIp6 = aIp6Headers.GetSourceAddress();
@@ -446,6 +630,8 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Headers &aIp6
     mapping->mTranslatedPortOrId = 0;
 #endif
     mapping->Touch(TimerMilli::GetNow(), aIp6Headers.GetIpProto());
+    GetExpiryQueue(*mapping).Append(*mapping);
+    AddToIndex(*mapping);
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
 exit:
@@ -454,12 +640,17 @@ exit:
 
 Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Headers &aIp6Headers)
 {
-#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-    uint16_t srcPortOrId    = aIp6Headers.IsIcmp6() ? aIp6Headers.GetIcmpHeader().GetId() : aIp6Headers.GetSourcePort();
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Headers.GetSourceAddress(), srcPortOrId);
-#else
-    AddressMapping *mapping      = mActiveAddressMappings.FindMatching(aIp6Headers.GetSourceAddress());
-#endif
+    uint16_t srcPortOrId = aIp6Headers.IsIcmp6() ? aIp6Headers.GetIcmpHeader().GetId() : aIp6Headers.GetSourcePort();
+    AddressMapping *mapping;
+
+    for (mapping = mIp6Index[GetIp6Bucket(aIp6Headers.GetSourceAddress(), srcPortOrId)]; mapping != nullptr;
+         mapping = mapping->mIp6HashNext)
+    {
+        if (mapping->Matches(aIp6Headers.GetSourceAddress(), srcPortOrId))
+        {
+            break;
+        }
+    }
 
     // Exit if we found a valid mapping.
     VerifyOrExit(mapping == nullptr);
@@ -474,24 +665,29 @@ Translator::AddressMapping *Translator::FindMapping(const Ip4::Headers &aIp4Head
 {
     uint16_t dstPortOrId =
         aIp4Headers.IsIcmp4() ? aIp4Headers.GetIcmpHeader().GetId() : aIp4Headers.GetDestinationPort();
+    AddressMapping *mapping;
 
-#if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Headers.GetDestinationAddress(), dstPortOrId);
-#else
-    AddressMapping *mapping      = mActiveAddressMappings.FindMatching(aIp4Headers.GetDestinationAddress());
-    OT_UNUSED_VARIABLE(dstPortOrId);
-#endif
+    for (mapping = mIp4Index[GetIp4Bucket(aIp4Headers.GetDestinationAddress(), dstPortOrId)]; mapping != nullptr;
+         mapping = mapping->mIp4HashNext)
+    {
+        if (mapping->Matches(aIp4Headers.GetDestinationAddress(), dstPortOrId))
+        {
+            break;
+        }
+    }
 
     if (mapping != nullptr)
     {
-        mapping->Touch(TimerMilli::GetNow(), aIp4Headers.GetIpProto());
+        TouchMapping(*mapping, aIp4Headers.GetIpProto());
     }
     return mapping;
 }
 
 void Translator::AddressMapping::Touch(TimeMilli aNow, uint8_t aProtocol)
 {
-    if ((aProtocol == Ip6::kProtoIcmp6) || (aProtocol == Ip4::kProtoIcmp))
+    mIsIcmp = (aProtocol == Ip6::kProtoIcmp6) || (aProtocol == Ip4::kProtoIcmp);
+
+    if (mIsIcmp)
     {
         mExpiry = aNow + kAddressMappingIcmpIdleTimeoutMsec;
     }
@@ -593,8 +789,7 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
     }
     numberOfHosts = OT_MIN(numberOfHosts, kAddressMappingPoolSize);
 
-    mAddressMappingPool.FreeAll();
-    mActiveAddressMappings.Clear();
+    ClearMappings();
     mIp4AddressPool.Clear();
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
@@ -622,8 +817,7 @@ exit:
 void Translator::ClearIp4Cidr(void)
 {
     mIp4Cidr.Clear();
-    mAddressMappingPool.FreeAll();
-    mActiveAddressMappings.Clear();
+    ClearMappings();
     mIp4AddressPool.Clear();
 
     UpdateState();
@@ -667,7 +861,7 @@ void Translator::HandleMappingExpirerTimer(void)
 
 void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator)
 {
-    aIterator.mPtr = mActiveAddressMappings.GetHead();
+    aIterator.mPtr = (mIdleQueue.GetHead() != nullptr) ? mIdleQueue.GetHead() : mIcmpQueue.GetHead();
 }
 
 Error Translator::GetNextAddressMapping(AddressMappingIterator &aIterator, otNat64AddressMapping &aMapping)
@@ -679,7 +873,9 @@ Error Translator::GetNextAddressMapping(AddressMappingIterator &aIterator, otNat
     VerifyOrExit(item != nullptr);
 
     item->CopyTo(aMapping, now);
-    aIterator.mPtr = item->GetNext();
+
+    // Iterate over the idle queue, then continue with the ICMP queue.
+    aIterator.mPtr = ((item->mQueueNext == nullptr) && !item->mIsIcmp) ? mIcmpQueue.GetHead() : item->mQueueNext;
     err            = kErrorNone;
 
 exit:
@@ -786,7 +982,7 @@ void Translator::SetEnabled(bool aEnabled)
 
     if (!aEnabled)
     {
-        ReleaseMappings(mActiveAddressMappings);
+        ReleaseAllMappings();
     }
 
     UpdateState();
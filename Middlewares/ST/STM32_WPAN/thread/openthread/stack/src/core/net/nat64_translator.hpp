@@ -37,6 +37,7 @@
 #include "openthread-core-config.h"
 
 #include "common/array.hpp"
+#include "common/hash.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/pool.hpp"
@@ -330,6 +331,15 @@ public:
     Error GetIp6Prefix(Ip6::Prefix &aPrefix);
 
 private:
+    // Active mappings are indexed by two hash tables: one keyed by
+    // the IPv6 source (and source port or ICMP ID, with port
+    // translation) for outgoing datagrams, and one keyed by the
+    // translated port or ICMP ID (or IPv4 address without port
+    // translation) for incoming datagrams. Keying the IPv4 side on
+    // the translated port also makes the uniqueness check during
+    // port allocation a single bucket scan.
+    static constexpr uint16_t kNumHashBuckets = 32;
+
     class AddressMapping : public LinkedListEntry<AddressMapping>
     {
     public:
@@ -342,6 +352,9 @@ private:
         InfoString ToString(void) const;
         void       CopyTo(otNat64AddressMapping &aMapping, TimeMilli aNow) const;
 
+        bool Matches(const Ip6::Address &aIp6, uint16_t aPort) const;
+        bool Matches(const Ip4::Address &aIp4, uint16_t aPort) const;
+
         uint64_t mId; // The unique id for a mapping session.
 
         Ip4::Address mIp4;
@@ -352,33 +365,58 @@ private:
 
         ProtocolCounters mCounters;
 
+        AddressMapping *mIp6HashNext; // Next mapping in the same `mIp6Index` bucket.
+        AddressMapping *mIp4HashNext; // Next mapping in the same `mIp4Index` bucket.
+        AddressMapping *mQueueNext;   // Next (later expiring) mapping in the same `ExpiryQueue`.
+        AddressMapping *mQueuePrev;   // Previous (earlier expiring) mapping in the same `ExpiryQueue`.
+        bool            mIsIcmp;      // Whether last touched by an ICMP datagram (selects the `ExpiryQueue`).
+
     private:
-        bool Matches(const Ip4::Address &aIp4) const { return mIp4 == aIp4; }
-        bool Matches(const Ip6::Address &aIp6) const { return mIp6 == aIp6; }
-        bool Matches(const uint16_t aPort) const { return mTranslatedPortOrId == aPort; }
-        bool Matches(const TimeMilli aNow) const { return mExpiry < aNow; }
+        AddressMapping *mNext; // Used by `mAddressMappingPool` free list.
+    };
 
-        bool Matches(const Ip6::Address &aIp6, const uint16_t aPort) const
-        {
-            return ((mIp6 == aIp6) && (mSrcPortOrId == aPort));
-        }
-        bool Matches(const Ip4::Address &aIp4, const uint16_t aPort) const
+    class ExpiryQueue
+    {
+    public:
+        // Mappings sharing the same idle timeout, in last-use order.
+        // Since the timeout is the same for all of them, the queue
+        // is also sorted by `mExpiry` with the earliest at the head.
+
+        ExpiryQueue(void)
+            : mHead(nullptr)
+            , mTail(nullptr)
         {
-            return ((mIp4 == aIp4) && (mTranslatedPortOrId == aPort));
         }
 
-        AddressMapping *mNext;
+        void            Clear(void) { mHead = mTail = nullptr; }
+        AddressMapping *GetHead(void) const { return mHead; }
+        void            Append(AddressMapping &aMapping);
+        void            Remove(AddressMapping &aMapping);
+
+    private:
+        AddressMapping *mHead;
+        AddressMapping *mTail;
     };
 
     Error TranslateIcmp4(Message &aMessage, uint16_t aOriginalId);
     Error TranslateIcmp6(Message &aMessage, uint16_t aTranslatedId);
 
 #if OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE
-    uint16_t AllocateSourcePort(uint16_t aSrcPort);
+    uint16_t        AllocateSourcePort(uint16_t aSrcPort);
+    bool            IsTranslatedPortInUse(uint16_t aPort) const;
+    static uint16_t GetPortBucket(uint16_t aPort) { return aPort % kNumHashBuckets; }
 #endif
-    uint16_t        ReleaseMappings(LinkedList<AddressMapping> &aMappings);
+    static uint16_t GetIp6Bucket(const Ip6::Address &aIp6, uint16_t aPort);
+    static uint16_t GetIp4Bucket(const Ip4::Address &aIp4, uint16_t aPort);
+    ExpiryQueue    &GetExpiryQueue(const AddressMapping &aMapping);
+    void            AddToIndex(AddressMapping &aMapping);
+    void            RemoveFromIndex(AddressMapping &aMapping);
+    void            ClearMappings(void);
+    void            TouchMapping(AddressMapping &aMapping, uint8_t aProtocol);
+    void            ReleaseAllMappings(void);
     void            ReleaseMapping(AddressMapping &aMapping);
     uint16_t        ReleaseExpiredMappings(void);
+    uint16_t        ReleaseExpiredMappings(ExpiryQueue &aQueue, TimeMilli aNow);
     AddressMapping *AllocateMapping(const Ip6::Headers &aIp6Headers);
     AddressMapping *FindOrAllocateMapping(const Ip6::Headers &aIp6Headers);
     AddressMapping *FindMapping(const Ip4::Headers &aIp4Headers);
@@ -395,7 +433,10 @@ private:
 
     Array<Ip4::Address, kAddressMappingPoolSize>  mIp4AddressPool;
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
-    LinkedList<AddressMapping>                    mActiveAddressMappings;
+    ExpiryQueue                                   mIdleQueue;
+    ExpiryQueue                                   mIcmpQueue;
+    AddressMapping                               *mIp6Index[kNumHashBuckets];
+    AddressMapping                               *mIp4Index[kNumHashBuckets];
 
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
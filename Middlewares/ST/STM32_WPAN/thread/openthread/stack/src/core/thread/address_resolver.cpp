@@ -33,6 +33,7 @@
 
 #include "address_resolver.hpp"
 
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -43,10 +44,13 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+    , mQueryPacingTimer(aInstance)
+    , mQueryTokens(kAddressQueryBurst)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    ClearAllBytes(mHashHeads);
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -71,6 +75,13 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearAllBytes(mHashHeads);
+
+    // The pending queries went with their entries, the next ones
+    // start from a full burst allowance.
+    mQueryPacingTimer.Stop();
+    mQueryTokens = kAddressQueryBurst;
 }
 
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -195,20 +206,81 @@ AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address
                                                              CacheEntryList    *&aList,
                                                              CacheEntry        *&aPrevEntry)
 {
-    CacheEntry     *entry   = nullptr;
+    // The EID hash index gives the matching entry (if any) without
+    // comparing `aEid` against every entry. The list containing the
+    // entry and its previous entry are then determined by a pointer
+    // walk.
+
+    CacheEntry     *entry   = FindInIndex(aEid);
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
 
+    VerifyOrExit(entry != nullptr);
+
     for (CacheEntryList *list : lists)
     {
         aList = list;
-        entry = aList->FindMatchingWithPrev(aPrevEntry, aEid);
-        VerifyOrExit(entry == nullptr);
+        VerifyOrExit(aList->Find(*entry, aPrevEntry) != kErrorNone);
     }
 
+    entry = nullptr;
+
 exit:
     return entry;
 }
 
+uint8_t AddressResolver::GetHashBucket(const Ip6::Address &aEid)
+{
+    return static_cast<uint8_t>(HashObject(aEid.GetIid()) % kNumHashBuckets);
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindInIndex(const Ip6::Address &aEid)
+{
+    CacheEntry *entry;
+
+    for (entry = mHashHeads[GetHashBucket(aEid)]; entry != nullptr; entry = entry->GetHashNext())
+    {
+        if (entry->Matches(aEid))
+        {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+void AddressResolver::AddToIndex(CacheEntry &aEntry)
+{
+    uint8_t bucket = GetHashBucket(aEntry.GetTarget());
+
+    aEntry.SetHashNext(mHashHeads[bucket]);
+    mHashHeads[bucket] = &aEntry;
+}
+
+void AddressResolver::RemoveFromIndex(CacheEntry &aEntry)
+{
+    uint8_t     bucket = GetHashBucket(aEntry.GetTarget());
+    CacheEntry *prev   = nullptr;
+
+    for (CacheEntry *entry = mHashHeads[bucket]; entry != nullptr; prev = entry, entry = entry->GetHashNext())
+    {
+        if (entry != &aEntry)
+        {
+            continue;
+        }
+
+        if (prev == nullptr)
+        {
+            mHashHeads[bucket] = entry->GetHashNext();
+        }
+        else
+        {
+            prev->SetHashNext(entry->GetHashNext());
+        }
+
+        break;
+    }
+}
+
 void AddressResolver::RemoveEntryForAddress(const Ip6::Address &aEid) { Remove(aEid, kReasonRemovingEid); }
 
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
@@ -315,6 +387,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -404,6 +477,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid, uint16_t
 
     entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
+    AddToIndex(*entry);
 
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
     {
@@ -449,11 +523,10 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry &entry : mQueryList)
     {
-        IgnoreError(SendAddressQuery(entry.GetTarget()));
-
-        entry.SetTimeout(kAddressQueryTimeout);
         entry.SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry.SetCanEvict(false);
+
+        IgnoreError(StartAddressQuery(entry));
     }
 }
 
@@ -500,6 +573,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
 
         if (!isFresh && (Get<RouterTable>().GetNextHop(entry->GetRloc16()) == Mle::kInvalidRloc16))
         {
+            RemoveFromIndex(*entry);
             mCacheEntryPool.Free(*entry);
             entry = nullptr;
         }
@@ -535,6 +609,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
         entry->SetRloc16(Mle::kInvalidRloc16);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
+        AddToIndex(*entry);
         list = nullptr;
     }
 
@@ -561,10 +636,14 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16, bool
         mQueryRetryList.PopAfter(prev);
     }
 
-    entry->SetTimeout(kAddressQueryTimeout);
+    error = StartAddressQuery(*entry);
 
-    error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    if (error != kErrorNone)
+    {
+        RemoveFromIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
@@ -609,6 +688,72 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
 
+Error AddressResolver::StartAddressQuery(CacheEntry &aEntry)
+{
+    // Sends an Address Query for `aEntry` unless the burst allowance
+    // is used up, in which case the entry is marked as pending and
+    // the query is sent later from `HandleQueryPacingTimer()`. The
+    // query timeout of a pending entry starts when it is sent.
+
+    Error error = kErrorNone;
+
+    aEntry.SetTimeout(kAddressQueryTimeout);
+    aEntry.SetQueryPending(mQueryTokens == 0);
+
+    VerifyOrExit(!aEntry.IsQueryPending(), Get<TimeTicker>().RegisterReceiver(TimeTicker::kAddressResolver));
+
+    SuccessOrExit(error = SendAddressQuery(aEntry.GetTarget()));
+
+    mQueryTokens--;
+
+    if (!mQueryPacingTimer.IsRunning())
+    {
+        mQueryPacingTimer.Start(kAddressQueryPacingInterval);
+    }
+
+exit:
+    return error;
+}
+
+void AddressResolver::HandleQueryPacingTimer(void)
+{
+    CacheEntry *pending = nullptr;
+
+    if (mQueryTokens < kAddressQueryBurst)
+    {
+        mQueryTokens++;
+    }
+
+    while (mQueryTokens > 0)
+    {
+        // Send the query of the oldest pending entry first. New
+        // entries are pushed at the head of `mQueryList`.
+
+        pending = nullptr;
+
+        for (CacheEntry &entry : mQueryList)
+        {
+            if (entry.IsQueryPending())
+            {
+                pending = &entry;
+            }
+        }
+
+        VerifyOrExit(pending != nullptr);
+        SuccessOrExit(SendAddressQuery(pending->GetTarget()));
+
+        pending->SetQueryPending(false);
+        pending->SetTimeout(kAddressQueryTimeout);
+        mQueryTokens--;
+    }
+
+exit:
+    if ((mQueryTokens < kAddressQueryBurst) || (pending != nullptr))
+    {
+        mQueryPacingTimer.Start(kAddressQueryPacingInterval);
+    }
+}
+
 Error AddressResolver::SendAddressQuery(const Ip6::Address &aEid)
 {
     Error            error;
@@ -996,6 +1141,13 @@ void AddressResolver::HandleTimeTick(void)
             OT_ASSERT(!entry->IsTimeoutZero());
 
             continueRxingTicks = true;
+
+            if (entry->IsQueryPending())
+            {
+                // Address Query is not sent yet (paced).
+                prev = entry;
+                continue;
+            }
             entry->DecrementTimeout();
 
             if (entry->IsTimeoutZero())
@@ -1145,6 +1297,7 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
     InstanceLocatorInit::Init(aInstance);
     mNextIndex        = kNoNextIndex;
     mFreshnessTimeout = 0;
+    mHashNextIndex    = kNoNextIndex;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1166,6 +1319,21 @@ exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetHashNext(void)
+{
+    return (mHashNextIndex == kNoNextIndex) ? nullptr
+                                            : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mHashNextIndex);
+}
+
+void AddressResolver::CacheEntry::SetHashNext(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mHashNextIndex = kNoNextIndex);
+    mHashNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -241,6 +241,13 @@ private:
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
 
+    static constexpr uint8_t  kAddressQueryBurst          = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST;
+    static constexpr uint32_t kAddressQueryPacingInterval = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL; // msec
+
+    static_assert(kAddressQueryBurst > 0, "OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST must be non-zero");
+
+    static constexpr uint8_t kNumHashBuckets = 16; // Number of buckets in the EID hash index of cache entries.
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -250,6 +257,9 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+        CacheEntry *GetHashNext(void);
+        void        SetHashNext(CacheEntry *aEntry);
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -282,6 +292,9 @@ private:
         bool IsInRampDown(void) const { return mInfo.mOther.mRampDown; }
         void SetRampDown(bool aRampDown) { mInfo.mOther.mRampDown = aRampDown; }
 
+        bool IsQueryPending(void) const { return mInfo.mOther.mQueryPending; }
+        void SetQueryPending(bool aQueryPending) { mInfo.mOther.mQueryPending = aQueryPending; }
+
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
     private:
@@ -295,6 +308,7 @@ private:
         uint16_t     mRloc16;
         uint16_t     mNextIndex : 14;
         uint8_t      mFreshnessTimeout : 2;
+        uint16_t     mHashNextIndex;
 
         union
         {
@@ -310,6 +324,7 @@ private:
                 uint16_t mRetryDelay;
                 bool     mCanEvict;
                 bool     mRampDown;
+                bool     mQueryPending;
             } mOther;
 
         } mInfo;
@@ -349,7 +364,14 @@ private:
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, uint16_t aRloc16);
+    Error       StartAddressQuery(CacheEntry &aEntry);
     Error       SendAddressQuery(const Ip6::Address &aEid);
+    void        HandleQueryPacingTimer(void);
+    void        AddToIndex(CacheEntry &aEntry);
+    void        RemoveFromIndex(CacheEntry &aEntry);
+    CacheEntry *FindInIndex(const Ip6::Address &aEid);
+
+    static uint8_t GetHashBucket(const Ip6::Address &aEid);
 #if OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
     Error ResolveUsingNetDataServices(const Ip6::Address &aEid, uint16_t &aRloc16);
 #endif
@@ -379,7 +401,12 @@ private:
 
     static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
 
+    using QueryPacingTimer = TimerMilliIn<AddressResolver, &AddressResolver::HandleQueryPacingTimer>;
+
     CacheEntryPool     mCacheEntryPool;
+    CacheEntry        *mHashHeads[kNumHashBuckets];
+    QueryPacingTimer   mQueryPacingTimer;
+    uint8_t            mQueryTokens;
     CacheEntryList     mCachedList;
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
@@ -125,6 +125,11 @@ void Child::Clear(void)
 
 void Child::ClearIp6Addresses(void)
 {
+    for (const Ip6AddrEntry &entry : mIp6Addresses)
+    {
+        Get<ChildTable>().HandleIp6AddressRemoved(entry);
+    }
+
     mMeshLocalIid.Clear();
     mIp6Addresses.Clear();
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
@@ -196,7 +201,8 @@ Error Child::AddIp6Address(const Ip6::Address &aAddress)
     }
 
     VerifyOrExit(!mIp6Addresses.ContainsMatching(aAddress), error = kErrorAlready);
-    error = mIp6Addresses.PushBack(static_cast<const Ip6AddrEntry &>(aAddress));
+    SuccessOrExit(error = mIp6Addresses.PushBack(static_cast<const Ip6AddrEntry &>(aAddress)));
+    Get<ChildTable>().HandleIp6AddressAdded(aAddress);
 
 exit:
     return error;
@@ -238,6 +244,7 @@ Error Child::RemoveIp6Address(const Ip6::Address &aAddress)
     }
 #endif
 
+    Get<ChildTable>().HandleIp6AddressRemoved(*entry);
     mIp6Addresses.Remove(*entry);
     error = kErrorNone;
 
@@ -75,10 +75,15 @@ ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+    mRloc16Index.Clear();
+    mExtAddressIndex.Clear();
+    ClearAllBytes(mMulticastCounts);
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
         child.Clear();
+        UpdateIndexes(child);
     }
 }
 
@@ -86,10 +91,17 @@ void ChildTable::Clear(void)
 {
     for (Child &child : mChildren)
     {
-        child.Clear();
+        ClearChild(child);
     }
 }
 
+void ChildTable::ClearChild(Child &aChild)
+{
+    aChild.ClearIp6Addresses();
+    aChild.Clear();
+    UpdateIndexes(aChild);
+}
+
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
 {
     Child *child = nullptr;
@@ -106,7 +118,7 @@ Child *ChildTable::GetNewChild(void)
     Child *child = FindChild(Child::AddressMatcher(Child::kInStateInvalid));
 
     VerifyOrExit(child != nullptr);
-    child->Clear();
+    ClearChild(*child);
 
 exit:
     return child;
@@ -114,7 +126,21 @@ exit:
 
 const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
-    const Child *child = mChildren;
+    const Child *child;
+
+    if (aMatcher.GetExtAddress() != nullptr)
+    {
+        child = FindChildInIndex(mExtAddressIndex, HashExtAddress(*aMatcher.GetExtAddress()), aMatcher);
+        ExitNow();
+    }
+
+    if (aMatcher.GetShortAddress() != Mac::kShortAddrInvalid)
+    {
+        child = FindChildInIndex(mRloc16Index, aMatcher.GetShortAddress(), aMatcher);
+        ExitNow();
+    }
+
+    child = mChildren;
 
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
@@ -130,6 +156,28 @@ exit:
     return child;
 }
 
+const Child *ChildTable::FindChildInIndex(const Index                 &aIndex,
+                                          uint32_t                     aHash,
+                                          const Child::AddressMatcher &aMatcher) const
+{
+    // Walks the index chain and returns the matching entry with the
+    // lowest table index, i.e., the same entry a linear scan of the
+    // table would return.
+
+    const Child *child = nullptr;
+
+    for (uint16_t index = aIndex.GetFirst(aHash); index != kInvalidIndex; index = aIndex.GetNext(index))
+    {
+        if ((index < mMaxChildrenAllowed) && mChildren[index].Matches(aMatcher) &&
+            ((child == nullptr) || (index < GetChildIndex(*child))))
+        {
+            child = &mChildren[index];
+        }
+    }
+
+    return child;
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
     return FindChild(Child::AddressMatcher(aRloc16, aFilter));
@@ -235,7 +283,7 @@ void ChildTable::Restore(void)
             foundDuplicate = true;
         }
 
-        child->Clear();
+        ClearChild(*child);
 
         child->SetExtAddress(childInfo.GetExtAddress());
         child->GetLinkInfo().Clear();
@@ -334,6 +382,19 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
     bool         hasChild = false;
     const Child *child    = &mChildren[0];
 
+    // Multicast subscriptions of all children are tracked in a
+    // counting filter, so the common case of no child subscribed to
+    // the group is answered without walking the table. Registered
+    // unicast addresses are not indexed: both callers in `Ip6` only
+    // pass multicast destinations larger than realm-local scope, so
+    // a unicast index would add bookkeeping to every address
+    // registration without serving any lookup.
+
+    if (aIp6Address.IsMulticast())
+    {
+        VerifyOrExit(mMulticastCounts[GetMulticastBucket(aIp6Address)] != 0);
+    }
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->IsStateValidOrRestoring() && !child->IsRxOnWhenIdle() && child->HasIp6Address(aIp6Address))
@@ -343,9 +404,98 @@ bool ChildTable::HasSleepyChildWithAddress(const Ip6::Address &aIp6Address) cons
         }
     }
 
+exit:
     return hasChild;
 }
 
+void ChildTable::UpdateIndexes(const Child &aChild)
+{
+    uint16_t index = GetChildIndex(aChild);
+
+    mRloc16Index.Remove(index);
+    mRloc16Index.Add(index, aChild.GetRloc16());
+
+    mExtAddressIndex.Remove(index);
+    mExtAddressIndex.Add(index, HashExtAddress(aChild.GetExtAddress()));
+}
+
+void ChildTable::HandleNeighborAddressChanged(const Neighbor &aNeighbor)
+{
+    VerifyOrExit(Contains(aNeighbor));
+    UpdateIndexes(static_cast<const Child &>(aNeighbor));
+
+exit:
+    return;
+}
+
+void ChildTable::HandleIp6AddressAdded(const Ip6::Address &aAddress)
+{
+    VerifyOrExit(aAddress.IsMulticast());
+    mMulticastCounts[GetMulticastBucket(aAddress)]++;
+
+exit:
+    return;
+}
+
+void ChildTable::HandleIp6AddressRemoved(const Ip6::Address &aAddress)
+{
+    uint16_t bucket;
+
+    VerifyOrExit(aAddress.IsMulticast());
+
+    bucket = GetMulticastBucket(aAddress);
+    VerifyOrExit(mMulticastCounts[bucket] != 0);
+    mMulticastCounts[bucket]--;
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// ChildTable::Index
+
+void ChildTable::Index::Clear(void)
+{
+    for (uint16_t &head : mHeads)
+    {
+        head = kInvalidIndex;
+    }
+
+    for (uint16_t index = 0; index < kMaxChildren; index++)
+    {
+        mNext[index]    = kInvalidIndex;
+        mBuckets[index] = kInvalidIndex;
+    }
+}
+
+void ChildTable::Index::Add(uint16_t aChildIndex, uint32_t aHash)
+{
+    uint16_t bucket = static_cast<uint16_t>(aHash % kNumIndexBuckets);
+
+    mNext[aChildIndex]    = mHeads[bucket];
+    mHeads[bucket]        = aChildIndex;
+    mBuckets[aChildIndex] = bucket;
+}
+
+void ChildTable::Index::Remove(uint16_t aChildIndex)
+{
+    uint16_t *link;
+
+    VerifyOrExit(mBuckets[aChildIndex] != kInvalidIndex);
+
+    for (link = &mHeads[mBuckets[aChildIndex]]; *link != aChildIndex; link = &mNext[*link])
+    {
+        OT_ASSERT(*link != kInvalidIndex);
+    }
+
+    *link                 = mNext[aChildIndex];
+    mNext[aChildIndex]    = kInvalidIndex;
+    mBuckets[aChildIndex] = kInvalidIndex;
+
+exit:
+    return;
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_FTD
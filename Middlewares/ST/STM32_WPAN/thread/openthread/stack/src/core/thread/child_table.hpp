@@ -39,6 +39,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/const_cast.hpp"
+#include "common/hash.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -52,6 +53,8 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class Neighbor;
+    friend class Child;
     class IteratorBuilder;
 
 public:
@@ -309,6 +312,34 @@ public:
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
+    // Number of hash buckets in the RLOC16 and Extended Address
+    // indexes, and in the multicast subscription filter.
+    static constexpr uint16_t kNumIndexBuckets     = kMaxChildren;
+    static constexpr uint16_t kNumMulticastBuckets = 2 * kMaxChildren;
+
+    static constexpr uint16_t kInvalidIndex = 0xffff;
+
+    // Hash index from a key (RLOC16 or Extended Address) to the
+    // chain of `Child` entries (by table index) with a matching key
+    // hash. Every entry in the table (including invalid ones) is
+    // kept in the index under its current key so that both hits
+    // and misses can be resolved by walking a single chain.
+
+    class Index
+    {
+    public:
+        void     Clear(void);
+        void     Add(uint16_t aChildIndex, uint32_t aHash);
+        void     Remove(uint16_t aChildIndex);
+        uint16_t GetFirst(uint32_t aHash) const { return mHeads[aHash % kNumIndexBuckets]; }
+        uint16_t GetNext(uint16_t aChildIndex) const { return mNext[aChildIndex]; }
+
+    private:
+        uint16_t mHeads[kNumIndexBuckets];
+        uint16_t mNext[kMaxChildren];
+        uint16_t mBuckets[kMaxChildren];
+    };
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -328,9 +359,24 @@ private:
     Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    const Child *FindChildInIndex(const Index &aIndex, uint32_t aHash, const Child::AddressMatcher &aMatcher) const;
+    void         ClearChild(Child &aChild);
+    void         UpdateIndexes(const Child &aChild);
+    void         HandleNeighborAddressChanged(const Neighbor &aNeighbor);
+    void         HandleIp6AddressAdded(const Ip6::Address &aAddress);
+    void         HandleIp6AddressRemoved(const Ip6::Address &aAddress);
     void         RefreshStoredChildren(void);
 
+    static uint32_t HashExtAddress(const Mac::ExtAddress &aExtAddress) { return HashObject(aExtAddress); }
+    static uint16_t GetMulticastBucket(const Ip6::Address &aAddress)
+    {
+        return static_cast<uint16_t>(HashObject(aAddress) % kNumMulticastBuckets);
+    }
+
     uint16_t mMaxChildrenAllowed;
+    Index    mRloc16Index;
+    Index    mExtAddressIndex;
+    uint16_t mMulticastCounts[kNumMulticastBuckets];
     Child    mChildren[kMaxChildren];
 };
 
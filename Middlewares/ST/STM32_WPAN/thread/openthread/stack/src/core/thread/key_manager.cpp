@@ -272,6 +272,7 @@ void KeyManager::SetNetworkKey(const NetworkKey &aNetworkKey)
     Get<Notifier>().Signal(kEventNetworkKeyChanged);
 #else
     SuccessOrExit(Get<Notifier>().Update(mNetworkKey, aNetworkKey, kEventNetworkKeyChanged));
+    mKeyCache.Clear();
 #endif
 
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
@@ -305,6 +306,27 @@ void KeyManager::ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const
     hmac.Finish(aHashKeys.mHash);
 }
 
+void KeyManager::GetHashKeys(uint32_t aKeySequence, HashKeys &aHashKeys)
+{
+#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    // The derived keys are not kept in RAM when the network key is
+    // held by the platform key storage.
+    ComputeKeys(aKeySequence, aHashKeys);
+#else
+    const HashKeys *hashKeys = mKeyCache.Find(aKeySequence);
+
+    if (hashKeys == nullptr)
+    {
+        HashKeys &newHashKeys = mKeyCache.Replace(aKeySequence, mKeySequence);
+
+        ComputeKeys(aKeySequence, newHashKeys);
+        hashKeys = &newHashKeys;
+    }
+
+    aHashKeys = *hashKeys;
+#endif
+}
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const
 {
@@ -330,7 +352,7 @@ void KeyManager::UpdateKeyMaterial(void)
 {
     HashKeys hashKeys;
 
-    ComputeKeys(mKeySequence, hashKeys);
+    GetHashKeys(mKeySequence, hashKeys);
 
     mMleKey.SetFrom(hashKeys.GetMleKey());
 
@@ -342,10 +364,10 @@ void KeyManager::UpdateKeyMaterial(void)
 
         curKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
 
-        ComputeKeys(mKeySequence - 1, hashKeys);
+        GetHashKeys(mKeySequence - 1, hashKeys);
         prevKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
 
-        ComputeKeys(mKeySequence + 1, hashKeys);
+        GetHashKeys(mKeySequence + 1, hashKeys);
         nextKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
 
         Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
@@ -419,7 +441,7 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
     HashKeys hashKeys;
 
-    ComputeKeys(aKeySequence, hashKeys);
+    GetHashKeys(aKeySequence, hashKeys);
     mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
 
     return mTemporaryMleKey;
@@ -430,7 +452,7 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
     HashKeys hashKeys;
 
-    ComputeKeys(aKeySequence, hashKeys);
+    GetHashKeys(aKeySequence, hashKeys);
     mTemporaryMacKey.SetFrom(hashKeys.GetMacKey());
 
     return mTemporaryMacKey;
@@ -700,4 +722,70 @@ void KeyManager::DestroyPersistentKeys(void) { Get<Crypto::Storage::KeyRefManage
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
 
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// KeyManager::KeyCache
+
+void KeyManager::KeyCache::Clear(void)
+{
+    // Also wipes the cached key material.
+
+    ClearAllBytes(mEntries);
+    mUseCounter = 0;
+}
+
+const KeyManager::HashKeys *KeyManager::KeyCache::Find(uint32_t aKeySequence)
+{
+    const HashKeys *hashKeys = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mValid && (entry.mKeySequence == aKeySequence))
+        {
+            entry.mLastUse = ++mUseCounter;
+            hashKeys       = &entry.mHashKeys;
+            break;
+        }
+    }
+
+    return hashKeys;
+}
+
+KeyManager::HashKeys &KeyManager::KeyCache::Replace(uint32_t aKeySequence, uint32_t aCurrentKeySequence)
+{
+    Entry *victim = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.mValid)
+        {
+            victim = &entry;
+            break;
+        }
+
+        if (IsNeighbor(entry.mKeySequence, aCurrentKeySequence))
+        {
+            continue;
+        }
+
+        if ((victim == nullptr) || (entry.mLastUse < victim->mLastUse))
+        {
+            victim = &entry;
+        }
+    }
+
+    // At most three entries are neighbors of the current key
+    // sequence and `kSize` is at least four.
+    OT_ASSERT(victim != nullptr);
+
+    victim->mKeySequence = aKeySequence;
+    victim->mLastUse     = ++mUseCounter;
+    victim->mValid       = true;
+
+    return victim->mHashKeys;
+}
+
+#endif // !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+
 } // namespace ot
@@ -571,7 +571,46 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    class KeyCache
+    {
+        // Caches the derived MLE/MAC keys (`HashKeys`) per key
+        // sequence. The entries for the current key sequence and its
+        // two neighbors are never replaced; the other entries are
+        // replaced in least recently used order.
+
+    public:
+        KeyCache(void) { Clear(); }
+
+        void            Clear(void);
+        const HashKeys *Find(uint32_t aKeySequence);
+        HashKeys       &Replace(uint32_t aKeySequence, uint32_t aCurrentKeySequence);
+
+    private:
+        static constexpr uint8_t kSize = OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE;
+
+        static_assert(kSize >= 4, "OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE must be at least 4");
+
+        struct Entry
+        {
+            HashKeys mHashKeys;
+            uint32_t mKeySequence;
+            uint32_t mLastUse;
+            bool     mValid;
+        };
+
+        static bool IsNeighbor(uint32_t aKeySequence, uint32_t aCurrentKeySequence)
+        {
+            return (aKeySequence - aCurrentKeySequence + 1) <= 2;
+        }
+
+        Entry    mEntries[kSize];
+        uint32_t mUseCounter;
+    };
+#endif
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
+    void GetHashKeys(uint32_t aKeySequence, HashKeys &aHashKeys);
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const;
@@ -606,6 +645,9 @@ private:
     uint32_t         mKeySequence;
     Mle::KeyMaterial mMleKey;
     Mle::KeyMaterial mTemporaryMleKey;
+#if !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    KeyCache mKeyCache;
+#endif
 
 #if OPENTHREAD_CONFIG_WAKEUP_END_DEVICE_ENABLE
     Mle::KeyMaterial mTemporaryMacKey;
@@ -33,6 +33,7 @@
 
 #include "mesh_forwarder.hpp"
 
+#include "common/hash.hpp"
 #include "instance/instance.hpp"
 #include "utils/static_counter.hpp"
 
@@ -114,6 +115,7 @@ void MeshForwarder::Stop(void)
 
     mSendQueue.DequeueAndFreeAll();
     mReassemblyList.DequeueAndFreeAll();
+    mReassemblyTable.Clear();
 
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
@@ -471,6 +473,154 @@ void MeshForwarder::TxQueueStats::UpdateFor(const Message &aMessage)
 }
 #endif
 
+//---------------------------------------------------------------------------------------------------------------------
+// ReassemblyTable
+
+void MeshForwarder::ReassemblyTable::Clear(void)
+{
+    for (uint8_t &head : mHeads)
+    {
+        head = kInvalidIndex;
+    }
+
+    for (Entry &entry : mEntries)
+    {
+        entry.mMessage = nullptr;
+    }
+
+    mNumEntries = 0;
+    mNumBuffers = 0;
+}
+
+uint8_t MeshForwarder::ReassemblyTable::GetBucket(const Mac::Address &aSource, uint16_t aDatagramTag)
+{
+    uint32_t hash = HashObject(aDatagramTag);
+
+    if (aSource.IsShort())
+    {
+        uint16_t shortAddress = aSource.GetShort();
+
+        hash = HashObject(shortAddress, hash);
+    }
+    else if (aSource.IsExtended())
+    {
+        hash = HashObject(aSource.GetExtended(), hash);
+    }
+
+    return static_cast<uint8_t>(hash % kNumBuckets);
+}
+
+void MeshForwarder::ReassemblyTable::Add(Message &aMessage, const Mac::Address &aSource)
+{
+    uint8_t bucket = GetBucket(aSource, static_cast<uint16_t>(aMessage.GetDatagramTag()));
+
+    for (uint8_t index = 0; index < kMaxEntries; index++)
+    {
+        Entry &entry = mEntries[index];
+
+        if (entry.mMessage != nullptr)
+        {
+            continue;
+        }
+
+        entry.mMessage    = &aMessage;
+        entry.mSource     = aSource;
+        entry.mNumBuffers = aMessage.GetBufferCount();
+        entry.mNext       = mHeads[bucket];
+        mHeads[bucket]    = index;
+
+        mNumEntries++;
+        mNumBuffers += entry.mNumBuffers;
+        break;
+    }
+}
+
+void MeshForwarder::ReassemblyTable::Remove(const Message &aMessage)
+{
+    for (uint8_t index = 0; index < kMaxEntries; index++)
+    {
+        Entry   &entry = mEntries[index];
+        uint8_t *link;
+
+        if (entry.mMessage != &aMessage)
+        {
+            continue;
+        }
+
+        link = &mHeads[GetBucket(entry.mSource, static_cast<uint16_t>(aMessage.GetDatagramTag()))];
+
+        while ((*link != index) && (*link != kInvalidIndex))
+        {
+            link = &mEntries[*link].mNext;
+        }
+
+        if (*link == index)
+        {
+            *link = entry.mNext;
+        }
+
+        entry.mMessage = nullptr;
+
+        mNumEntries--;
+        mNumBuffers -= entry.mNumBuffers;
+        break;
+    }
+}
+
+Message *MeshForwarder::ReassemblyTable::Find(const Mac::Address &aSource, uint16_t aDatagramTag) const
+{
+    Message *message = nullptr;
+
+    for (uint8_t index = mHeads[GetBucket(aSource, aDatagramTag)]; index != kInvalidIndex;
+         index         = mEntries[index].mNext)
+    {
+        const Entry &entry = mEntries[index];
+
+        if ((entry.mMessage->GetDatagramTag() == aDatagramTag) && (entry.mSource == aSource))
+        {
+            message = entry.mMessage;
+            break;
+        }
+    }
+
+    return message;
+}
+
+Message *MeshForwarder::ReassemblyTable::FindOldest(const Mac::Address *aSource) const
+{
+    Message *oldest = nullptr;
+
+    for (const Entry &entry : mEntries)
+    {
+        if ((entry.mMessage == nullptr) || ((aSource != nullptr) && !(entry.mSource == *aSource)))
+        {
+            continue;
+        }
+
+        if ((oldest == nullptr) || (entry.mMessage->GetTimestamp() < oldest->GetTimestamp()))
+        {
+            oldest = entry.mMessage;
+        }
+    }
+
+    return oldest;
+}
+
+uint8_t MeshForwarder::ReassemblyTable::GetNumEntriesFrom(const Mac::Address &aSource) const
+{
+    uint8_t count = 0;
+
+    for (const Entry &entry : mEntries)
+    {
+        if ((entry.mMessage != nullptr) && (entry.mSource == aSource))
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
 void MeshForwarder::ScheduleTransmissionTask(void)
 {
     VerifyOrExit(!mSendBusy && !mTxPaused);
@@ -498,19 +648,18 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
     Message *curMessage, *nextMessage;
     Error    error = kErrorNone;
 
-    for (curMessage = mSendQueue.GetHead(); curMessage; curMessage = nextMessage)
+    // Only the messages in the "ready" view of the send queue are
+    // visited, i.e., the ones marked for direct transmission which
+    // are not waiting for an address query resolution.
+
+    for (curMessage = mSendQueue.GetHeadReady(); curMessage; curMessage = nextMessage)
     {
         // We set the `nextMessage` here but it can be updated again
         // after the `switch(message.GetType())` since it may be
         // evicted during message processing (e.g., from the call to
         // `UpdateIp6Route()` due to Address Solicit).
 
-        nextMessage = curMessage->GetNext();
-
-        if (!curMessage->IsDirectTransmission() || curMessage->IsResolvingAddress())
-        {
-            continue;
-        }
+        nextMessage = mSendQueue.GetNextReady(*curMessage);
 
 #if OPENTHREAD_CONFIG_DELAY_AWARE_QUEUE_MANAGEMENT_ENABLE
         if (UpdateEcnOrDrop(*curMessage, /* aPreparingToSend */ true) == kErrorDrop)
@@ -548,7 +697,7 @@ Message *MeshForwarder::PrepareNextDirectTransmission(void)
         curMessage->SetDoNotEvict(false);
 
         // the next message may have been evicted during processing (e.g. due to Address Solicit)
-        nextMessage = curMessage->GetNext();
+        nextMessage = mSendQueue.GetNextReady(*curMessage);
 
         switch (error)
         {
@@ -1446,9 +1595,6 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
 
         SuccessOrExit(error = FrameToMessage(aRxInfo, datagramSize, message));
 
-        VerifyOrExit(datagramSize >= message->GetLength(), error = kErrorParse);
-        SuccessOrExit(error = message->SetLength(datagramSize));
-
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
         message->SetTimestampToNow();
         message->UpdateLinkInfoFrom(aRxInfo.mLinkInfo);
@@ -1468,24 +1614,22 @@ void MeshForwarder::HandleFragment(RxInfo &aRxInfo)
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
+        SuccessOrExit(error = AddToReassemblyList(*message, aRxInfo.GetSrcAddr()));
 
         Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
     }
     else // Received frame is a "next fragment".
     {
-        for (Message &msg : mReassemblyList)
+        message = mReassemblyTable.Find(aRxInfo.GetSrcAddr(), fragmentHeader.GetDatagramTag());
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if ((message != nullptr) &&
+            !(message->GetLength() == fragmentHeader.GetDatagramSize() &&
+              message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
+              message->GetOffset() + aRxInfo.mFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
+              message->IsLinkSecurityEnabled() == aRxInfo.IsLinkSecurityEnabled()))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (msg.GetLength() == fragmentHeader.GetDatagramSize() &&
-                msg.GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                msg.GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                msg.GetOffset() + aRxInfo.mFrameData.GetLength() <= fragmentHeader.GetDatagramSize() &&
-                msg.IsLinkSecurityEnabled() == aRxInfo.IsLinkSecurityEnabled())
-            {
-                message = &msg;
-                break;
-            }
+            message = nullptr;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
@@ -1514,7 +1658,7 @@ exit:
     {
         if (message->GetOffset() >= message->GetLength())
         {
-            mReassemblyList.Dequeue(*message);
+            RemoveFromReassemblyList(*message);
             IgnoreError(HandleDatagram(*message, aRxInfo.GetSrcAddr()));
         }
     }
@@ -1533,6 +1677,61 @@ void MeshForwarder::ClearReassemblyList(void)
         mCounters.UpdateOnDrop(message);
         mReassemblyList.DequeueAndFree(message);
     }
+
+    mReassemblyTable.Clear();
+}
+
+Error MeshForwarder::AddToReassemblyList(Message &aMessage, const Mac::Address &aSource)
+{
+    Error    error      = kErrorNone;
+    uint16_t numBuffers = aMessage.GetBufferCount();
+
+    VerifyOrExit(numBuffers <= ReassemblyTable::kMaxBuffers, error = kErrorNoBufs);
+
+    // A first fragment with the same source and tag as a datagram
+    // still being reassembled is a duplicate (e.g., a retransmission
+    // by the sender). It is dropped so that it cannot restart the
+    // datagram in progress. A stale datagram is removed by the
+    // reassembly timeout.
+
+    VerifyOrExit(mReassemblyTable.Find(aSource, static_cast<uint16_t>(aMessage.GetDatagramTag())) == nullptr,
+                 error = kErrorDuplicated);
+
+    // Bound the number of datagrams a single neighbor can have under
+    // reassembly, then the total number of datagrams and buffers, by
+    // evicting the oldest (least recently updated) datagram.
+
+    while (mReassemblyTable.GetNumEntriesFrom(aSource) >= ReassemblyTable::kMaxEntriesPerSource)
+    {
+        EvictFromReassemblyList(*mReassemblyTable.FindOldest(&aSource));
+    }
+
+    while (mReassemblyTable.IsFull() || (mReassemblyTable.GetNumBuffers() + numBuffers > ReassemblyTable::kMaxBuffers))
+    {
+        EvictFromReassemblyList(*mReassemblyTable.FindOldest(nullptr));
+    }
+
+    mReassemblyTable.Add(aMessage, aSource);
+    mReassemblyList.Enqueue(aMessage);
+
+exit:
+    return error;
+}
+
+void MeshForwarder::RemoveFromReassemblyList(Message &aMessage)
+{
+    mReassemblyTable.Remove(aMessage);
+    mReassemblyList.Dequeue(aMessage);
+}
+
+void MeshForwarder::EvictFromReassemblyList(Message &aMessage)
+{
+    LogMessage(kMessageReassemblyDrop, aMessage, kErrorNoBufs);
+    mCounters.UpdateOnDrop(aMessage);
+    mReassemblyCounters.mNumEvictions++;
+
+    mReassemblyTable.Remove(aMessage);
+    mReassemblyList.DequeueAndFree(aMessage);
 }
 
 void MeshForwarder::HandleTimeTick(void)
@@ -1561,6 +1760,8 @@ bool MeshForwarder::UpdateReassemblyList(void)
         {
             LogMessage(kMessageReassemblyDrop, message, kErrorReassemblyTimeout);
             mCounters.UpdateOnDrop(message);
+            mReassemblyCounters.mNumTimeouts++;
+            mReassemblyTable.Remove(message);
             mReassemblyList.DequeueAndFree(message);
         }
     }
@@ -1573,6 +1774,8 @@ Error MeshForwarder::FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Mes
     Error             error     = kErrorNone;
     FrameData         frameData = aRxInfo.mFrameData;
     Message::Priority priority;
+    uint16_t          payloadOffset;
+    uint16_t          length;
 
     SuccessOrExit(error = GetFramePriority(aRxInfo, priority));
 
@@ -1581,7 +1784,22 @@ Error MeshForwarder::FrameToMessage(RxInfo &aRxInfo, uint16_t aDatagramSize, Mes
 
     SuccessOrExit(error = Get<Lowpan::Lowpan>().Decompress(*aMessage, aRxInfo.mMacAddrs, frameData, aDatagramSize));
 
-    SuccessOrExit(error = aMessage->AppendData(frameData));
+    // Size the message once, for the frame payload or for the whole
+    // datagram when `aDatagramSize` is given (first fragment), and
+    // then copy the payload in place. This way the buffer chain is
+    // grown and walked a single time per received frame.
+
+    payloadOffset = aMessage->GetLength();
+    length        = payloadOffset + frameData.GetLength();
+
+    if (aDatagramSize != 0)
+    {
+        VerifyOrExit(aDatagramSize >= length, error = kErrorParse);
+        length = aDatagramSize;
+    }
+
+    SuccessOrExit(error = aMessage->SetLength(length));
+    aMessage->WriteData(payloadOffset, frameData);
     aMessage->MoveOffset(frameData.GetLength());
 
 exit:
@@ -207,6 +207,35 @@ public:
         mSendQueue.GetInfo(aSendQueueInfo), mReassemblyList.GetInfo(aReassemblyQueueInfo);
     }
 
+    /**
+     * Gets the number of messages in the send queue which are ready for direct tx, waiting for an address
+     * resolution, or not scheduled for direct tx (e.g., pending indirect tx to sleepy children).
+     *
+     * @param[out] aViewInfo  A reference to a `PriorityQueue::ViewInfo` to populate.
+     */
+    void GetSendQueueViewInfo(PriorityQueue::ViewInfo &aViewInfo) const { mSendQueue.GetViewInfo(aViewInfo); }
+
+    /**
+     * Represents the 6LoWPAN reassembly counters.
+     */
+    struct ReassemblyCounters : public Clearable<ReassemblyCounters>
+    {
+        uint32_t mNumTimeouts;  ///< Number of datagrams dropped because of reassembly timeout.
+        uint32_t mNumEvictions; ///< Number of datagrams evicted (reassembly table or memory limits).
+    };
+
+    /**
+     * Returns a reference to the 6LoWPAN reassembly counters.
+     *
+     * @returns A reference to the reassembly counters.
+     */
+    const ReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * Resets the 6LoWPAN reassembly counters.
+     */
+    void ResetReassemblyCounters(void) { mReassemblyCounters.Clear(); }
+
     /**
      * Returns a reference to the IP level counters.
      *
@@ -411,6 +440,52 @@ private:
 
 #endif // OPENTHREAD_FTD
 
+    class ReassemblyTable
+    {
+        // Indexes the messages in `mReassemblyList` by MAC source and
+        // datagram tag, so that a "next fragment" is matched without
+        // walking the list. Also tracks the number of datagrams per
+        // source and the number of buffers used by the list, so that
+        // reassembly memory can be bounded.
+
+    public:
+        static constexpr uint8_t  kMaxEntries          = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS;
+        static constexpr uint8_t  kMaxEntriesPerSource = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE;
+        static constexpr uint16_t kMaxBuffers          = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS;
+
+        ReassemblyTable(void) { Clear(); }
+
+        void     Clear(void);
+        void     Add(Message &aMessage, const Mac::Address &aSource);
+        void     Remove(const Message &aMessage);
+        Message *Find(const Mac::Address &aSource, uint16_t aDatagramTag) const;
+        Message *FindOldest(const Mac::Address *aSource) const;
+        uint8_t  GetNumEntriesFrom(const Mac::Address &aSource) const;
+        bool     IsFull(void) const { return mNumEntries >= kMaxEntries; }
+        uint16_t GetNumBuffers(void) const { return mNumBuffers; }
+
+    private:
+        static constexpr uint8_t kNumBuckets   = 8;
+        static constexpr uint8_t kInvalidIndex = 0xff;
+
+        static_assert(kMaxEntries < kInvalidIndex, "OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS is too large");
+
+        struct Entry
+        {
+            Message     *mMessage;
+            Mac::Address mSource;
+            uint16_t     mNumBuffers;
+            uint8_t      mNext;
+        };
+
+        static uint8_t GetBucket(const Mac::Address &aSource, uint16_t aDatagramTag);
+
+        uint8_t  mHeads[kNumBuckets];
+        Entry    mEntries[kMaxEntries];
+        uint8_t  mNumEntries;
+        uint16_t mNumBuffers;
+    };
+
 #if OPENTHREAD_CONFIG_TX_QUEUE_STATISTICS_ENABLE
     class TxQueueStats : public Clearable<TxQueueStats>
     {
@@ -468,6 +543,9 @@ private:
     Error UpdateIp6RouteFtd(const Ip6::Header &aIp6Header, Message &aMessage);
     Error UpdateMeshRoute(Message &aMessage);
     bool  UpdateReassemblyList(void);
+    Error AddToReassemblyList(Message &aMessage, const Mac::Address &aSource);
+    void  RemoveFromReassemblyList(Message &aMessage);
+    void  EvictFromReassemblyList(Message &aMessage);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
                                  uint16_t                aSrcRloc16,
@@ -587,6 +665,9 @@ private:
 
     Counters mCounters;
 
+    ReassemblyTable    mReassemblyTable;
+    ReassemblyCounters mReassemblyCounters;
+
 #if OPENTHREAD_FTD || OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     IndirectSender mIndirectSender;
 #endif
@@ -2058,6 +2058,7 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
     Child             *child;
     Router            *router;
     uint16_t           supervisionInterval;
+    TlvIndex           tlvIndex(aRxInfo.mMessage);
 
     Log(kMessageReceive, kTypeChildIdRequest, aRxInfo.mMessageInfo.GetPeerAddr());
 
@@ -2080,11 +2081,11 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadModeTlv(mode));
 
-    SuccessOrExit(error = Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout));
+    SuccessOrExit(error = Tlv::Find<TimeoutTlv>(tlvIndex, timeout));
 
     SuccessOrExit(error = aRxInfo.mMessage.ReadTlvRequestTlv(tlvList));
 
-    switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+    switch (Tlv::Find<SupervisionIntervalTlv>(tlvIndex, supervisionInterval))
     {
     case kErrorNone:
         tlvList.Add(Tlv::kSupervisionInterval);
@@ -2096,7 +2097,7 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<ActiveTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (Tlv::Find<ActiveTimestampTlv>(tlvIndex, timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::ActiveDatasetManager>().GetTimestamp())
@@ -2114,7 +2115,7 @@ void Mle::HandleChildIdRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<PendingTimestampTlv>(aRxInfo.mMessage, timestamp))
+    switch (Tlv::Find<PendingTimestampTlv>(tlvIndex, timestamp))
     {
     case kErrorNone:
         if (timestamp == Get<MeshCoP::PendingDatasetManager>().GetTimestamp())
@@ -2434,6 +2435,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
     uint32_t    mleFrameCounter;
     LeaderData  leaderData;
     Child      *child;
+    TlvIndex    tlvIndex(aRxInfo.mMessage);
 
     if ((aRxInfo.mNeighbor == nullptr) || IsRouterRloc16(aRxInfo.mNeighbor->GetRloc16()) ||
         !Get<ChildTable>().Contains(*aRxInfo.mNeighbor))
@@ -2459,7 +2461,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
 
     Log(kMessageReceive, kTypeChildUpdateResponseOfChild, aRxInfo.mMessageInfo.GetPeerAddr(), child->GetRloc16());
 
-    switch (Tlv::Find<SourceAddressTlv>(aRxInfo.mMessage, sourceAddress))
+    switch (Tlv::Find<SourceAddressTlv>(tlvIndex, sourceAddress))
     {
     case kErrorNone:
         if (child->GetRloc16() != sourceAddress)
@@ -2477,7 +2479,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<StatusTlv>(aRxInfo.mMessage, status))
+    switch (Tlv::Find<StatusTlv>(tlvIndex, status))
     {
     case kErrorNone:
         VerifyOrExit(status != StatusTlv::kError, RemoveNeighbor(*child));
@@ -2488,7 +2490,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<LinkFrameCounterTlv>(aRxInfo.mMessage, linkFrameCounter))
+    switch (Tlv::Find<LinkFrameCounterTlv>(tlvIndex, linkFrameCounter))
     {
     case kErrorNone:
         child->GetLinkFrameCounters().SetAll(linkFrameCounter);
@@ -2500,7 +2502,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
-    switch (Tlv::Find<MleFrameCounterTlv>(aRxInfo.mMessage, mleFrameCounter))
+    switch (Tlv::Find<MleFrameCounterTlv>(tlvIndex, mleFrameCounter))
     {
     case kErrorNone:
         child->SetMleFrameCounter(mleFrameCounter);
@@ -2511,7 +2513,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
         ExitNow(error = kErrorNone);
     }
 
-    switch (Tlv::Find<TimeoutTlv>(aRxInfo.mMessage, timeout))
+    switch (Tlv::Find<TimeoutTlv>(tlvIndex, timeout))
     {
     case kErrorNone:
         child->SetTimeout(timeout);
@@ -2525,7 +2527,7 @@ void Mle::HandleChildUpdateResponseOnParent(RxInfo &aRxInfo)
     {
         uint16_t supervisionInterval;
 
-        switch (Tlv::Find<SupervisionIntervalTlv>(aRxInfo.mMessage, supervisionInterval))
+        switch (Tlv::Find<SupervisionIntervalTlv>(tlvIndex, supervisionInterval))
         {
         case kErrorNone:
             child->SetSupervisionInterval(supervisionInterval);
@@ -51,6 +51,25 @@ exit:
     return;
 }
 
+void Neighbor::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+    mMacAddr = aAddress;
+    HandleAddressChanged();
+}
+
+void Neighbor::SetRloc16(uint16_t aRloc16)
+{
+    mRloc16 = aRloc16;
+    HandleAddressChanged();
+}
+
+void Neighbor::HandleAddressChanged(void)
+{
+#if OPENTHREAD_FTD
+    Get<ChildTable>().HandleNeighborAddressChanged(*this);
+#endif
+}
+
 uint32_t Neighbor::GetConnectionTime(void) const
 {
     return IsStateValid() ? Get<Uptime>().GetUptimeInSeconds() - mConnectionStart : 0;
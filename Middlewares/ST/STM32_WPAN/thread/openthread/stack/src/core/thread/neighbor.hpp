@@ -172,6 +172,20 @@ public:
          */
         bool Matches(const Neighbor &aNeighbor) const;
 
+        /**
+         * Gets the short address to match.
+         *
+         * @returns The short address, or `Mac::kShortAddrInvalid` if the matcher does not match on short address.
+         */
+        Mac::ShortAddress GetShortAddress(void) const { return mShortAddress; }
+
+        /**
+         * Gets the extended address to match.
+         *
+         * @returns A pointer to the extended address, or `nullptr` if the matcher does not match on extended address.
+         */
+        const Mac::ExtAddress *GetExtAddress(void) const { return mExtAddress; }
+
     private:
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
@@ -351,9 +365,11 @@ public:
     /**
      * Sets the Extended Address.
      *
+     * If the neighbor is a `Child`, the child table lookup index is updated.
+     *
      * @param[in]  aAddress  The Extended Address value to set.
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
 
     /**
      * Gets the key sequence value.
@@ -451,9 +467,11 @@ public:
     /**
      * Sets the RLOC16 value.
      *
+     * If the neighbor is a `Child`, the child table lookup index is updated.
+     *
      * @param[in]  aRloc16  The RLOC16 value.
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16);
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -714,6 +732,8 @@ protected:
 private:
     static constexpr uint32_t kLastRxFragmentTagTimeout = OPENTHREAD_CONFIG_MULTI_RADIO_FRAG_TAG_TIMEOUT; // in msec
 
+    void HandleAddressChanged(void);
+
     Mac::ExtAddress mMacAddr;
     TimeMilli       mLastHeard;
     union
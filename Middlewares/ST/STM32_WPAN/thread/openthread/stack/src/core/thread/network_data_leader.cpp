@@ -159,9 +159,6 @@ const PrefixTlv *Leader::FindNextMatchingPrefixTlv(const Ip6::Address &aAddress,
 
 Error Leader::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
 {
-    const PrefixTlv  *prefixTlv = nullptr;
-    const ContextTlv *contextTlv;
-
     aContext.mPrefix.SetLength(0);
 
     if (Get<Mle::Mle>().IsMeshLocalAddress(aAddress))
@@ -169,23 +166,7 @@ Error Leader::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext
         GetContextForMeshLocalPrefix(aContext);
     }
 
-    while ((prefixTlv = FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
-    {
-        contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
-
-        if (contextTlv == nullptr)
-        {
-            continue;
-        }
-
-        if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
-        {
-            prefixTlv->CopyPrefixTo(aContext.mPrefix);
-            aContext.mContextId    = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
-            aContext.mIsValid      = true;
-        }
-    }
+    mContextTable.FindLongestMatch(aAddress, aContext);
 
     return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
 }
@@ -211,10 +192,7 @@ const PrefixTlv *Leader::FindPrefixTlvForContextId(uint8_t aContextId, const Con
 
 Error Leader::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
 {
-    Error             error = kErrorNone;
-    TlvIterator       tlvIterator(GetTlvsStart(), GetTlvsEnd());
-    const PrefixTlv  *prefixTlv;
-    const ContextTlv *contextTlv;
+    Error error = kErrorNone;
 
     if (aContextId == Mle::kMeshLocalPrefixContextId)
     {
@@ -222,13 +200,7 @@ Error Leader::GetContext(uint8_t aContextId, Lowpan::Context &aContext) const
         ExitNow();
     }
 
-    prefixTlv = FindPrefixTlvForContextId(aContextId, contextTlv);
-    VerifyOrExit(prefixTlv != nullptr, error = kErrorNotFound);
-
-    prefixTlv->CopyPrefixTo(aContext.mPrefix);
-    aContext.mContextId    = contextTlv->GetContextId();
-    aContext.mCompressFlag = contextTlv->IsCompress();
-    aContext.mIsValid      = true;
+    error = mContextTable.FindById(aContextId, aContext);
 
 exit:
     return error;
@@ -271,10 +243,16 @@ exit:
     return isOnMesh;
 }
 
-Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
+Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16)
 {
     Error            error     = kErrorNoRoute;
     const PrefixTlv *prefixTlv = nullptr;
+    uint16_t         ownRloc16 = Get<Mle::Mle>().GetRloc16();
+
+    if (mRouteCache.Find(aSource, aDestination, ownRloc16, aRloc16) == kErrorNone)
+    {
+        ExitNow(error = kErrorNone);
+    }
 
     while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
     {
@@ -283,13 +261,10 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
             continue;
         }
 
-        if (ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone)
-        {
-            ExitNow(error = kErrorNone);
-        }
-
-        if (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone)
+        if ((ExternalRouteLookup(prefixTlv->GetDomainId(), aDestination, aRloc16) == kErrorNone) ||
+            (DefaultRouteLookup(*prefixTlv, aRloc16) == kErrorNone))
         {
+            mRouteCache.Add(aSource, aDestination, ownRloc16, aRloc16);
             ExitNow(error = kErrorNone);
         }
     }
@@ -686,9 +661,222 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 void Leader::SignalNetDataChanged(void)
 {
     mMaxLength = Max(mMaxLength, GetLength());
+    UpdateContextTable();
+    mRouteCache.Clear();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
+void Leader::UpdateContextTable(void)
+{
+    TlvIterator      tlvIterator(GetTlvsStart(), GetTlvsEnd());
+    const PrefixTlv *prefixTlv;
+
+    mContextTable.Clear();
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        const ContextTlv *contextTlv = prefixTlv->FindSubTlv<ContextTlv>();
+
+        if (contextTlv != nullptr)
+        {
+            mContextTable.Add(*prefixTlv, *contextTlv);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Leader::RouteCache
+
+Error Leader::RouteCache::Find(const Ip6::Address &aSource,
+                               const Ip6::Address &aDestination,
+                               uint16_t            aOwnRloc16,
+                               uint16_t           &aRloc16)
+{
+    Error  error = kErrorNotFound;
+    Entry *set   = GetSet(mEntries, aSource, aDestination);
+
+    VerifyOrExit(aOwnRloc16 == mOwnRloc16);
+
+    for (uint8_t way = 0; way < kNumWays; way++)
+    {
+        Entry &entry = set[way];
+
+        if (entry.Matches(aSource, aDestination))
+        {
+            VerifyOrExit(TimerMilli::GetNow() < entry.mExpireTime);
+
+            MarkAsUsed(set, entry);
+            aRloc16 = entry.mRloc16;
+            error   = kErrorNone;
+            break;
+        }
+    }
+
+exit:
+    return error;
+}
+
+void Leader::RouteCache::Add(const Ip6::Address &aSource,
+                             const Ip6::Address &aDestination,
+                             uint16_t            aOwnRloc16,
+                             uint16_t            aRloc16)
+{
+    Entry    *set;
+    Entry    *victim = nullptr;
+    TimeMilli now    = TimerMilli::GetNow();
+
+    if (aOwnRloc16 != mOwnRloc16)
+    {
+        Clear();
+        mOwnRloc16 = aOwnRloc16;
+    }
+
+    set = GetSet(mEntries, aSource, aDestination);
+
+    // Reuse the entry of the same flow (expired), else a free or
+    // expired entry, else the least recently used one of the set.
+
+    for (uint8_t way = 0; way < kNumWays; way++)
+    {
+        Entry &entry = set[way];
+
+        if (entry.Matches(aSource, aDestination) || !entry.mValid)
+        {
+            victim = &entry;
+            break;
+        }
+
+        if ((victim != nullptr) && (victim->mExpireTime <= now))
+        {
+            continue;
+        }
+
+        if ((victim == nullptr) || (entry.mExpireTime <= now) || (entry.mAge > victim->mAge))
+        {
+            victim = &entry;
+        }
+    }
+
+    MarkAsUsed(set, *victim);
+
+    victim->mSource      = aSource;
+    victim->mDestination = aDestination;
+    victim->mExpireTime  = now + kEntryLifetime;
+    victim->mRloc16      = aRloc16;
+    victim->mValid       = true;
+}
+
+void Leader::RouteCache::MarkAsUsed(Entry *aSet, Entry &aEntry)
+{
+    // The valid entries of a set have distinct ages from zero, a free
+    // entry is older than all of them.
+
+    uint8_t age = aEntry.mValid ? aEntry.mAge : kNumWays;
+
+    for (uint8_t way = 0; way < kNumWays; way++)
+    {
+        if (aSet[way].mValid && (aSet[way].mAge < age))
+        {
+            aSet[way].mAge++;
+        }
+    }
+
+    aEntry.mAge = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Leader::ContextTable
+
+void Leader::ContextTable::Add(const PrefixTlv &aPrefixTlv, const ContextTlv &aContextTlv)
+{
+    uint8_t index;
+
+    VerifyOrExit(mNumEntries < kNumContextIds);
+
+    // Find the insertion point keeping the entries sorted by prefix
+    // length (longest first). Entries with equal length keep their
+    // Network Data order, matching the previous TLV walk which
+    // only replaced a match with a strictly longer one.
+
+    for (index = mNumEntries; index > 0; index--)
+    {
+        if (mEntries[index - 1].mPrefix.GetLength() >= aPrefixTlv.GetPrefixLength())
+        {
+            break;
+        }
+
+        mEntries[index] = mEntries[index - 1];
+    }
+
+    aPrefixTlv.CopyPrefixTo(mEntries[index].mPrefix);
+    mEntries[index].mContextId    = aContextTlv.GetContextId();
+    mEntries[index].mCompressFlag = aContextTlv.IsCompress();
+    mNumEntries++;
+
+    // Entries at or after `index` were shifted by one. For a
+    // duplicate Context ID the first one in Network Data order is
+    // kept, matching `FindPrefixTlvForContextId()`.
+
+    for (uint8_t id = 0; id < kNumContextIds; id++)
+    {
+        if ((mIdBitmap & (1U << id)) && (mIdIndex[id] >= index))
+        {
+            mIdIndex[id]++;
+        }
+    }
+
+    if ((mIdBitmap & (1U << aContextTlv.GetContextId())) == 0)
+    {
+        mIdBitmap |= (1U << aContextTlv.GetContextId());
+        mIdIndex[aContextTlv.GetContextId()] = index;
+    }
+
+exit:
+    return;
+}
+
+Error Leader::ContextTable::FindById(uint8_t aContextId, Lowpan::Context &aContext) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((aContextId < kNumContextIds) && (mIdBitmap & (1U << aContextId)), error = kErrorNotFound);
+    CopyEntryTo(mEntries[mIdIndex[aContextId]], aContext);
+
+exit:
+    return error;
+}
+
+void Leader::ContextTable::FindLongestMatch(const Ip6::Address &aAddress, Lowpan::Context &aContext) const
+{
+    // Entries are sorted longest first, so the first match is the
+    // longest. It is used only if it is longer than the prefix
+    // already in `aContext` (e.g., the mesh-local prefix).
+
+    for (uint8_t index = 0; index < mNumEntries; index++)
+    {
+        const Entry &entry = mEntries[index];
+
+        if (entry.mPrefix.GetLength() <= aContext.mPrefix.GetLength())
+        {
+            break;
+        }
+
+        if (aAddress.MatchesPrefix(entry.mPrefix))
+        {
+            CopyEntryTo(entry, aContext);
+            break;
+        }
+    }
+}
+
+void Leader::ContextTable::CopyEntryTo(const Entry &aEntry, Lowpan::Context &aContext)
+{
+    aContext.mPrefix       = aEntry.mPrefix;
+    aContext.mContextId    = aEntry.mContextId;
+    aContext.mCompressFlag = aEntry.mCompressFlag;
+    aContext.mIsValid      = true;
+}
+
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
 
 bool Leader::ContainsOmrPrefix(const Ip6::Prefix &aPrefix) const
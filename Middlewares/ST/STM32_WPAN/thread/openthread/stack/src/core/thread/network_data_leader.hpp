@@ -40,6 +40,7 @@
 
 #include "coap/coap.hpp"
 #include "common/const_cast.hpp"
+#include "common/hash.hpp"
 #include "common/non_copyable.hpp"
 #include "common/numeric_limits.hpp"
 #include "common/timer.hpp"
@@ -68,6 +69,7 @@ class Leader : public MutableNetworkData, private NonCopyable
 {
     friend class Tmf::Agent;
     friend class Notifier;
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -145,10 +147,19 @@ public:
      * @param[in]   aDestination        A reference to the IPv6 destination address.
      * @param[out]  aRloc16             A reference to return the RLOC16 for the selected route.
      *
+     * Results are cached per (source, destination) pair until the Network Data or the router table changes.
+     *
      * @retval kErrorNone      Successfully found a route. @p aRloc16 is updated.
      * @retval kErrorNoRoute   No valid route was found.
      */
-    Error RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
+    Error RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16);
+
+    /**
+     * Invalidates the cached route lookup results.
+     *
+     * Is called when the router table changes since the selected border router depends on the mesh path cost.
+     */
+    void HandleRouterTableChanged(void) { mRouteCache.Clear(); }
 
     /**
      * Is used by non-Leader devices to set Network Data by reading it from a message from Leader.
@@ -450,6 +461,7 @@ private:
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
     void  SignalNetDataChanged(void);
+    void  UpdateContextTable(void);
     const CommissioningDataTlv *FindCommissioningData(void) const;
     CommissioningDataTlv *FindCommissioningData(void) { return AsNonConst(AsConst(this)->FindCommissioningData()); }
     const MeshCoP::Tlv   *FindCommissioningDataSubTlv(uint8_t aType) const;
@@ -458,6 +470,95 @@ private:
         return AsNonConst(AsConst(this)->FindCommissioningDataSubTlv(aType));
     }
 
+    class ContextTable : public Clearable<ContextTable>
+    {
+    public:
+        // This class is a compiled view of the Context TLVs in the
+        // Network Data. It is rebuilt whenever the Network Data
+        // changes so that the 6LoWPAN lookups (done twice per frame)
+        // do not need to walk the Prefix TLVs. Entries are sorted by
+        // prefix length (longest first) so the first matching entry
+        // is the longest prefix match. A Context ID maps directly to
+        // its entry through `mIdIndex[]`.
+
+        void  Add(const PrefixTlv &aPrefixTlv, const ContextTlv &aContextTlv);
+        Error FindById(uint8_t aContextId, Lowpan::Context &aContext) const;
+        void  FindLongestMatch(const Ip6::Address &aAddress, Lowpan::Context &aContext) const;
+
+    private:
+        static constexpr uint8_t kNumContextIds = 16;
+
+        struct Entry
+        {
+            Ip6::Prefix mPrefix;
+            uint8_t     mContextId;
+            bool        mCompressFlag;
+        };
+
+        static void CopyEntryTo(const Entry &aEntry, Lowpan::Context &aContext);
+
+        Entry    mEntries[kNumContextIds];
+        uint8_t  mIdIndex[kNumContextIds];
+        uint16_t mIdBitmap;
+        uint8_t  mNumEntries;
+    };
+
+    class RouteCache : public Clearable<RouteCache>
+    {
+    public:
+        // This class caches `RouteLookup()` results in a
+        // set-associative table: a hash of the source and destination
+        // selects a set of `kNumWays` entries, which are replaced in
+        // least recently used order. A result also depends on the
+        // mesh path cost (FTD) or on this device's RLOC16 (MTD) when
+        // comparing border routers, so the whole cache is cleared
+        // when the RLOC16 changes and each entry is only used for
+        // `kEntryLifetime` to bound staleness from link quality
+        // changes that the router table does not signal.
+
+        Error Find(const Ip6::Address &aSource,
+                   const Ip6::Address &aDestination,
+                   uint16_t            aOwnRloc16,
+                   uint16_t           &aRloc16);
+        void  Add(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t aOwnRloc16, uint16_t aRloc16);
+
+    private:
+        static constexpr uint16_t kNumSets       = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS;
+        static constexpr uint8_t  kNumWays       = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS;
+        static constexpr uint32_t kEntryLifetime = 5 * 1000; // in msec
+
+        static_assert(kNumSets >= 1, "OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS must be at least 1");
+        static_assert((OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS >= 1) && (OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS <= 255),
+                      "OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS must be between 1 and 255");
+
+        struct Entry
+        {
+            bool Matches(const Ip6::Address &aSource, const Ip6::Address &aDestination) const
+            {
+                return mValid && (mSource == aSource) && (mDestination == aDestination);
+            }
+
+            Ip6::Address mSource;
+            Ip6::Address mDestination;
+            TimeMilli    mExpireTime;
+            uint16_t     mRloc16;
+            uint8_t      mAge; // Rank in the set, zero for the most recently used.
+            bool         mValid;
+        };
+
+        static Entry *GetSet(Entry (&aEntries)[kNumSets][kNumWays],
+                             const Ip6::Address &aSource,
+                             const Ip6::Address &aDestination)
+        {
+            return aEntries[HashObject(aSource, HashObject(aDestination)) % kNumSets];
+        }
+
+        static void MarkAsUsed(Entry *aSet, Entry &aEntry);
+
+        Entry    mEntries[kNumSets][kNumWays];
+        uint16_t mOwnRloc16;
+    };
+
 #if OPENTHREAD_FTD
     static constexpr uint32_t kMaxNetDataSyncWait = 60 * 1000; // Maximum time to wait for netdata sync in msec.
     static constexpr uint8_t  kMinServiceId       = 0x00;
@@ -635,6 +736,9 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+    ContextTable mContextTable;
+    RouteCache   mRouteCache;
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
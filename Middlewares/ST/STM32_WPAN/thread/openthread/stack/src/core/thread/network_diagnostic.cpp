@@ -683,8 +683,9 @@ void Server::PrepareAndSendAnswers(const Ip6::Address &aDestination, const Messa
     AnswerInfo     info;
     OffsetRange    offsetRange;
     AnswerTlv      answerTlv;
+    TlvIndex       tlvIndex(aRequest);
 
-    if (Tlv::Find<QueryIdTlv>(aRequest, info.mQueryId) == kErrorNone)
+    if (Tlv::Find<QueryIdTlv>(tlvIndex, info.mQueryId) == kErrorNone)
     {
         info.mHasQueryId = true;
     }
@@ -693,7 +694,7 @@ void Server::PrepareAndSendAnswers(const Ip6::Address &aDestination, const Messa
 
     SuccessOrExit(error = AllocateAnswer(answer, info));
 
-    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(aRequest, Tlv::kTypeList, offsetRange));
+    SuccessOrExit(error = Tlv::FindTlvValueOffsetRange(tlvIndex, Tlv::kTypeList, offsetRange));
 
     while (!offsetRange.IsEmpty())
     {
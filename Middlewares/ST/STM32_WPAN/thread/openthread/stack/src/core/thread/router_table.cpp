@@ -47,6 +47,7 @@ RouterTable::RouterTable(Instance &aInstance)
     , mMaxRouterId(Mle::kMaxRouterId)
 #endif
 {
+    mRouteUpdateCounters.Clear();
     Clear();
 }
 
@@ -553,22 +554,42 @@ exit:
 void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighborId)
 {
     Router          *neighbor;
+    Mle::RouterIdSet affectedIdSet;
     Mle::RouterIdSet finitePathCostIdSet;
     uint8_t          linkCostToNeighbor;
 
     neighbor = FindRouterById(aNeighborId);
     VerifyOrExit(neighbor != nullptr);
 
+    mRouteUpdateCounters.mNumUpdates++;
+
     // Before updating the routes, we track which routers have finite
     // path cost. After the update we check again to see if any path
     // cost changed from finite to infinite or vice versa to decide
     // whether to reset the  MLE Advertisement interval.
-
+    //
+    // Only the routes this update can affect are tracked: the
+    // neighbor itself (its link quality may change), routers using
+    // the neighbor as next hop (their path cost includes the link
+    // cost to neighbor), and routers included in `aRouteTlv` (their
+    // next hop and cost may change). Path cost of any other router
+    // or unallocated Router ID stays the same.
+
+    affectedIdSet.Clear();
     finitePathCostIdSet.Clear();
 
-    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    for (const Router &router : mRouters)
     {
-        if (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost)
+        uint8_t routerId = router.GetRouterId();
+
+        if ((routerId != aNeighborId) && (router.GetNextHop() != aNeighborId) && !aRouteTlv.IsRouterIdSet(routerId))
+        {
+            continue;
+        }
+
+        affectedIdSet.Add(routerId);
+
+        if (GetPathCost(router.GetRloc16()) < Mle::kMaxRouteCost)
         {
             finitePathCostIdSet.Add(routerId);
         }
@@ -641,6 +662,8 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
             continue;
         }
 
+        mRouteUpdateCounters.mNumRoutesEvaluated++;
+
         nextHop = FindNextHopOf(*router);
 
         cost = aRouteTlv.GetRouteCost(index);
@@ -654,6 +677,7 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
             {
                 if (router->SetNextHopAndCost(aNeighborId, cost))
                 {
+                    mRouteUpdateCounters.mNumRoutesChanged++;
                     SignalTableChanged();
                 }
             }
@@ -661,6 +685,7 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
             {
                 router->SetNextHopToInvalid();
                 router->SetLastHeard(TimerMilli::GetNow());
+                mRouteUpdateCounters.mNumRoutesChanged++;
                 SignalTableChanged();
             }
         }
@@ -672,6 +697,7 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
             if (newCost < curCost)
             {
                 router->SetNextHopAndCost(aNeighborId, cost);
+                mRouteUpdateCounters.mNumRoutesChanged++;
                 SignalTableChanged();
             }
         }
@@ -679,8 +705,16 @@ void RouterTable::UpdateRoutes(const Mle::RouteTlv &aRouteTlv, uint8_t aNeighbor
 
     for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
     {
-        bool oldCostFinite = finitePathCostIdSet.Contains(routerId);
-        bool newCostFinite = (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost);
+        bool oldCostFinite;
+        bool newCostFinite;
+
+        if (!affectedIdSet.Contains(routerId))
+        {
+            continue;
+        }
+
+        oldCostFinite = finitePathCostIdSet.Contains(routerId);
+        newCostFinite = (GetPathCost(Mle::Rloc16FromRouterId(routerId)) < Mle::kMaxRouteCost);
 
         if (newCostFinite != oldCostFinite)
         {
@@ -891,6 +925,7 @@ void RouterTable::HandleTableChanged(void)
 #endif
 
     Get<Mle::Mle>().UpdateAdvertiseInterval();
+    Get<NetworkData::Leader>().HandleRouterTableChanged();
 }
 
 #if OT_SHOULD_LOG_AT(OT_LOG_LEVEL_INFO)
@@ -34,6 +34,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/array.hpp"
+#include "common/clearable.hpp"
 #include "common/const_cast.hpp"
 #include "common/encoding.hpp"
 #include "common/iterator_utils.hpp"
@@ -54,6 +55,16 @@ class RouterTable : public InstanceLocator, private NonCopyable
     friend class NeighborTable;
 
 public:
+    /**
+     * Represents the route update counters.
+     */
+    struct RouteUpdateCounters : public Clearable<RouteUpdateCounters>
+    {
+        uint32_t mNumUpdates;         ///< Number of `UpdateRoutes()` calls processing a neighbor's Route TLV.
+        uint32_t mNumRoutesEvaluated; ///< Number of destinations re-evaluated across all updates.
+        uint32_t mNumRoutesChanged;   ///< Number of destinations whose next hop or cost changed.
+    };
+
     /**
      * Constructor.
      *
@@ -344,6 +355,21 @@ public:
      */
     void UpdateRouterOnFtdChild(const Mle::RouteTlv &aRouteTlv, uint8_t aParentId);
 
+    /**
+     * Gets the route update counters.
+     *
+     * The average number of destinations re-evaluated per received Route TLV is given by `mNumRoutesEvaluated` over
+     * `mNumUpdates`.
+     *
+     * @returns A reference to the route update counters.
+     */
+    const RouteUpdateCounters &GetRouteUpdateCounters(void) const { return mRouteUpdateCounters; }
+
+    /**
+     * Resets the route update counters.
+     */
+    void ResetRouteUpdateCounters(void) { mRouteUpdateCounters.Clear(); }
+
     /**
      * Gets the allocated Router ID set.
      *
@@ -464,6 +490,7 @@ private:
     RouterIdMap                     mRouterIdMap;
     TimeMilli                       mRouterIdSequenceLastUpdated;
     uint8_t                         mRouterIdSequence;
+    RouteUpdateCounters             mRouteUpdateCounters;
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     uint8_t mMinRouterId;
     uint8_t mMaxRouterId;
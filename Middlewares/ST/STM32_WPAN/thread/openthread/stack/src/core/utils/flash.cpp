@@ -45,7 +45,8 @@ void Flash::Init(void)
 
     otPlatFlashInit(&GetInstance());
 
-    mSwapSize = otPlatFlashGetSwapSize(&GetInstance());
+    mSwapSize   = otPlatFlashGetSwapSize(&GetInstance());
+    mIndexValid = false;
 
     for (mSwapIndex = 0;; mSwapIndex++)
     {
@@ -81,6 +82,11 @@ void Flash::Init(void)
 
     SanitizeFreeSpace();
 
+    if (!mIndexValid)
+    {
+        BuildIndex();
+    }
+
 exit:
     return;
 }
@@ -111,18 +117,83 @@ exit:
     }
 }
 
-Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+void Flash::BuildIndex(void)
 {
-    Error        error       = kErrorNotFound;
-    uint16_t     valueLength = 0;
-    int          index       = 0; // This must be initialized to 0. See [Note] in Delete().
-    uint32_t     offset;
     RecordHeader record;
 
-    for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    mIndexValid  = true;
+    mIndexLength = 0;
+
+    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
 
+        if (record.IsValid())
+        {
+            AddToIndex(offset, record);
+        }
+    }
+}
+
+void Flash::AddToIndex(uint32_t aOffset, const RecordHeader &aHeader)
+{
+    VerifyOrExit(mIndexValid);
+
+    if (mIndexLength >= kIndexSize)
+    {
+        // Too many valid records, fall back to scanning flash.
+        mIndexValid = false;
+        ExitNow();
+    }
+
+    mIndex[mIndexLength].mOffset = aOffset;
+    mIndex[mIndexLength].mHeader = aHeader;
+    mIndexLength++;
+
+exit:
+    return;
+}
+
+void Flash::RemoveInvalidFromIndex(void)
+{
+    uint16_t length = 0;
+
+    VerifyOrExit(mIndexValid);
+
+    for (uint16_t i = 0; i < mIndexLength; i++)
+    {
+        if (mIndex[i].mHeader.IsValid())
+        {
+            mIndex[length++] = mIndex[i];
+        }
+    }
+
+    mIndexLength = length;
+
+exit:
+    return;
+}
+
+void Flash::WriteRecordHeader(const RecordIterator &aIterator)
+{
+    otPlatFlashWrite(&GetInstance(), mSwapIndex, aIterator.GetOffset(), &aIterator.GetHeader(), sizeof(RecordHeader));
+
+    if (mIndexValid)
+    {
+        mIndex[aIterator.GetPosition()].mHeader = aIterator.GetHeader();
+    }
+}
+
+Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+{
+    Error    error       = kErrorNotFound;
+    uint16_t valueLength = 0;
+    int      index       = 0; // This must be initialized to 0. See [Note] in Delete().
+
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
+    {
+        const RecordHeader &record = iterator.GetHeader();
+
         if ((record.GetKey() != aKey) || !record.IsValid())
         {
             continue;
@@ -144,7 +215,8 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
                     readLength = record.GetLength();
                 }
 
-                otPlatFlashRead(&GetInstance(), mSwapIndex, offset + sizeof(record), aValue, readLength);
+                otPlatFlashRead(&GetInstance(), mSwapIndex, iterator.GetOffset() + sizeof(record), aValue,
+                                readLength);
             }
 
             valueLength = record.GetLength();
@@ -195,20 +267,43 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+    if (aFirst)
+    {
+        // The new value set supersedes the records of the key written
+        // before it. They are marked deleted once the new record is
+        // complete, so the index holds one value set per key instead of
+        // growing with every `Set()`.
+
+        for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
+        {
+            RecordHeader &header = iterator.GetHeader();
+
+            if (header.IsValid() && (header.GetKey() == aKey))
+            {
+                header.SetDeleted();
+                WriteRecordHeader(iterator);
+            }
+        }
+
+        RemoveInvalidFromIndex();
+    }
+
+    AddToIndex(mSwapUsed, record);
     mSwapUsed += record.GetSize();
 
 exit:
     return error;
 }
 
-bool Flash::DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const
+bool Flash::DoesValidRecordExist(RecordIterator aIterator, uint16_t aKey) const
 {
-    RecordHeader record;
-    bool         rval = false;
+    // Checks the records after `aIterator`.
 
-    for (; aOffset < mSwapUsed; aOffset += record.GetSize())
+    bool rval = false;
+
+    for (aIterator.Advance(); !aIterator.IsDone(); aIterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+        const RecordHeader &record = aIterator.GetHeader();
 
         if (record.IsValid() && record.IsFirst() && (record.GetKey() == aKey))
         {
@@ -222,25 +317,38 @@ exit:
 
 void Flash::Swap(void)
 {
-    uint8_t  dstIndex  = !mSwapIndex;
-    uint32_t dstOffset = kSwapMarkerSize;
+    uint8_t  dstIndex    = !mSwapIndex;
+    uint32_t dstOffset   = kSwapMarkerSize;
+    uint16_t indexLength = 0;
     Record   record;
 
     otPlatFlashErase(&GetInstance(), dstIndex);
 
-    for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, sizeof(RecordHeader));
+        const RecordHeader &header = iterator.GetHeader();
 
-        VerifyOrExit(record.IsAddBeginSet());
+        VerifyOrExit(header.IsAddBeginSet());
 
-        if (!record.IsValid() || DoesValidRecordExist(srcOffset + record.GetSize(), record.GetKey()))
+        if (!header.IsValid() || DoesValidRecordExist(iterator, header.GetKey()))
         {
             continue;
         }
 
-        otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, record.GetSize());
+        otPlatFlashRead(&GetInstance(), mSwapIndex, iterator.GetOffset(), &record, header.GetSize());
         otPlatFlashWrite(&GetInstance(), dstIndex, dstOffset, &record, record.GetSize());
+
+        if (mIndexValid)
+        {
+            // The copied records keep their order and there are never
+            // more of them than already visited, so the index is
+            // compacted in place.
+
+            mIndex[indexLength].mOffset = dstOffset;
+            mIndex[indexLength].mHeader = header;
+            indexLength++;
+        }
+
         dstOffset += record.GetSize();
     }
 
@@ -250,17 +358,25 @@ exit:
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+
+    if (mIndexValid)
+    {
+        mIndexLength = indexLength;
+    }
+    else
+    {
+        BuildIndex();
+    }
 }
 
 Error Flash::Delete(uint16_t aKey, int aIndex)
 {
-    Error        error = kErrorNotFound;
-    int          index = 0; // This must be initialized to 0. See [Note] below.
-    RecordHeader record;
+    Error error = kErrorNotFound;
+    int   index = 0; // This must be initialized to 0. See [Note] below.
 
-    for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+    for (RecordIterator iterator(*this); !iterator.IsDone(); iterator.Advance())
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        RecordHeader &record = iterator.GetHeader();
 
         if ((record.GetKey() != aKey) || !record.IsValid())
         {
@@ -275,7 +391,7 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
         if ((aIndex == index) || (aIndex == -1))
         {
             record.SetDeleted();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            WriteRecordHeader(iterator);
             error = kErrorNone;
         }
 
@@ -286,12 +402,14 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
         if ((index == 1) && (aIndex == 0))
         {
             record.SetFirst();
-            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+            WriteRecordHeader(iterator);
         }
 
         index++;
     }
 
+    RemoveInvalidFromIndex();
+
     return error;
 }
 
@@ -300,8 +418,55 @@ void Flash::Wipe(void)
     otPlatFlashErase(&GetInstance(), 0);
     otPlatFlashWrite(&GetInstance(), 0, 0, &sSwapActive, sizeof(sSwapActive));
 
-    mSwapIndex = 0;
-    mSwapUsed  = sizeof(sSwapActive);
+    mSwapIndex   = 0;
+    mSwapUsed    = sizeof(sSwapActive);
+    mIndexValid  = true;
+    mIndexLength = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Flash::RecordIterator
+
+Flash::RecordIterator::RecordIterator(const Flash &aFlash)
+    : mFlash(aFlash)
+    , mOffset(kSwapMarkerSize)
+    , mPosition(0)
+{
+    Load();
+}
+
+void Flash::RecordIterator::Advance(void)
+{
+    if (mFlash.mIndexValid)
+    {
+        mPosition++;
+    }
+    else
+    {
+        mOffset += mHeader.GetSize();
+    }
+
+    Load();
+}
+
+void Flash::RecordIterator::Load(void)
+{
+    if (mFlash.mIndexValid)
+    {
+        if (mPosition < mFlash.mIndexLength)
+        {
+            mOffset = mFlash.mIndex[mPosition].mOffset;
+            mHeader = mFlash.mIndex[mPosition].mHeader;
+        }
+        else
+        {
+            mOffset = mFlash.mSwapUsed;
+        }
+    }
+    else if (mOffset < mFlash.mSwapUsed)
+    {
+        otPlatFlashRead(&mFlash.GetInstance(), mFlash.mSwapIndex, mOffset, &mHeader, sizeof(mHeader));
+    }
 }
 
 } // namespace ot
@@ -55,6 +55,8 @@ public:
      */
     explicit Flash(Instance &aInstance)
         : InstanceLocator(aInstance)
+        , mIndexValid(false)
+        , mIndexLength(0)
     {
     }
 
@@ -209,14 +211,55 @@ private:
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
+    static constexpr uint16_t kIndexSize = OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE;
+
+    struct IndexEntry
+    {
+        uint32_t     mOffset;
+        RecordHeader mHeader;
+    };
+
+    class RecordIterator
+    {
+    public:
+        // Iterates over the records in the active swap area in flash
+        // order. When the index is valid the headers are taken from
+        // it (it only holds valid records), otherwise they are read
+        // from flash.
+
+        explicit RecordIterator(const Flash &aFlash);
+
+        bool                IsDone(void) const { return mOffset >= mFlash.mSwapUsed; }
+        void                Advance(void);
+        uint32_t            GetOffset(void) const { return mOffset; }
+        uint16_t            GetPosition(void) const { return mPosition; }
+        RecordHeader       &GetHeader(void) { return mHeader; }
+        const RecordHeader &GetHeader(void) const { return mHeader; }
+
+    private:
+        void Load(void);
+
+        const Flash &mFlash;
+        uint32_t     mOffset;
+        uint16_t     mPosition;
+        RecordHeader mHeader;
+    };
+
     Error Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
-    bool  DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
+    bool  DoesValidRecordExist(RecordIterator aIterator, uint16_t aKey) const;
+    void  WriteRecordHeader(const RecordIterator &aIterator);
+    void  BuildIndex(void);
+    void  AddToIndex(uint32_t aOffset, const RecordHeader &aHeader);
+    void  RemoveInvalidFromIndex(void);
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
-    uint32_t mSwapSize;
-    uint32_t mSwapUsed;
-    uint8_t  mSwapIndex;
+    uint32_t   mSwapSize;
+    uint32_t   mSwapUsed;
+    uint8_t    mSwapIndex;
+    bool       mIndexValid;
+    uint16_t   mIndexLength;
+    IndexEntry mIndex[kIndexSize];
 };
 
 } // namespace ot
@@ -369,9 +369,12 @@ extern void HW_PKA_P256_ReadEccScalarMul( uint32_t* p_x,
  * The RNG driver is made to generate the random numbers in background instead
  * of generating them each time they are needed by the application.
  * Thus, the function HW_RNG_Process() must be called regularly in background
- * loop to generate a pool of random numbers. The function HW_RNG_Get() reads
- * the random numbers from the pool.
- * The size of the pool must be configured with HW_RNG_POOL_SIZE.
+ * loop to generate a pool of random numbers. The pool is filled from the RNG
+ * interrupt: HW_RNG_IRQHandler() must be called from RNG_IRQHandler().
+ * The functions HW_RNG_Get() and HW_RNG_GetBytes() read the random numbers
+ * from the pool without masking the interrupts.
+ * The size of the pool must be configured with HW_RNG_POOL_SIZE (a power
+ * of 2).
  */
 
 /* Error codes definition for HW_RNG return values */
@@ -387,6 +390,16 @@ enum
 /* Default threshold to refill RNG pool */
 #define HW_RNG_POOL_DEFAULT_THRESHOLD           (12)
 
+/* RNG pool statistics */
+typedef struct
+{
+  uint32_t level;            /* Number of 32-bit words currently in the pool */
+  uint32_t refill_count;     /* Number of pool refills started */
+  uint32_t refill_words;     /* Number of 32-bit words written in the pool */
+  uint32_t underflow_count;  /* Number of reads that found too few words */
+  uint32_t underflow_words;  /* Number of 32-bit words missing in those reads */
+} HW_RNG_STATS_T;
+
 extern int RNG_MutexTake(void);
 extern int RNG_MutexRelease(void);
 
@@ -428,14 +441,43 @@ extern void HW_RNG_Start( void );
 extern void HW_RNG_Get( uint8_t n,
                         uint32_t* val );
 
+/*
+ * HW_RNG_GetBytes
+ *
+ * Retrieves "len" random bytes, with a single update of the pool read index.
+ * "len" must be in the range [1, 4 * CFG_HW_RNG_POOL_SIZE].
+ * "buf" does not need to be aligned.
+ * It can be called concurrently from tasks and interrupts.
+ * It returns 0 (HW_OK), or HW_RNG_UFLOW_ERROR if the pool did not hold
+ * enough random numbers.
+ */
+extern int HW_RNG_GetBytes( uint8_t* buf,
+                            uint32_t len );
+
+/*
+ * HW_RNG_GetStats
+ *
+ * Retrieves the current level and the refill/underflow counters of the pool.
+ */
+extern void HW_RNG_GetStats( HW_RNG_STATS_T* stats );
+
+/*
+ * HW_RNG_IRQHandler
+ *
+ * Fills the pool with the generated random numbers. It must be called from
+ * the RNG interrupt handler.
+ */
+extern void HW_RNG_IRQHandler( void );
+
 /*
  * HW_RNG_Process
  *
  * This function must be called in a separate task or in "background" loop.
- * It implements a simple state machine that enables the RNG block,
- * generates random numbers and then disables the RNG.
- * It returns 0 (HW_OK) if the low power mode can be entered.
- * It returns HW_BUSY as long as this function must be called.
+ * It enables the RNG block and starts the refill of the pool from the RNG
+ * interrupt when the pool is below the threshold. Once the pool is full, it
+ * starts the timer that disables the RNG.
+ * It returns 0 (HW_OK) in normal conditions.
+ * It returns HW_BUSY if the RNG is used by another user.
  * In error conditions, it returns one of the following error codes:
  * - HW_RNG_CLOCK_ERROR for clock error,
  * - HW_RNG_NOISE_ERROR for noise source error;
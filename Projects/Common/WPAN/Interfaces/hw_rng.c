@@ -67,13 +67,37 @@ __weak void RNG_KERNEL_CLK_OFF(void)
 
 /*****************************************************************************/
 
+#ifndef CFG_HW_RNG_IRQ_PRIO
+#define CFG_HW_RNG_IRQ_PRIO                     (14)
+#endif
+
+/* The pool is a ring indexed by free-running counters: the pool size must be
+ * a power of 2 so that the counters can wrap around */
+#if ((HW_RNG_POOL_SIZE & (HW_RNG_POOL_SIZE - 1)) != 0)
+#error "CFG_HW_RNG_POOL_SIZE must be a power of 2"
+#endif
+
+#define HW_RNG_POOL_MASK                        (HW_RNG_POOL_SIZE - 1)
+
+/*
+ * The pool is a single-producer ring:
+ * - "head" is only written by the producer (RNG interrupt, or HW_RNG_Start
+ *   before the interrupt is used),
+ * - "tail" is only advanced by the consumers, with one compare-and-swap per
+ *   HW_RNG_GetBytes() call, so that no critical section is needed to read
+ *   random numbers even when several contexts (link layer ISR, tasks) read
+ *   the pool concurrently.
+ * The number of available words is (head - tail).
+ */
 typedef struct
 {
-  uint32_t pool[HW_RNG_POOL_SIZE];
-  uint8_t  size;
-  uint8_t  run;
-  uint8_t  clock_en;
-  int      error;
+  uint32_t          pool[HW_RNG_POOL_SIZE];
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  volatile uint8_t  run;
+  uint8_t           clock_en;
+  volatile int      error;
+  HW_RNG_STATS_T    stats;
 } HW_RNG_VAR_T;
 
 /*****************************************************************************/
@@ -89,10 +113,20 @@ static void HW_RNG_TimerStart(void);
 
 /*****************************************************************************/
 
+static inline uint32_t HW_RNG_Level( const HW_RNG_VAR_T* pv )
+{
+  return ( pv->head - pv->tail );
+}
+
+/*****************************************************************************/
+
 void HW_RNG_Disable( void )
 {
   SYSTEM_DEBUG_SIGNAL_SET(RNG_DISABLE);
 
+  LL_RNG_DisableIT( RNG );
+  HW_RNG_var.run = FALSE;
+
   LL_RNG_Disable( RNG );
   while(LL_RNG_IsEnabled(RNG)); // whait for RNGEN = 0
 
@@ -184,13 +218,10 @@ static void HW_RNG_WaitingClockSynchronization( void )
 /*****************************************************************************/
 
 /*
- * HW_RNG_Run: this function must be called in loop.
- * It implenments a simple state machine that enables the RNG,
- * fills the pool with generated random numbers and then disables the RNG.
- * It always returns 0 in normal conditions. In error conditions, it returns
- * an error code different from 0.
+ * HW_RNG_CheckError: checks and clears the RNG clock and seed error flags.
+ * It returns 0 in normal conditions, or an error code different from 0.
  */
-static int HW_RNG_Run(HW_RNG_VAR_T* pv)
+static int HW_RNG_CheckError( void )
 {
   int i, error = HW_OK;
 
@@ -218,58 +249,115 @@ static int HW_RNG_Run(HW_RNG_VAR_T* pv)
     error = HW_RNG_NOISE_ERROR;
   }
 
-  /* if the pool is not full, read the H/W generated values until the pool is full */
-  UTILS_ENTER_CRITICAL_SECTION();
+  return error;
+}
+
+/*****************************************************************************/
+
+/*
+ * HW_RNG_Fill: producer side of the pool.
+ * It moves the words already generated by the RNG into the pool, without
+ * waiting for new ones. The new head is published once, after the words have
+ * been written. It returns TRUE when the pool is full.
+ */
+static uint8_t HW_RNG_Fill( HW_RNG_VAR_T* pv )
+{
+  uint32_t head = pv->head;
+  uint32_t free_words = HW_RNG_POOL_SIZE - (head - pv->tail);
+
   SYSTEM_DEBUG_SIGNAL_SET(RNG_GEN_RAND_NUM);
 
-  while (pv->size < HW_RNG_POOL_SIZE)
+  while ( (free_words != 0) && LL_RNG_IsActiveFlag_DRDY(RNG) )
   {
-    if (LL_RNG_IsActiveFlag_DRDY(RNG))
-    {
-      pv->pool[pv->size] = LL_RNG_ReadRandData32(RNG);
-      pv->size++;
-    }
+    pv->pool[head & HW_RNG_POOL_MASK] = LL_RNG_ReadRandData32(RNG);
+    head++;
+    free_words--;
   }
 
+  pv->stats.refill_words += head - pv->head;
+
+  __DMB();
+  pv->head = head;
+
   SYSTEM_DEBUG_SIGNAL_RESET(RNG_GEN_RAND_NUM);
-  UTILS_EXIT_CRITICAL_SECTION( );
 
-  /* pool is full, disable the RNG and its RCC clock */
-  // BUG, I think, RNG shouldn't be disable immediately after generated, because it may be needed for next using IMMEDIATELY
-  // TODO implementation of delayed HW_RNG_Disable. start freertos timer -> freertos timer in callback -> run suspended RNG_task  -> RNG_task - execute, disable RNG.
-  
-  // HW_RNG_Disable( ); // Here not disable but refresh freertos timmer 
-  HW_RNG_TimerStart(); // start counting to disable HW_RNG, if some process needs necessary use RNG, timer will be restart
-  
-  /* Reset flag indicating that the RNG is ON */
-  pv->run = FALSE;
-  
+  return ( free_words == 0 );
+}
+
+/*****************************************************************************/
+
+/*
+ * HW_RNG_Run: starts the refill of the pool.
+ * The pool is then filled from the RNG data ready interrupt, so that the
+ * interrupts are never masked while waiting for the RNG.
+ * It always returns 0 in normal conditions. In error conditions, it returns
+ * an error code different from 0.
+ */
+static int HW_RNG_Run(HW_RNG_VAR_T* pv)
+{
+  int error = HW_RNG_CheckError( );
+
+  if ( (error == HW_OK) && !pv->run )
+  {
+    pv->run = TRUE;
+    pv->stats.refill_count++;
+    LL_RNG_EnableIT( RNG );
+  }
+
   return error;
 }
 
 /*****************************************************************************/
 
+void HW_RNG_IRQHandler( void )
+{
+  HW_RNG_VAR_T* pv = &HW_RNG_var;
+  int error = HW_RNG_CheckError( );
+
+  if ( (error != HW_OK) || HW_RNG_Fill( pv ) )
+  {
+    /* Pool is full (or the RNG is in error): stop the refill and let the
+     * background process report the error or start the disable timer */
+    LL_RNG_DisableIT( RNG );
+    pv->run = FALSE;
+
+    if ( error != HW_OK )
+    {
+      pv->error = error;
+    }
+
+    HWCB_RNG_Process( );
+  }
+}
+
+/*****************************************************************************/
+
 void HW_RNG_Start( void )
 {
   HW_RNG_VAR_T* pv = &HW_RNG_var;
 
   /* Reset global variables */
-  pv->size = 0;
+  pv->head = 0;
+  pv->tail = 0;
   pv->run = FALSE;
   pv->error = HW_OK;
   pv->clock_en = 0;
+  memset( &pv->stats, 0, sizeof(pv->stats) );
 
   if (0 != RNG_MutexTake())
   {
 	  Error_Handler();
   }
 
-  /* Fill the random numbers pool by calling the "run" function */
+  /* Fill the random numbers pool before the first random numbers are
+   * requested (at reset, there is no other user of the RNG to delay) */
   do
   {
-    pv->error = HW_RNG_Run( pv );
+    pv->error = HW_RNG_CheckError( );
   }
-  while ( pv->run && !pv->error );
+  while ( !pv->error && !HW_RNG_Fill( pv ) );
+
+  HW_RNG_TimerStart( );
 
   if (0 != RNG_MutexRelease())
   {
@@ -279,32 +367,91 @@ void HW_RNG_Start( void )
 
 /*****************************************************************************/
 
-void HW_RNG_Get( uint8_t n, uint32_t* val )
+int HW_RNG_GetBytes( uint8_t* buf, uint32_t len )
 {
   HW_RNG_VAR_T* pv = &HW_RNG_var;
+  uint32_t tail, head, n_words, n_avail, i, size;
   uint32_t pool_value;
+  int status;
+
+  n_words = (len + 3) / 4;
 
-  while ( n-- )
+  /* Copy the words from the pool, then claim them with a single update of
+   * the tail. If another consumer claimed words in the meantime, the copy
+   * is done again from the new tail. */
+  do
   {
-    UTILS_ENTER_CRITICAL_SECTION( );
+    tail = pv->tail;
+    head = pv->head;
+    __DMB();
 
-    if ( pv->size == 0 )
+    n_avail = head - tail;
+    if ( n_avail > n_words )
     {
-      pv->error = HW_RNG_UFLOW_ERROR;
-      pool_value = ~pv->pool[HW_RNG_POOL_SIZE - n];
+      n_avail = n_words;
     }
-    else
+
+    for ( i = 0; i < n_words; i++ )
     {
-      pool_value = pv->pool[--pv->size];
+      pool_value = pv->pool[(tail + i) & HW_RNG_POOL_MASK];
+
+      if ( i >= n_avail )
+      {
+        /* Underflow: same fallback as before, complemented stale words */
+        pool_value = ~pool_value;
+      }
+
+      size = ( (len - 4 * i) < 4 ) ? (len - 4 * i) : 4;
+      memcpy( &buf[4 * i], &pool_value, size );
     }
 
+    if ( __LDREXW( (volatile uint32_t*)&pv->tail ) != tail )
+    {
+      __CLREX( );
+      continue;
+    }
+  }
+  while ( __STREXW( tail + n_avail, (volatile uint32_t*)&pv->tail ) != 0 );
+
+  status = HW_OK;
+
+  if ( n_avail < n_words )
+  {
+    UTILS_ENTER_CRITICAL_SECTION( );
+    pv->error = HW_RNG_UFLOW_ERROR;
+    pv->stats.underflow_count++;
+    pv->stats.underflow_words += n_words - n_avail;
     UTILS_EXIT_CRITICAL_SECTION( );
 
-    *val++ = pool_value;
+    status = HW_RNG_UFLOW_ERROR;
   }
 
-  /* Call the process callback function to fill the pool offline */
-  HWCB_RNG_Process( );
+  /* Call the process callback function to refill the pool offline */
+  if ( (head - (tail + n_avail)) < hw_rng_pool_threshold )
+  {
+    HWCB_RNG_Process( );
+  }
+
+  return status;
+}
+
+/*****************************************************************************/
+
+void HW_RNG_Get( uint8_t n, uint32_t* val )
+{
+  HW_RNG_GetBytes( (uint8_t*)val, 4 * (uint32_t)n );
+}
+
+/*****************************************************************************/
+
+void HW_RNG_GetStats( HW_RNG_STATS_T* stats )
+{
+  HW_RNG_VAR_T* pv = &HW_RNG_var;
+
+  UTILS_ENTER_CRITICAL_SECTION( );
+  *stats = pv->stats;
+  stats->level = HW_RNG_Level( pv );
+  UTILS_EXIT_CRITICAL_SECTION( );
 }
 
 /*****************************************************************************/
@@ -320,8 +467,8 @@ int HW_RNG_Process( void )
   }  
   else 
   {
-    /* Check if the process is not done or if the pool is not full */
-    if (pv->size < hw_rng_pool_threshold)
+    /* Check if the pool needs to be refilled */
+    if (HW_RNG_Level(pv) < hw_rng_pool_threshold)
     {
       HW_RNG_Init();
       UTILS_ENTER_CRITICAL_SECTION( );
@@ -332,18 +479,24 @@ int HW_RNG_Process( void )
 
       UTILS_EXIT_CRITICAL_SECTION( );
 
-      if ( status == HW_OK )
+      /* Start the refill: the pool is filled from the RNG interrupt.
+       * An underflow is reported but does not delay the refill */
+      if ( (status == HW_OK) || (status == HW_RNG_UFLOW_ERROR) )
       {
-        /* Call the "run" function that generates random data */
-        status = HW_RNG_Run( pv );
+        int run_status = HW_RNG_Run( pv );
 
-        /* If the process is not done, return "busy" status */
-        if ( (status == HW_OK) && pv->run )
+        if ( run_status != HW_OK )
         {
-          status = HW_BUSY;
+          status = run_status;
         }
       }
     }
+    else if ( !pv->run )
+    {
+      /* Pool is refilled: start counting to disable HW_RNG, if some process
+       * needs to use RNG again, the timer will be restarted */
+      HW_RNG_TimerStart( );
+    }
     
     if (0 != RNG_MutexRelease())
     {
@@ -362,8 +515,6 @@ int HW_RNG_Process( void )
 
 void HW_RNG_Init(void)
 {
- HW_RNG_VAR_T* pv = &HW_RNG_var;
-
  // if RNG already is running, do nothing - you will avoid CONDRST reset and BUSY error
  if (LL_RNG_IsEnabled(RNG) && (RNG->CR & RNG_CR_RNGEN))
  {
@@ -398,10 +549,11 @@ while((RNG->SR & (1 << 4)));
 
  LL_RNG_SetHealthConfig(RNG,RNG_HTCR_NIST_VALUE);
 
+ NVIC_SetPriority(RNG_IRQn, CFG_HW_RNG_IRQ_PRIO);
+ NVIC_EnableIRQ(RNG_IRQn);
+
  LL_RNG_Enable(RNG);
- while(!LL_RNG_IsActiveFlag_DRDY(RNG)); /*wait for data to be ready*/
 
- pv->run = TRUE;
  SYSTEM_DEBUG_SIGNAL_RESET(RNG_ENABLE);
 }
  
@@ -426,8 +578,11 @@ void HW_RNG_task(void *argument)
 
   while(1)
   {
-    // disable RNG
-    HW_RNG_Disable();   
+    // disable RNG, unless a refill of the pool is on-going
+    if (!HW_RNG_var.run)
+    {
+      HW_RNG_Disable();
+    }
     osThreadSuspend(HW_RNG_taskHandle);
   }
 }
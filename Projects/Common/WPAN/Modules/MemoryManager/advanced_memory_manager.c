@@ -95,16 +95,61 @@ static AMM_VirtualMemoryCallbackHeader_t AmmActiveCallback;
 /**
  * @brief  Push a callback structure into the Pending FIFO
  * @param  p_CallbackElt: Pointer onto the callback to push
+ * @param  VirtualMemoryId: Virtual Memory Identifier of the failed allocation
+ * @param  BufferSize: Size of the failed allocation with a multiple of 32bits
  * @return None
  */
-static inline void pushPending (AMM_VirtualMemoryCallbackFunction_t * const p_CallbackElt);
+static inline void pushPending (AMM_VirtualMemoryCallbackFunction_t * const p_CallbackElt,
+                                const uint8_t VirtualMemoryId,
+                                const uint32_t BufferSize);
 
 /**
- * @brief  Push the Pending callback(s) into the Active FIFO
+ * @brief  Push the Pending callback(s) whose allocation can now succeed into the Active FIFO
  * @return None
  */
 static inline void passPendingToActive (void);
 
+/**
+ * @brief  Get the info of a Virtual Memory
+ * @param  VirtualMemoryId: Virtual Memory Identifier
+ * @return Pointer onto the Virtual Memory info, NULL if the ID is unknown
+ */
+static inline VirtualMemoryInfo_t * getVirtualMemory (const uint8_t VirtualMemoryId);
+
+/**
+ * @brief  Check whether an allocation fits in the currently free memory
+ * @param  VirtualMemoryId: Virtual Memory Identifier - AMM_NO_VIRTUAL_ID Can be used -
+ * @param  BufferSize: Size of the allocation with a multiple of 32bits
+ * @return TRUE if the allocation fits, FALSE otherwise
+ */
+static inline uint8_t isAllocatable (const uint8_t VirtualMemoryId, const uint32_t BufferSize);
+
+#if (AMM_USE_SLAB_CACHE == 1)
+/**
+ * @brief  Allocate and chain the slab cache objects of a Virtual Memory
+ * @param  p_VirtualMemory: Pointer onto the Virtual Memory info
+ * @param  p_Config: Pointer onto the Virtual Memory configuration
+ * @return TRUE if the cache is ready or not configured, FALSE if its allocation failed
+ */
+static inline uint8_t createCache (VirtualMemoryInfo_t * const p_VirtualMemory,
+                                   const AMM_VirtualMemoryConfig_t * const p_Config);
+
+/**
+ * @brief  Pop an object from the slab cache of a Virtual Memory
+ * @param  p_VirtualMemory: Pointer onto the Virtual Memory info
+ * @return Pointer onto the object header, NULL if the cache is empty
+ */
+static inline uint32_t * popCache (VirtualMemoryInfo_t * const p_VirtualMemory);
+
+/**
+ * @brief  Push an object back into the slab cache of a Virtual Memory
+ * @param  p_VirtualMemory: Pointer onto the Virtual Memory info
+ * @param  p_Object: Pointer onto the object header
+ * @return None
+ */
+static inline void pushCache (VirtualMemoryInfo_t * const p_VirtualMemory, uint32_t * const p_Object);
+#endif /* AMM_USE_SLAB_CACHE */
+
 /**
  * @brief  Pop a callback structure from the Active FIFO
  * @return Pointer onto the popped callback
@@ -180,6 +225,10 @@ AMM_Function_Error_t AMM_Init (const AMM_InitParameters_t * const p_InitParams)
 
   uint32_t neededPoolSize = 0x00;
 
+#if (AMM_USE_SLAB_CACHE == 1)
+  uint32_t createdCacheNumber = 0x00;
+#endif /* AMM_USE_SLAB_CACHE */
+
   /* Check if not already initialized */
   if (AmmInitialized == INITIALIZED)
   {
@@ -238,6 +287,18 @@ AMM_Function_Error_t AMM_Init (const AMM_InitParameters_t * const p_InitParams)
       {
         error = AMM_ERROR_BAD_VIRTUAL_CONFIG;
       }
+#if (AMM_USE_SLAB_CACHE == 1)
+      /* Check the slab cache: objects shall hold the free list link and fit in the virtual memory */
+      else if ((p_InitParams->p_VirtualMemoryConfigList[memIdx].CacheObjectSize != 0)
+               && ((p_InitParams->p_VirtualMemoryConfigList[memIdx].CacheObjectNumber == 0)
+                   || ((p_InitParams->p_VirtualMemoryConfigList[memIdx].CacheObjectSize * sizeof (uint32_t)) < sizeof (uint32_t *))
+                   || (p_InitParams->p_VirtualMemoryConfigList[memIdx].BufferSize
+                       < (p_InitParams->p_VirtualMemoryConfigList[memIdx].CacheObjectNumber
+                          * (p_InitParams->p_VirtualMemoryConfigList[memIdx].CacheObjectSize + VIRTUAL_MEMORY_HEADER_SIZE)))))
+      {
+        error = AMM_ERROR_BAD_VIRTUAL_CONFIG;
+      }
+#endif /* AMM_USE_SLAB_CACHE */
       else
       {
         /* Do nothing, all ok yet */
@@ -318,7 +379,7 @@ AMM_Function_Error_t AMM_Init (const AMM_InitParameters_t * const p_InitParams)
 #endif /* AMM_USE_MEMORY_STATISTICS */
 
           for (uint32_t memIdx = 0x00;
-               memIdx < AmmVirtualMemoryNumber;
+               (memIdx < AmmVirtualMemoryNumber) && (error == AMM_ERROR_NOK);
                memIdx++)
           {
             p_AmmVirtualMemoryList[memIdx].Id = p_InitParams->p_VirtualMemoryConfigList[memIdx].Id;
@@ -329,13 +390,49 @@ AMM_Function_Error_t AMM_Init (const AMM_InitParameters_t * const p_InitParams)
 #endif /* AMM_USE_MEMORY_STATISTICS */
 
             AmmRequiredVirtualMemorySize = AmmRequiredVirtualMemorySize + p_AmmVirtualMemoryList[memIdx].RequiredSize;
+
+#if (AMM_USE_SLAB_CACHE == 1)
+            if (createCache (&p_AmmVirtualMemoryList[memIdx], &p_InitParams->p_VirtualMemoryConfigList[memIdx]) == FALSE)
+            {
+              error = AMM_ERROR_BAD_BMM_ALLOCATION;
+            }
+            else
+            {
+              createdCacheNumber++;
+            }
+#endif /* AMM_USE_SLAB_CACHE */
           }
 
-          /* Set init flag */
-          AmmInitialized = INITIALIZED;
+          if (error == AMM_ERROR_NOK)
+          {
+            /* Set init flag */
+            AmmInitialized = INITIALIZED;
 
-          /* All info are stored and AMM is initialized */
-          error = AMM_ERROR_OK;
+            /* All info are stored and AMM is initialized */
+            error = AMM_ERROR_OK;
+          }
+#if (AMM_USE_SLAB_CACHE == 1)
+          else
+          {
+            /* Give back the caches created before the failing one and the virtual memories info */
+            for (uint32_t memIdx = 0x00;
+                 memIdx < createdCacheNumber;
+                 memIdx++)
+            {
+              if (p_AmmVirtualMemoryList[memIdx].p_CacheStart != NULL)
+              {
+                AmmBmmFunctionsHandler.Free (p_AmmVirtualMemoryList[memIdx].p_CacheStart);
+              }
+            }
+
+            AmmBmmFunctionsHandler.Free ((uint32_t *)p_AmmVirtualMemoryList);
+            p_AmmVirtualMemoryList = NULL;
+
+            AmmOccupiedSharedPoolSize = 0x00;
+            AmmRequiredVirtualMemorySize = 0x00;
+            AmmVirtualMemoryNumber = 0x00;
+          }
+#endif /* AMM_USE_SLAB_CACHE */
         }
       }
     }
@@ -352,6 +449,17 @@ AMM_Function_Error_t AMM_DeInit (void)
   if (AmmInitialized == INITIALIZED)
   {
     /* Free resources */
+#if (AMM_USE_SLAB_CACHE == 1)
+    for (uint32_t memIdx = 0x00;
+         memIdx < AmmVirtualMemoryNumber;
+         memIdx++)
+    {
+      if (p_AmmVirtualMemoryList[memIdx].p_CacheStart != NULL)
+      {
+        AmmBmmFunctionsHandler.Free (p_AmmVirtualMemoryList[memIdx].p_CacheStart);
+      }
+    }
+#endif /* AMM_USE_SLAB_CACHE */
     AmmBmmFunctionsHandler.Free ((uint32_t *)p_AmmVirtualMemoryList);
 
     /* Reset all the variables */
@@ -389,6 +497,10 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
 
   uint32_t * p_TmpAllocAddr = NULL;
 
+#if (AMM_USE_SLAB_CACHE == 1)
+  VirtualMemoryInfo_t * p_TmpVirtualMemory = NULL;
+#endif /* AMM_USE_SLAB_CACHE */
+
   /* Set pointer to NULL */
   *pp_AllocBuffer = NULL;
 
@@ -441,7 +553,7 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
       else
       {
         /* Register the callback for a future retry */
-        pushPending (p_CallBackFunction);
+        pushPending (p_CallBackFunction, VirtualMemoryId, BufferSize);
 
         error = AMM_ERROR_ALLOCATION_FAILED;
       }
@@ -449,7 +561,7 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
     else
     {
       /* Register the callback for a future retry */
-      pushPending (p_CallBackFunction);
+      pushPending (p_CallBackFunction, VirtualMemoryId, BufferSize);
 
       error = AMM_ERROR_BAD_ALLOCATION_SIZE;
     }
@@ -457,6 +569,18 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
     /* Exit critical section */
     UTIL_SEQ_EXIT_CRITICAL_SECTION ();
   }
+#if (AMM_USE_SLAB_CACHE == 1)
+  /* A specific ID with a fitting slab cache is requested, try the cache first */
+  else if (((p_TmpVirtualMemory = getVirtualMemory (VirtualMemoryId)) != NULL)
+           && (BufferSize <= p_TmpVirtualMemory->CacheObjectSize)
+           && ((p_TmpAllocAddr = popCache (p_TmpVirtualMemory)) != NULL))
+  {
+    /* Provide the right address to user, ie without the header */
+    *pp_AllocBuffer = (uint32_t *)(p_TmpAllocAddr + VIRTUAL_MEMORY_HEADER_SIZE);
+
+    error = AMM_ERROR_OK;
+  }
+#endif /* AMM_USE_SLAB_CACHE */
   /* A specific ID is requested */
   else
   {
@@ -465,6 +589,20 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
     /* Enter critical section */
     UTIL_SEQ_ENTER_CRITICAL_SECTION ();
 
+#if (AMM_USE_SLAB_CACHE == 1)
+    /* An object may have been given back to the cache since it was found empty, and the pending list walked
+       before this request is registered: check the cache again in the critical section which registers it */
+    if ((p_TmpVirtualMemory != NULL)
+        && (BufferSize <= p_TmpVirtualMemory->CacheObjectSize)
+        && ((p_TmpAllocAddr = popCache (p_TmpVirtualMemory)) != NULL))
+    {
+      /* Provide the right address to user, ie without the header */
+      *pp_AllocBuffer = (uint32_t *)(p_TmpAllocAddr + VIRTUAL_MEMORY_HEADER_SIZE);
+
+      error = AMM_ERROR_OK;
+    }
+#endif /* AMM_USE_SLAB_CACHE */
+
     /* Check virtual memory info */
     for (uint32_t memIdx = 0x00;
          (memIdx < AmmVirtualMemoryNumber) && (error == AMM_ERROR_UNKNOWN_ID);
@@ -533,7 +671,7 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
           else
           {
             /* Register the callback for a future retry */
-            pushPending (p_CallBackFunction);
+            pushPending (p_CallBackFunction, VirtualMemoryId, BufferSize);
 
             error = AMM_ERROR_ALLOCATION_FAILED;
           }
@@ -541,7 +679,7 @@ AMM_Function_Error_t AMM_Alloc (const uint8_t VirtualMemoryId,
         else
         {
           /* Register the callback for a future retry */
-          pushPending (p_CallBackFunction);
+          pushPending (p_CallBackFunction, VirtualMemoryId, BufferSize);
 
           error = AMM_ERROR_BAD_ALLOCATION_SIZE;
         }
@@ -565,6 +703,10 @@ AMM_Function_Error_t AMM_Free (uint32_t * const p_BufferAddr)
 
   uint32_t * p_TmpAllocAddr = NULL;
 
+#if (AMM_USE_SLAB_CACHE == 1)
+  VirtualMemoryInfo_t * p_TmpVirtualMemory = NULL;
+#endif /* AMM_USE_SLAB_CACHE */
+
   if (AmmInitialized == NOT_INITIALIZED)
   {
     error = AMM_ERROR_NOT_INIT;
@@ -583,6 +725,21 @@ AMM_Function_Error_t AMM_Free (uint32_t * const p_BufferAddr)
   {
     error = AMM_ERROR_OUT_OF_RANGE;
   }
+#if (AMM_USE_SLAB_CACHE == 1)
+  /* Check if the buffer is a slab cache object, it then goes back to its cache */
+  else if (((p_TmpVirtualMemory = getVirtualMemory ((*(p_BufferAddr - VIRTUAL_MEMORY_HEADER_SIZE) & VIRTUAL_MEMORY_HEADER_ID_MASK)
+                                                    >> VIRTUAL_MEMORY_HEADER_ID_POS)) != NULL)
+           && ((p_BufferAddr - VIRTUAL_MEMORY_HEADER_SIZE) >= p_TmpVirtualMemory->p_CacheStart)
+           && ((p_BufferAddr - VIRTUAL_MEMORY_HEADER_SIZE) < p_TmpVirtualMemory->p_CacheEnd))
+  {
+    pushCache (p_TmpVirtualMemory, (uint32_t *)(p_BufferAddr - VIRTUAL_MEMORY_HEADER_SIZE));
+
+    error = AMM_ERROR_OK;
+
+    /* Ask the user task to proceed to a background process call */
+    AMM_ProcessRequest();
+  }
+#endif /* AMM_USE_SLAB_CACHE */
   else
   {
     /* Enter critical section */
@@ -680,10 +837,16 @@ void AMM_BackgroundProcess (void)
 
 /* Private Functions Definition ------------------------------------------------------*/
 
-void pushPending (AMM_VirtualMemoryCallbackFunction_t * const p_CallbackElt)
+void pushPending (AMM_VirtualMemoryCallbackFunction_t * const p_CallbackElt,
+                  const uint8_t VirtualMemoryId,
+                  const uint32_t BufferSize)
 {
   if (p_CallbackElt != NULL)
   {
+    /* Keep the request to only retry once it can succeed */
+    p_CallbackElt->VirtualMemoryId = VirtualMemoryId;
+    p_CallbackElt->BufferSize = BufferSize;
+
     /* Add the new callback */
     LST_insert_tail (&AmmPendingCallback, (tListNode *)p_CallbackElt);
   }
@@ -692,13 +855,24 @@ void pushPending (AMM_VirtualMemoryCallbackFunction_t * const p_CallbackElt)
 void passPendingToActive (void)
 {
   AMM_VirtualMemoryCallbackFunction_t * p_TmpElt = NULL;
+  AMM_VirtualMemoryCallbackFunction_t * p_NextElt = NULL;
+
+  /* Walk the pending list in order, the other callbacks keep waiting */
+  LST_get_next_node (&AmmPendingCallback, (tListNode**)&p_TmpElt);
 
-  while (LST_is_empty (&AmmPendingCallback) == FALSE)
+  while ((tListNode *)p_TmpElt != &AmmPendingCallback)
   {
-    /* Remove the head element */
-    LST_remove_head (&AmmPendingCallback, (tListNode**)&p_TmpElt);
-    /* Add at the bottom */
-    LST_insert_tail (&AmmActiveCallback, (tListNode *)p_TmpElt);
+    LST_get_next_node ((tListNode *)p_TmpElt, (tListNode**)&p_NextElt);
+
+    if (isAllocatable (p_TmpElt->VirtualMemoryId, p_TmpElt->BufferSize) == TRUE)
+    {
+      /* Remove the element */
+      LST_remove_node ((tListNode *)p_TmpElt);
+      /* Add at the bottom */
+      LST_insert_tail (&AmmActiveCallback, (tListNode *)p_TmpElt);
+    }
+
+    p_TmpElt = p_NextElt;
   }
 }
 
@@ -714,3 +888,176 @@ AMM_VirtualMemoryCallbackFunction_t * popActive (void)
 
   return p_error;
 }
+
+VirtualMemoryInfo_t * getVirtualMemory (const uint8_t VirtualMemoryId)
+{
+  VirtualMemoryInfo_t * p_error = NULL;
+
+  /* Check virtual memory info */
+  for (uint32_t memIdx = 0x00;
+       (memIdx < AmmVirtualMemoryNumber) && (p_error == NULL);
+       memIdx++)
+  {
+    /* Check if ID is known */
+    if (VirtualMemoryId == p_AmmVirtualMemoryList[memIdx].Id)
+    {
+      p_error = &p_AmmVirtualMemoryList[memIdx];
+    }
+  }
+
+  return p_error;
+}
+
+uint8_t isAllocatable (const uint8_t VirtualMemoryId, const uint32_t BufferSize)
+{
+  uint8_t allocatable = FALSE;
+  uint32_t selfAvailable = 0x00;
+  VirtualMemoryInfo_t * p_TmpVirtualMemory = NULL;
+
+  if (VirtualMemoryId == AMM_NO_VIRTUAL_ID)
+  {
+    /* Same check as the shared pool allocation */
+    allocatable = (BufferSize < (AmmPoolSize - AmmOccupiedSharedPoolSize - AmmRequiredVirtualMemorySize));
+  }
+  else
+  {
+    p_TmpVirtualMemory = getVirtualMemory (VirtualMemoryId);
+
+    if (p_TmpVirtualMemory != NULL)
+    {
+#if (AMM_USE_SLAB_CACHE == 1)
+      /* A free cache object is enough */
+      if ((BufferSize <= p_TmpVirtualMemory->CacheObjectSize) && (p_TmpVirtualMemory->p_CacheFreeList != NULL))
+      {
+        allocatable = TRUE;
+      }
+#endif /* AMM_USE_SLAB_CACHE */
+
+      /* Compute what is remaining in the virtual memory */
+      if (p_TmpVirtualMemory->OccupiedSize < p_TmpVirtualMemory->RequiredSize)
+      {
+        selfAvailable = p_TmpVirtualMemory->RequiredSize - p_TmpVirtualMemory->OccupiedSize;
+      }
+
+      /* Same check as the virtual memory allocation */
+      if (BufferSize < (AmmPoolSize - AmmOccupiedSharedPoolSize - AmmRequiredVirtualMemorySize + selfAvailable))
+      {
+        allocatable = TRUE;
+      }
+    }
+  }
+
+  return allocatable;
+}
+
+#if (AMM_USE_SLAB_CACHE == 1)
+uint8_t createCache (VirtualMemoryInfo_t * const p_VirtualMemory,
+                     const AMM_VirtualMemoryConfig_t * const p_Config)
+{
+  uint8_t created = TRUE;
+  uint32_t cacheSize = p_Config->CacheObjectNumber * (p_Config->CacheObjectSize + VIRTUAL_MEMORY_HEADER_SIZE);
+  uint32_t * p_TmpObject = NULL;
+
+  p_VirtualMemory->CacheObjectSize = 0x00;
+  p_VirtualMemory->p_CacheStart = NULL;
+  p_VirtualMemory->p_CacheEnd = NULL;
+  p_VirtualMemory->p_CacheFreeList = NULL;
+
+  if (p_Config->CacheObjectSize != 0x00)
+  {
+    p_VirtualMemory->p_CacheStart = AmmBmmFunctionsHandler.Allocate (cacheSize);
+
+    if (p_VirtualMemory->p_CacheStart == NULL)
+    {
+      created = FALSE;
+    }
+    else
+    {
+      p_VirtualMemory->CacheObjectSize = p_Config->CacheObjectSize;
+      p_VirtualMemory->p_CacheEnd = p_VirtualMemory->p_CacheStart + cacheSize;
+
+      /* Fulfill the header of every object once for all and chain them in address order */
+      for (uint32_t objIdx = 0x00;
+           objIdx < p_Config->CacheObjectNumber;
+           objIdx++)
+      {
+        p_TmpObject = p_VirtualMemory->p_CacheStart + (objIdx * (p_Config->CacheObjectSize + VIRTUAL_MEMORY_HEADER_SIZE));
+
+        *p_TmpObject = (uint32_t)(((uint32_t)p_VirtualMemory->Id << VIRTUAL_MEMORY_HEADER_ID_POS)
+                                  & VIRTUAL_MEMORY_HEADER_ID_MASK)
+                       | ((p_Config->CacheObjectSize << VIRTUAL_MEMORY_HEADER_BUFFER_SIZE_POS)
+                          & VIRTUAL_MEMORY_HEADER_BUFFER_SIZE_MASK);
+
+        /* The link to the next free object is kept in the object payload */
+        *(uint32_t **)(p_TmpObject + VIRTUAL_MEMORY_HEADER_SIZE) = (objIdx < (p_Config->CacheObjectNumber - 1))
+                                                                   ? (p_TmpObject + p_Config->CacheObjectSize + VIRTUAL_MEMORY_HEADER_SIZE)
+                                                                   : NULL;
+      }
+
+      p_VirtualMemory->p_CacheFreeList = p_VirtualMemory->p_CacheStart;
+
+      /* The cache is part of the virtual memory and stays occupied */
+      p_VirtualMemory->OccupiedSize = cacheSize;
+#if (AMM_USE_MEMORY_STATISTICS == 1)
+      p_VirtualMemory->PeakOccupationSize = cacheSize;
+#endif /* AMM_USE_MEMORY_STATISTICS */
+    }
+  }
+
+  return created;
+}
+
+uint32_t * popCache (VirtualMemoryInfo_t * const p_VirtualMemory)
+{
+  uint32_t * p_error = NULL;
+
+  /* Enter critical section, only around the list head update */
+  UTIL_SEQ_ENTER_CRITICAL_SECTION ();
+
+  p_error = p_VirtualMemory->p_CacheFreeList;
+
+  if (p_error != NULL)
+  {
+    /* The link to the next free object is kept in the object payload */
+    p_VirtualMemory->p_CacheFreeList = *(uint32_t **)(p_error + VIRTUAL_MEMORY_HEADER_SIZE);
+  }
+
+  /* Exit critical section */
+  UTIL_SEQ_EXIT_CRITICAL_SECTION ();
+
+  return p_error;
+}
+
+void pushCache (VirtualMemoryInfo_t * const p_VirtualMemory, uint32_t * const p_Object)
+{
+  uint8_t wasEmpty = FALSE;
+
+  {
+    /* Enter critical section, only around the list head update */
+    UTIL_SEQ_ENTER_CRITICAL_SECTION ();
+
+    wasEmpty = (p_VirtualMemory->p_CacheFreeList == NULL);
+
+    /* The link to the next free object is kept in the object payload */
+    *(uint32_t **)(p_Object + VIRTUAL_MEMORY_HEADER_SIZE) = p_VirtualMemory->p_CacheFreeList;
+    p_VirtualMemory->p_CacheFreeList = p_Object;
+
+    /* Exit critical section */
+    UTIL_SEQ_EXIT_CRITICAL_SECTION ();
+  }
+
+  /* The cache never gives memory back to the pool, so only its first free object can make a pending request
+     succeed: the pending list is walked out of the list head critical section and only in that case */
+  if (wasEmpty == TRUE)
+  {
+    /* Enter critical section */
+    UTIL_SEQ_ENTER_CRITICAL_SECTION ();
+
+    /* Waiting callbacks of this virtual memory may now succeed */
+    passPendingToActive ();
+
+    /* Exit critical section */
+    UTIL_SEQ_EXIT_CRITICAL_SECTION ();
+  }
+}
+#endif /* AMM_USE_SLAB_CACHE */
@@ -102,6 +102,16 @@ typedef enum AMM_Function_Error
    /* Peak occupation of the Virtual Memory buffer with a multiple of 32bits */
    uint32_t PeakOccupationSize;
  #endif /* AMM_USE_MEMORY_STATISTICS */
+ #if (AMM_USE_SLAB_CACHE == 1)
+   /* Size of the slab cache objects with a multiple of 32bits, 0 when there is no cache */
+   uint32_t CacheObjectSize;
+   /* Address of the first slab cache object */
+   uint32_t * p_CacheStart;
+   /* Address following the last slab cache object */
+   uint32_t * p_CacheEnd;
+   /* First free slab cache object */
+   uint32_t * p_CacheFreeList;
+ #endif /* AMM_USE_SLAB_CACHE */
  }VirtualMemoryInfo_t;
 
 /**
@@ -117,6 +127,18 @@ typedef struct AMM_VirtualMemoryConfig
                                    = 4 * 32bits
                                    = 128 bits */
   uint32_t BufferSize;
+#if (AMM_USE_SLAB_CACHE == 1)
+  /* Size of the slab cache objects with a multiple of 32bits, 0 to disable the cache.
+
+     Allocations of this Virtual Memory up to this size are first taken from
+     the cache, without going through the Basic Memory Manager. */
+  uint32_t CacheObjectSize;
+  /* Number of slab cache objects.
+
+     The cache is allocated at initialization and taken from BufferSize:
+     CacheObjectNumber * (CacheObjectSize + 1) shall not exceed BufferSize */
+  uint32_t CacheObjectNumber;
+#endif /* AMM_USE_SLAB_CACHE */
 }AMM_VirtualMemoryConfig_t;
 
 /**
@@ -165,6 +187,10 @@ typedef struct AMM_VirtualMemoryCallbackFunction
   AMM_VirtualMemoryCallbackHeader_t Header;
   /* Callback function pointer to invoke once memory has been freed */
   void (* Callback) (void);
+  /* Virtual Memory ID of the failed allocation - Set by AMM_Alloc - */
+  uint8_t VirtualMemoryId;
+  /* Size of the failed allocation with a multiple of 32bits - Set by AMM_Alloc - */
+  uint32_t BufferSize;
 }AMM_VirtualMemoryCallbackFunction_t;
 
 /* Exported constants --------------------------------------------------------*/
@@ -254,7 +280,8 @@ AMM_Function_Error_t AMM_Free (uint32_t * const p_BufferAddr);
 
 /**
  * @brief  Background routine
- * @details Background routine that aims to call registered callbacks for an allocation retry
+ * @details Background routine that aims to call registered callbacks for an allocation retry.
+ *          Only the callbacks whose allocation request fits in the freed memory are called
  * @return None
  */
 void AMM_BackgroundProcess (void);
@@ -43,9 +43,12 @@
   */
 
 /*
- * A sample implementation of pvPortMalloc() and vPortFree() that combines
- * (coalescences) adjacent memory blocks as they are freed, and in so doing
- * limits memory fragmentation.
+ * An implementation of pvPortMalloc() and vPortFree() based on a two-level
+ * segregated fit (TLSF) allocator.  Free blocks are kept in lists indexed by
+ * size class, and two bitmaps give the first non empty list large enough for a
+ * request, so allocation and free run in constant time whatever the number of
+ * free blocks.  Adjacent memory blocks are combined (coalescenced) as they are
+ * freed through boundary tags, which limits memory fragmentation.
  *
  * See heap_1.c, heap_2.c and heap_3.c for alternative implementations, and the
  * memory management pages of https://www.FreeRTOS.org for more information.
@@ -110,8 +113,23 @@
 
 #endif
 
-/* Block sizes must not get too small. */
-#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
+/* Two-level segregated fit parameters.  The first level splits the block sizes
+ * in powers of two, the second level splits each power of two range in
+ * heapSL_INDEX_COUNT linear sub-ranges.  Blocks smaller than
+ * heapSMALL_BLOCK_SIZE are all kept in the first level list 0. */
+#define heapSL_INDEX_COUNT_LOG2   ( 4U )
+#define heapSL_INDEX_COUNT        ( 1U << heapSL_INDEX_COUNT_LOG2 )
+#define heapALIGN_SIZE_LOG2       ( ( portBYTE_ALIGNMENT == 8 ) ? 3U : 2U )
+#define heapFL_INDEX_SHIFT        ( heapSL_INDEX_COUNT_LOG2 + heapALIGN_SIZE_LOG2 )
+#define heapSMALL_BLOCK_SIZE      ( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Largest first level index: blocks (and so the managed pool) are limited to
+ * 2^( heapFL_INDEX_MAX + 1 ) bytes. */
+#ifndef heapFL_INDEX_MAX
+#define heapFL_INDEX_MAX          ( 18U )
+#endif
+#define heapFL_INDEX_COUNT        ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 2U )
+#define heapMAXIMUM_BLOCK_SIZE    ( ( ( size_t ) 1 << ( heapFL_INDEX_MAX + 1U ) ) - portBYTE_ALIGNMENT )
 
 /* Assumes 8bit bytes! */
 #define heapBITS_PER_BYTE         ( ( size_t ) 8 )
@@ -128,24 +146,42 @@
 #endif /* configAPPLICATION_ALLOCATED_HEAP */
 #endif
 
-/* Define the linked list structure.  This is used to link free blocks in order
- * of their memory address. */
+/* Define the block header.  Every block, free or allocated, starts with the
+ * link to the block physically in front of it and its own size (boundary tags),
+ * so a freed block finds both neighbours in constant time.  The free list links
+ * are only valid in free blocks and overlap the payload of allocated blocks. */
 typedef struct A_BLOCK_LINK
 {
-    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the list. */
-    size_t xBlockSize;                     /*<< The size of the free block. */
+    struct A_BLOCK_LINK * pxPrevPhysBlock; /*<< The block physically in front of this one, NULL for the first block. */
+    size_t xBlockSize;                     /*<< The size of the block, header included. */
+    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the same segregated list. */
+    struct A_BLOCK_LINK * pxPrevFreeBlock; /*<< The previous free block in the same segregated list. */
 } BlockLink_t;
 
 /*-----------------------------------------------------------*/
 
 /*
- * Inserts a block of memory that is being freed into the correct position in
- * the list of free memory blocks.  The block being freed will be merged with
- * the block in front it and/or the block behind it if the memory blocks are
- * adjacent to each other.
+ * Compute the first and second level indexes of the list holding blocks of
+ * xBlockSize bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize, uint32_t * pulFl, uint32_t * pulSl ) PRIVILEGED_FUNCTION;
+
+/*
+ * Find a free block of at least xWantedSize bytes and remove it from its
+ * free list.  Returns NULL when no such block exists.
+ */
+static BlockLink_t * prvTakeSuitableBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a free block at the head of its segregated list.
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
 
+/*
+ * Remove a free block from its segregated list.
+ */
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) PRIVILEGED_FUNCTION;
+
 /*
  * Called automatically to setup the required heap structures the first time
  * pvPortMalloc() is called.
@@ -156,12 +192,23 @@ static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
 
 /*-----------------------------------------------------------*/
 
-/* The size of the structure placed at the beginning of each allocated memory
- * block must by correctly byte aligned. */
-static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+/* The size of the header placed at the beginning of each allocated memory
+ * block must by correctly byte aligned.  The free list links are not part of it. */
+static const size_t xHeapStructSize = ( sizeof( BlockLink_t * ) + sizeof( size_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small: a free block has to hold its list links. */
+#define heapMINIMUM_BLOCK_SIZE    ( ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
 
-/* Create a couple of list links to mark the start and end of the list. */
-PRIVILEGED_DATA static BlockLink_t xStart, * pxEnd = NULL;
+/* Marks the end of the heap.  It is an allocated block of size 0, so a freed
+ * block is never merged past it. */
+PRIVILEGED_DATA static BlockLink_t * pxEnd = NULL;
+
+/* Segregated free lists, and the bitmaps of the non empty ones: bit n of
+ * ulFlBitmap is set when ulSlBitmap[ n ] is not 0, bit m of ulSlBitmap[ n ] is
+ * set when pxFreeLists[ n ][ m ] is not empty. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFlBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSlBitmap[ heapFL_INDEX_COUNT ];
 
 /* Keeps track of the number of calls to allocate and free memory as well as the
  * number of free bytes remaining, but says nothing about fragmentation. */
@@ -176,6 +223,15 @@ PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
  * space. */
 PRIVILEGED_DATA static size_t xBlockAllocatedBit = 0;
 
+/* Index of the most / least significant bit set in a non zero value, with
+ * the CMSIS intrinsics: a single CLZ, or RBIT then CLZ, on the Cortex-M33. */
+#define heapFLS( x )              ( 31U - ( uint32_t ) __CLZ( ( uint32_t ) ( x ) ) )
+#define heapFFS( x )              ( ( uint32_t ) __CLZ( __RBIT( ( uint32_t ) ( x ) ) ) )
+
+/* Block physically following pxBlock. */
+#define heapNEXT_PHYS_BLOCK( pxBlock )    ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + ( ( pxBlock )->xBlockSize & ~xBlockAllocatedBit ) ) )
+#define heapBLOCK_IS_FREE( pxBlock )      ( ( ( pxBlock )->xBlockSize & xBlockAllocatedBit ) == 0 )
+
 /*-----------------------------------------------------------*/
 #if (KEEP_ORIGINAL_CODE_FROM_FREERTOS == 0)
 void * UTIL_MM_GetBuffer( size_t xWantedSize )
@@ -183,7 +239,7 @@ void * UTIL_MM_GetBuffer( size_t xWantedSize )
 void * pvPortMalloc( size_t xWantedSize )
 #endif
 {
-    BlockLink_t * pxBlock, * pxPreviousBlock, * pxNewBlockLink;
+    BlockLink_t * pxBlock, * pxNewBlockLink;
     void * pvReturn = NULL;
 
     vTaskSuspendAll();
@@ -201,64 +257,45 @@ void * pvPortMalloc( size_t xWantedSize )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        /* Check the requested block size is not so large that the top bit is
-         * set.  The top bit of the block size member of the BlockLink_t structure
-         * is used to determine who owns the block - the application or the
-         * kernel, so it must be free. */
-        if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+        /* Reject sizes that cannot be stored in a single block. */
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= ( heapMAXIMUM_BLOCK_SIZE - xHeapStructSize ) ) )
         {
-            /* The wanted size is increased so it can contain a BlockLink_t
-             * structure in addition to the requested amount of bytes. */
-            if( xWantedSize > 0 )
+            /* The wanted size is increased so it can contain the block header
+             * in addition to the requested amount of bytes, and the block must
+             * be able to hold the free list links once it is released. */
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+             * of bytes. */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
             {
-                xWantedSize += xHeapStructSize;
-
-                /* Ensure that blocks are always aligned to the required number
-                 * of bytes. */
-                if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
-                {
-                    /* Byte alignment required. */
-                    xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
-                    configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                /* Byte alignment required. */
+                xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+                configASSERT( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) == 0 );
             }
             else
             {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
             {
-                /* Traverse the list from the start (lowest address) block until
-                 * one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
+                xWantedSize = heapMINIMUM_BLOCK_SIZE;
+            }
 
-                while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
-                {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
+            if( xWantedSize <= xFreeBytesRemaining )
+            {
+                pxBlock = prvTakeSuitableBlock( xWantedSize );
 
-                /* If the end marker was reached then a block of adequate size
-                 * was not found. */
-                if( pxBlock != pxEnd )
+                if( pxBlock != NULL )
                 {
                     /* Return the memory space pointed to - jumping over the
-                     * BlockLink_t structure at its start. */
-                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + xHeapStructSize );
-
-                    /* This block is being returned for use so must be taken out
-                     * of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+                     * block header. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
 
                     /* If the block is larger than required it can be split into
                      * two. */
-                    if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
                     {
                         /* This block is to be split into two.  Create a new
                          * block following the number of bytes requested. The void
@@ -268,11 +305,15 @@ void * pvPortMalloc( size_t xWantedSize )
                         configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
 
                         /* Calculate the sizes of two blocks split from the
-                         * single block. */
+                         * single block and update the boundary tags. */
                         pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxNewBlockLink->pxPrevPhysBlock = pxBlock;
+                        heapNEXT_PHYS_BLOCK( pxNewBlockLink )->pxPrevPhysBlock = pxNewBlockLink;
                         pxBlock->xBlockSize = xWantedSize;
 
-                        /* Insert the new block into the list of free blocks. */
+                        /* The block following the split one is allocated (free
+                         * neighbours are always merged), so the remainder is
+                         * inserted without merging. */
                         prvInsertBlockIntoFreeList( pxNewBlockLink );
                     }
                     else
@@ -292,9 +333,8 @@ void * pvPortMalloc( size_t xWantedSize )
                     }
 
                     /* The block is being returned - it is allocated and owned
-                     * by the application and has no "next" block. */
+                     * by the application. */
                     pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
                     xNumberOfSuccessfulAllocations++;
                 }
                 else
@@ -341,11 +381,11 @@ void vPortFree( void * pv )
 #endif
 {
     uint8_t * puc = ( uint8_t * ) pv;
-    BlockLink_t * pxLink;
+    BlockLink_t * pxLink, * pxNeighbour;
 
     if( pv != NULL )
     {
-        /* The memory being freed will have an BlockLink_t structure immediately
+        /* The memory being freed will have a block header immediately
          * before it. */
         puc -= xHeapStructSize;
 
@@ -354,30 +394,53 @@ void vPortFree( void * pv )
 
         /* Check the block is actually allocated. */
         configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
-        configASSERT( pxLink->pxNextFreeBlock == NULL );
 
         if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
         {
-            if( pxLink->pxNextFreeBlock == NULL )
+            /* The block is being returned to the heap - it is no longer
+             * allocated. */
+            pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+            vTaskSuspendAll();
             {
-                /* The block is being returned to the heap - it is no longer
-                 * allocated. */
-                pxLink->xBlockSize &= ~xBlockAllocatedBit;
+                xFreeBytesRemaining += pxLink->xBlockSize;
+                traceFREE( pv, pxLink->xBlockSize );
 
-                vTaskSuspendAll();
+                /* Merge with the block physically in front of it if free. */
+                pxNeighbour = pxLink->pxPrevPhysBlock;
+
+                if( ( pxNeighbour != NULL ) && heapBLOCK_IS_FREE( pxNeighbour ) )
                 {
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE( pv, pxLink->xBlockSize );
-                    prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
-                    xNumberOfSuccessfulFrees++;
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxLink->xBlockSize;
+                    pxLink = pxNeighbour;
+                    heapNEXT_PHYS_BLOCK( pxLink )->pxPrevPhysBlock = pxLink;
                 }
-                ( void ) xTaskResumeAll();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the block physically behind it if free.  pxEnd is
+                 * marked allocated, so this never runs past the heap. */
+                pxNeighbour = heapNEXT_PHYS_BLOCK( pxLink );
+
+                if( heapBLOCK_IS_FREE( pxNeighbour ) )
+                {
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxLink->xBlockSize += pxNeighbour->xBlockSize;
+                    heapNEXT_PHYS_BLOCK( pxLink )->pxPrevPhysBlock = pxLink;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Add this block to the list of free blocks. */
+                prvInsertBlockIntoFreeList( pxLink );
+                xNumberOfSuccessfulFrees++;
             }
+            ( void ) xTaskResumeAll();
         }
         else
         {
@@ -412,7 +475,9 @@ void UTIL_MM_Init(uint8_t *p_pool, uint32_t pool_size)
     BlockLink_t * pxFirstFreeBlock;
     uint8_t * pucAlignedHeap;
     size_t uxAddress;
+    uint32_t ulFl, ulSl;
 #if (KEEP_ORIGINAL_CODE_FROM_FREERTOS != 0)
+    uint8_t * p_pool = ucHeap;
     size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 #else
     size_t xTotalHeapSize;
@@ -431,95 +496,196 @@ void UTIL_MM_Init(uint8_t *p_pool, uint32_t pool_size)
 
     pucAlignedHeap = ( uint8_t * ) uxAddress;
 
-    /* xStart is used to hold a pointer to the first item in the list of free
-     * blocks.  The void cast is used to prevent compiler warnings. */
-    xStart.pxNextFreeBlock = ( void * ) pucAlignedHeap;
-    xStart.xBlockSize = ( size_t ) 0;
+    /* The first block plus pxEnd must fit in the largest block size handled
+     * by the segregated lists: the exceeding part of the pool is not used. */
+    if( xTotalHeapSize > heapMAXIMUM_BLOCK_SIZE )
+    {
+        xTotalHeapSize = heapMAXIMUM_BLOCK_SIZE;
+    }
 
-    /* pxEnd is used to mark the end of the list of free blocks and is inserted
-     * at the end of the heap space. */
+    /* All segregated lists are empty. */
+    for( ulFl = 0; ulFl < heapFL_INDEX_COUNT; ulFl++ )
+    {
+        for( ulSl = 0; ulSl < heapSL_INDEX_COUNT; ulSl++ )
+        {
+            pxFreeLists[ ulFl ][ ulSl ] = NULL;
+        }
+
+        ulSlBitmap[ ulFl ] = 0U;
+    }
+
+    ulFlBitmap = 0U;
+
+    /* Work out the position of the top bit in a size_t variable. */
+    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+    /* pxEnd is used to mark the end of the heap and is inserted at the end of
+     * the heap space. */
     uxAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
     uxAddress -= xHeapStructSize;
     uxAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
     pxEnd = ( void * ) uxAddress;
-    pxEnd->xBlockSize = 0;
-    pxEnd->pxNextFreeBlock = NULL;
 
     /* To start with there is a single free block that is sized to take up the
      * entire heap space, minus the space taken by pxEnd. */
     pxFirstFreeBlock = ( void * ) pucAlignedHeap;
+    pxFirstFreeBlock->pxPrevPhysBlock = NULL;
     pxFirstFreeBlock->xBlockSize = uxAddress - ( size_t ) pxFirstFreeBlock;
-    pxFirstFreeBlock->pxNextFreeBlock = pxEnd;
+
+    pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+    pxEnd->xBlockSize = xBlockAllocatedBit;
+
+    prvInsertBlockIntoFreeList( pxFirstFreeBlock );
 
     /* Only one block exists - and it covers the entire usable heap space. */
     xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
     xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
-
-    /* Work out the position of the top bit in a size_t variable. */
-    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
 }
 /*-----------------------------------------------------------*/
 
-static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+static void prvMappingInsert( size_t xBlockSize, uint32_t * pulFl, uint32_t * pulSl ) /* PRIVILEGED_FUNCTION */
 {
-    BlockLink_t * pxIterator;
-    uint8_t * puc;
+    uint32_t ulFl;
 
-    /* Iterate through the list until a block is found that has a higher address
-     * than the block being inserted. */
-    for( pxIterator = &xStart; pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
     {
-        /* Nothing to do here, just iterate to the right position. */
+        /* Small blocks are linearly spread over the first level list 0. */
+        *pulFl = 0U;
+        *pulSl = ( uint32_t ) xBlockSize >> heapALIGN_SIZE_LOG2;
     }
-
-    /* Do the block being inserted, and the block it is being inserted after
-     * make a contiguous block of memory? */
-    puc = ( uint8_t * ) pxIterator;
-
-    if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+    else
     {
-        pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
-        pxBlockToInsert = pxIterator;
+        ulFl = heapFLS( ( uint32_t ) xBlockSize );
+        *pulSl = ( ( uint32_t ) ( xBlockSize >> ( ulFl - heapSL_INDEX_COUNT_LOG2 ) ) ) ^ heapSL_INDEX_COUNT;
+        *pulFl = ulFl - ( heapFL_INDEX_SHIFT - 1U );
     }
-    else
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvTakeSuitableBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxBlock = NULL;
+    size_t xRoundedSize = xWantedSize;
+    uint32_t ulFl, ulSl, ulSlMap, ulFlMap;
+
+    /* Round the size up to the next list boundary, so any block of the list
+     * found below is large enough and no list has to be walked (good fit). */
+    if( xWantedSize >= heapSMALL_BLOCK_SIZE )
     {
-        mtCOVERAGE_TEST_MARKER();
+        xRoundedSize += ( ( size_t ) 1 << ( heapFLS( ( uint32_t ) xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
     }
 
-    /* Do the block being inserted, and the block it is being inserted before
-     * make a contiguous block of memory? */
-    puc = ( uint8_t * ) pxBlockToInsert;
+    prvMappingInsert( xRoundedSize, &ulFl, &ulSl );
 
-    if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+    if( ulFl < heapFL_INDEX_COUNT )
     {
-        if( pxIterator->pxNextFreeBlock != pxEnd )
+        /* First non empty list at this first level, from ulSl upward. */
+        ulSlMap = ulSlBitmap[ ulFl ] & ( ~0U << ulSl );
+
+        if( ulSlMap == 0U )
         {
-            /* Form one big block from the two blocks. */
-            pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
-            pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+            /* None: first non empty first level above ulFl. */
+            ulFlMap = ( ulFl + 1U < 32U ) ? ( ulFlBitmap & ( ~0U << ( ulFl + 1U ) ) ) : 0U;
+
+            if( ulFlMap != 0U )
+            {
+                ulFl = heapFFS( ulFlMap );
+                ulSlMap = ulSlBitmap[ ulFl ];
+            }
         }
-        else
+
+        if( ulSlMap != 0U )
         {
-            pxBlockToInsert->pxNextFreeBlock = pxEnd;
+            ulSl = heapFFS( ulSlMap );
+            pxBlock = pxFreeLists[ ulFl ][ ulSl ];
         }
     }
+
+    /* Rounding up can skip the only block that fits, when the heap is almost
+     * full: walk the list of the exact size as a last resort. */
+    if( pxBlock == NULL )
+    {
+        prvMappingInsert( xWantedSize, &ulFl, &ulSl );
+
+        if( ulFl < heapFL_INDEX_COUNT )
+        {
+            for( pxBlock = pxFreeLists[ ulFl ][ ulSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                if( pxBlock->xBlockSize >= xWantedSize )
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if( pxBlock != NULL )
+    {
+        prvRemoveBlockFromFreeList( pxBlock );
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+{
+    uint32_t ulFl, ulSl;
+
+    prvMappingInsert( pxBlockToInsert->xBlockSize, &ulFl, &ulSl );
+
+    pxBlockToInsert->pxPrevFreeBlock = NULL;
+    pxBlockToInsert->pxNextFreeBlock = pxFreeLists[ ulFl ][ ulSl ];
+
+    if( pxBlockToInsert->pxNextFreeBlock != NULL )
+    {
+        pxBlockToInsert->pxNextFreeBlock->pxPrevFreeBlock = pxBlockToInsert;
+    }
     else
     {
-        pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+        mtCOVERAGE_TEST_MARKER();
     }
 
-    /* If the block being inserted plugged a gab, so was merged with the block
-     * before and the block after, then it's pxNextFreeBlock pointer will have
-     * already been set, and should not be set here as that would make it point
-     * to itself. */
-    if( pxIterator != pxBlockToInsert )
+    pxFreeLists[ ulFl ][ ulSl ] = pxBlockToInsert;
+    ulFlBitmap |= ( 1U << ulFl );
+    ulSlBitmap[ ulFl ] |= ( 1U << ulSl );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) /* PRIVILEGED_FUNCTION */
+{
+    uint32_t ulFl, ulSl;
+
+    prvMappingInsert( pxBlockToRemove->xBlockSize, &ulFl, &ulSl );
+
+    if( pxBlockToRemove->pxNextFreeBlock != NULL )
     {
-        pxIterator->pxNextFreeBlock = pxBlockToInsert;
+        pxBlockToRemove->pxNextFreeBlock->pxPrevFreeBlock = pxBlockToRemove->pxPrevFreeBlock;
     }
     else
     {
         mtCOVERAGE_TEST_MARKER();
     }
+
+    if( pxBlockToRemove->pxPrevFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxPrevFreeBlock->pxNextFreeBlock = pxBlockToRemove->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list. */
+        pxFreeLists[ ulFl ][ ulSl ] = pxBlockToRemove->pxNextFreeBlock;
+
+        if( pxFreeLists[ ulFl ][ ulSl ] == NULL )
+        {
+            ulSlBitmap[ ulFl ] &= ~( 1U << ulSl );
+
+            if( ulSlBitmap[ ulFl ] == 0U )
+            {
+                ulFlBitmap &= ~( 1U << ulFl );
+            }
+        }
+    }
 }
 /*-----------------------------------------------------------*/
 #if (KEEP_ORIGINAL_CODE_FROM_FREERTOS != 0)
@@ -527,35 +693,41 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 {
     BlockLink_t * pxBlock;
     size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    uint32_t ulFlMap, ulSlMap, ulFl, ulSl;
 
     vTaskSuspendAll();
     {
-        pxBlock = xStart.pxNextFreeBlock;
+        /* Only the non empty segregated lists are visited. */
+        ulFlMap = ulFlBitmap;
 
-        /* pxBlock will be NULL if the heap has not been initialised.  The heap
-         * is initialised automatically when the first allocation is made. */
-        if( pxBlock != NULL )
+        while( ulFlMap != 0U )
         {
-            do
+            ulFl = heapFFS( ulFlMap );
+            ulFlMap &= ~( 1U << ulFl );
+            ulSlMap = ulSlBitmap[ ulFl ];
+
+            while( ulSlMap != 0U )
             {
-                /* Increment the number of blocks and record the largest block seen
-                 * so far. */
-                xBlocks++;
+                ulSl = heapFFS( ulSlMap );
+                ulSlMap &= ~( 1U << ulSl );
 
-                if( pxBlock->xBlockSize > xMaxSize )
+                for( pxBlock = pxFreeLists[ ulFl ][ ulSl ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
                 {
-                    xMaxSize = pxBlock->xBlockSize;
-                }
+                    /* Increment the number of blocks and record the largest block seen
+                     * so far. */
+                    xBlocks++;
 
-                if( pxBlock->xBlockSize < xMinSize )
-                {
-                    xMinSize = pxBlock->xBlockSize;
-                }
+                    if( pxBlock->xBlockSize > xMaxSize )
+                    {
+                        xMaxSize = pxBlock->xBlockSize;
+                    }
 
-                /* Move to the next block in the chain until the last block is
-                 * reached. */
-                pxBlock = pxBlock->pxNextFreeBlock;
-            } while( pxBlock != pxEnd );
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+                }
+            }
         }
     }
     ( void ) xTaskResumeAll();
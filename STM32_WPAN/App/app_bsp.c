@@ -37,13 +37,25 @@ typedef struct
   UTIL_TIMER_Object_t longTimerId;
   uint8_t             longPressed;
   uint32_t            waitingTime;
+  uint32_t            lastEdgeTime;       /* Tick of the last accepted EXTI edge or of the release. */
+  uint32_t            debounceTime;       /* Edges closer than this to the last accepted one or release are ignored. */
+  uint32_t            longPressThreshold; /* Press duration reported as a 'long press'. */
 } ButtonDesc_t;
 #endif /* (CFG_BUTTON_SUPPORTED == 1) */
 
+#ifdef CFG_BSP_ON_FREERTOS
+typedef struct
+{
+  uint32_t            timestamp;          /* Tick when the event was posted. */
+  uint8_t             inputId;            /* APP_BSP_Input_t or BSP_INPUT_JOYSTICK_SAMPLE. */
+} BspInputEvent_t;
+#endif /* CFG_BSP_ON_FREERTOS */
+
 /* Private defines -----------------------------------------------------------*/
 #if (CFG_BUTTON_SUPPORTED == 1)
 #define BUTTON_LONG_PRESS_SAMPLE_MS           (50u)     /* Sample button level rate in milli seconds. */
 #define BUTTON_LONG_PRESS_THRESHOLD_MS        (500u)    /* Long pression time threshold in milli seconds. */
+#define BUTTON_DEBOUNCE_MS                    (30u)     /* Contact bounce filtering time in milli seconds. */
 #ifdef CFG_BSP_ON_CEB
 #define BUTTON_NB_MAX                         (B2 + 1u)
 #else /* CFG_BSP_ON_CEB */
@@ -51,7 +63,21 @@ typedef struct
 #endif /* CFG_BSP_ON_CEB */
 #endif /* (CFG_BUTTON_SUPPORTED == 1) */
 
-#ifndef CFG_BSP_ON_SEQUENCER
+#ifdef CFG_BSP_ON_FREERTOS
+/* Input Dispatch Task related defines (one task for all Buttons & Joystick) */
+#if (CFG_BUTTON_SUPPORTED == 1)
+#define TASK_STACK_SIZE_BSP_INPUT             TASK_STACK_SIZE_BUTTON_Bx
+#define TASK_PRIO_BSP_INPUT                   TASK_PRIO_BUTTON_Bx
+#else /* (CFG_BUTTON_SUPPORTED == 1) */
+#define TASK_STACK_SIZE_BSP_INPUT             TASK_STACK_SIZE_JOYSTICK_x
+#define TASK_PRIO_BSP_INPUT                   TASK_PRIO_JOYSTICK_x
+#endif /* (CFG_BUTTON_SUPPORTED == 1) */
+
+#define BSP_INPUT_QUEUE_SIZE                  (8u)      /* Number of pending input events. */
+#define BSP_INPUT_JOYSTICK_SAMPLE             ( (uint8_t)APP_BSP_INPUT_NB )   /* Internal event : sample the Joystick. */
+#endif /* CFG_BSP_ON_FREERTOS */
+
+#ifdef CFG_BSP_ON_THREADX
 #if (CFG_BUTTON_SUPPORTED == 1)
 /* Push Button B1 Task related defines */
 #define TASK_STACK_SIZE_BUTTON_B1             TASK_STACK_SIZE_BUTTON_Bx
@@ -106,7 +132,7 @@ typedef struct
 #define TASK_PREEMP_JOYSTICK_NONE             TASK_PREEMP_JOYSTICK_x
 
 #endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
-#endif /* CFG_BSP_ON_SEQUENCER */
+#endif /* CFG_BSP_ON_THREADX */
 
 #if (CFG_JOYSTICK_SUPPORTED == 1)
 #define JOYSTICK_PRESS_SAMPLE_MS              (100u)    /* Sample Joystick level rate in milli seconds. */
@@ -137,130 +163,17 @@ const JOYPin_TypeDef eJoystickStateList[] = { JOY_DOWN, JOY_RIGHT, JOY_LEFT, JOY
 #endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
 
 #ifdef CFG_BSP_ON_FREERTOS
-#if (CFG_JOYSTICK_SUPPORTED == 1)
-/* FreeRtos Joystick Sample stack attributes */
-const osThreadAttr_t JoystickSampleThreadAttributes =
-{
-  .name         = "Joystick Sample Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_SAMPLE,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_SAMPLE
-};
-
-/* FreeRtos Joystick Up stack attributes */
-const osThreadAttr_t JoystickUpThreadAttributes =
-{
-  .name         = "Joystick Up Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_UP,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_UP
-};
-
-/* FreeRtos Joystick Right stack attributes */
-const osThreadAttr_t JoystickRightThreadAttributes =
-{
-  .name         = "Joystick Up Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_RIGHT,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_RIGHT
-};
-
-/* FreeRtos Joystick Down stack attributes */
-const osThreadAttr_t JoystickDownThreadAttributes =
-{
-  .name         = "Joystick Down Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_DOWN,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_DOWN
-};
-
-/* FreeRtos Joystick Left stack attributes */
-const osThreadAttr_t JoystickLeftThreadAttributes =
-{
-  .name         = "Joystick Left Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_LEFT,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_LEFT
-};
-
-/* FreeRtos Joystick Select stack attributes */
-const osThreadAttr_t JoystickSelectThreadAttributes =
-{
-  .name         = "Joystick Select Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_SELECT,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_SELECT
-};
-
-/* FreeRtos Joystick None stack attributes */
-const osThreadAttr_t JoystickNoneThreadAttributes =
-{
-  .name         = "Joystick None Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_JOYSTICK_NONE,
-  .stack_size   = TASK_STACK_SIZE_JOYSTICK_NONE
-};
-
-#endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
-#if (CFG_BUTTON_SUPPORTED == 1)
-
-/* FreeRtos PushButton B1 stacks attributes */
-const osThreadAttr_t ButtonB1ThreadAttributes =
-{
-  .name         = "PushButton B1 Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_BUTTON_B1,
-  .stack_size   = TASK_STACK_SIZE_BUTTON_B1
-};
-
-/* FreeRtos PushButton B2 stacks attributes */
-const osThreadAttr_t ButtonB2ThreadAttributes =
+/* FreeRtos Input Dispatch stack attributes */
+const osThreadAttr_t BspInputThreadAttributes =
 {
-  .name         = "PushButton B2 Thread",
+  .name         = "BSP Input Thread",
   .attr_bits    = TASK_DEFAULT_ATTR_BITS,
   .cb_mem       = TASK_DEFAULT_CB_MEM,
   .cb_size      = TASK_DEFAULT_CB_SIZE,
   .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_BUTTON_B2,
-  .stack_size   = TASK_STACK_SIZE_BUTTON_B2
+  .priority     = TASK_PRIO_BSP_INPUT,
+  .stack_size   = TASK_STACK_SIZE_BSP_INPUT
 };
-
-/* FreeRtos PushButton B3 stacks attributes */
-const osThreadAttr_t ButtonB3ThreadAttributes =
-{
-  .name         = "PushButton B3 Thread",
-  .attr_bits    = TASK_DEFAULT_ATTR_BITS,
-  .cb_mem       = TASK_DEFAULT_CB_MEM,
-  .cb_size      = TASK_DEFAULT_CB_SIZE,
-  .stack_mem    = TASK_DEFAULT_STACK_MEM,
-  .priority     = TASK_PRIO_BUTTON_B3,
-  .stack_size   = TASK_STACK_SIZE_BUTTON_B3
-};
-#endif /* (CFG_BUTTON_SUPPORTED == 1) */
 #endif /* CFG_BSP_ON_FREERTOS */
 
 /* Private variables ---------------------------------------------------------*/
@@ -270,15 +183,19 @@ const osThreadAttr_t ButtonB3ThreadAttributes =
 TX_SEMAPHORE                ButtonB1Semaphore, ButtonB2Semaphore, ButtonB3Semaphore;
 static TX_THREAD            ButtonB1Thread, ButtonB2Thread, ButtonB3Thread;
 #endif /* CFG_BSP_ON_THREADX */
-#ifdef CFG_BSP_ON_FREERTOS
-osSemaphoreId_t             ButtonB1Semaphore, ButtonB2Semaphore, ButtonB3Semaphore;
-static osThreadId_t         ButtonB1Thread, ButtonB2Thread, ButtonB3Thread;
-#endif /* CFG_BSP_ON_FREERTOS */
 #ifdef CFG_BSP_ON_CEB
-static ButtonDesc_t         buttonDesc[BUTTON_NB_MAX] = { { B2, { 0 } , 0, 0 } };
+static ButtonDesc_t         buttonDesc[BUTTON_NB_MAX] =
+{
+  { B2, { 0 }, 0, 0, 0, BUTTON_DEBOUNCE_MS, BUTTON_LONG_PRESS_THRESHOLD_MS }
+};
 #endif /* CFG_BSP_ON_CEB */
 #ifdef CFG_BSP_ON_NUCLEO
-static ButtonDesc_t         buttonDesc[BUTTON_NB_MAX] = { { B1, { 0 }, 0, 0 } , { B2, { 0 } , 0, 0 }, { B3, { 0 }, 0, 0 } };
+static ButtonDesc_t         buttonDesc[BUTTON_NB_MAX] =
+{
+  { B1, { 0 }, 0, 0, 0, BUTTON_DEBOUNCE_MS, BUTTON_LONG_PRESS_THRESHOLD_MS },
+  { B2, { 0 }, 0, 0, 0, BUTTON_DEBOUNCE_MS, BUTTON_LONG_PRESS_THRESHOLD_MS },
+  { B3, { 0 }, 0, 0, 0, BUTTON_DEBOUNCE_MS, BUTTON_LONG_PRESS_THRESHOLD_MS }
+};
 #endif /* CFG_BSP_ON_NUCLEO */
 #endif /* (CFG_BUTTON_SUPPORTED == 1) */
 
@@ -292,12 +209,14 @@ TX_SEMAPHORE                JoystickUpSemaphore, JoystickRightSemaphore, Joystic
 static TX_SEMAPHORE         JoystickSampleSemaphore;
 static TX_THREAD            JoystickSampleThread, JoystickUpThread, JoystickRightThread, JoystickDownThread, JoystickLeftThread, JoystickSelectThread, JoystickNoneThread;
 #endif /* CFG_BSP_ON_THREADX */
+#endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
+
 #ifdef CFG_BSP_ON_FREERTOS
-osSemaphoreId_t             JoystickUpSemaphore, JoystickRightSemaphore, JoystickDownSemaphore, JoystickLeftSemaphore, JoystickSelectSemaphore, JoystickNoneSemaphore;
-static osSemaphoreId_t      JoystickSampleSemaphore;
-static osThreadId_t         JoystickSampleThread, JoystickUpThread, JoystickRightThread, JoystickDownThread, JoystickLeftThread, JoystickSelectThread, JoystickNoneThread;
+/* Input dispatch : one queue & one task for all Buttons & Joystick actions */
+static osMessageQueueId_t     BspInputQueue;
+static osThreadId_t           BspInputThread;
+static APP_BSP_InputHandler_t BspInputHandlerTable[APP_BSP_INPUT_NB];
 #endif /* CFG_BSP_ON_FREERTOS */
-#endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
 
 /* Global variables ----------------------------------------------------------*/
 
@@ -307,7 +226,14 @@ static void Button_TriggerActions         ( void * arg );
 #endif /* (CFG_BUTTON_SUPPORTED == 1) */
 #if (CFG_JOYSTICK_SUPPORTED == 1)
 static void APP_BSP_JoystickTimerCallback ( void *arg );
+#ifdef CFG_BSP_ON_FREERTOS
+static void APP_BSP_JoystickSampleManage  ( void );
+#endif /* CFG_BSP_ON_FREERTOS */
 #endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
+#ifdef CFG_BSP_ON_FREERTOS
+static void BspInput_InitTask             ( void );
+static void BspInput_Post                 ( uint8_t inputId );
+#endif /* CFG_BSP_ON_FREERTOS */
 
 /* External variables --------------------------------------------------------*/
 
@@ -565,12 +491,109 @@ __WEAK void APP_BSP_JoystickNoneAction( void )
 }
 
 #endif /* ( CFG_JOYSTICK_SUPPORTED == 1 ) */
+#ifdef CFG_BSP_ON_FREERTOS
+
+/**
+ * @brief   Register the handler called by the Input Dispatch task for an input.
+ *          Default handlers are the 'APP_BSP_xxxAction' functions.
+ *
+ * @param   input     Input (Button or Joystick position), listed in enum APP_BSP_Input_t
+ * @param   handler   Handler to call, NULL to ignore this input.
+ */
+void APP_BSP_InputRegisterHandler( APP_BSP_Input_t input, APP_BSP_InputHandler_t handler )
+{
+  if ( input < APP_BSP_INPUT_NB )
+  {
+    BspInputHandlerTable[input] = handler;
+  }
+}
+
+#endif /* CFG_BSP_ON_FREERTOS */
 
 /*************************************************************
  *
  * LOCAL FUNCTIONS
  *
  *************************************************************/
+#ifdef CFG_BSP_ON_FREERTOS
+
+/**
+ * @brief  Post an input event to the Input Dispatch task.
+ *         Called from EXTI, Timer or Serial context : never blocks, the event is dropped if the queue is full.
+ *
+ * @param  inputId  Input to dispatch (APP_BSP_Input_t or BSP_INPUT_JOYSTICK_SAMPLE).
+ * @retval None
+ */
+static void BspInput_Post( uint8_t inputId )
+{
+  BspInputEvent_t   stEvent;
+
+  stEvent.timestamp = HAL_GetTick();
+  stEvent.inputId = inputId;
+
+  (void)osMessageQueuePut( BspInputQueue, &stEvent, 0, 0 );
+}
+
+/**
+ * @brief  Management of the Input Dispatch task : call the registered handler of each received event.
+ * @param  argument  Not used.
+ * @retval None
+ */
+static void BspInputTask( void * argument )
+{
+  BspInputEvent_t   stEvent;
+
+  UNUSED( argument );
+
+  for(;;)
+  {
+    if ( osMessageQueueGet( BspInputQueue, &stEvent, NULL, osWaitForever ) != osOK )
+    {
+      continue;
+    }
+
+#if (CFG_JOYSTICK_SUPPORTED == 1)
+    if ( stEvent.inputId == BSP_INPUT_JOYSTICK_SAMPLE )
+    {
+      APP_BSP_JoystickSampleManage();
+      continue;
+    }
+#endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
+
+    if ( ( stEvent.inputId < APP_BSP_INPUT_NB ) && ( BspInputHandlerTable[stEvent.inputId] != NULL ) )
+    {
+      LOG_DEBUG_APP( "Input %d dispatched after %d ms", stEvent.inputId, ( HAL_GetTick() - stEvent.timestamp ) );
+      BspInputHandlerTable[stEvent.inputId]();
+    }
+  }
+}
+
+/**
+ * @brief  Initialisation of the Input Dispatch Queue & Task (done once for Buttons & Joystick).
+ */
+static void BspInput_InitTask( void )
+{
+  if ( BspInputQueue != NULL )
+  {
+    return;
+  }
+
+  BspInputQueue = osMessageQueueNew( BSP_INPUT_QUEUE_SIZE, sizeof( BspInputEvent_t ), NULL );
+  if ( BspInputQueue == NULL )
+  {
+    LOG_ERROR_APP( "FreeRtos : Error during creation of Queue for Inputs" );
+    while(1);
+  }
+
+  BspInputThread = osThreadNew( BspInputTask, NULL, &BspInputThreadAttributes );
+  if ( BspInputThread == NULL )
+  {
+    LOG_ERROR_APP( "FreeRtos : Error during creation of Thread for Inputs" );
+    while(1);
+  }
+}
+
+#endif /* CFG_BSP_ON_FREERTOS */
 
 #if ( CFG_LED_SUPPORTED == 1 )
 
@@ -640,27 +663,27 @@ static void Joystick_LaunchActionTask( JOYPin_TypeDef joystickState )
   {
 #ifdef CFG_BSP_ON_FREERTOS
     case JOY_UP:
-        osSemaphoreRelease( JoystickUpSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_UP );
         break;
 
     case JOY_RIGHT:
-        osSemaphoreRelease( JoystickRightSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_RIGHT );
         break;
 
     case JOY_DOWN:
-        osSemaphoreRelease( JoystickDownSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_DOWN );
         break;
 
     case JOY_LEFT:
-        osSemaphoreRelease( JoystickLeftSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_LEFT );
         break;
 
     case JOY_SEL:
-        osSemaphoreRelease( JoystickSelectSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_SELECT );
         break;
         
     case JOY_NONE:
-        osSemaphoreRelease( JoystickNoneSemaphore );
+        BspInput_Post( APP_BSP_INPUT_JOY_NONE );
         break;
 #endif /* CFG_BSP_ON_FREERTOS */
 #ifdef CFG_BSP_ON_THREADX
@@ -875,7 +898,7 @@ static void APP_BSP_JoystickTimerCallback(void *arg)
   UTIL_SEQ_SetTask( 1U << CFG_TASK_BSP_JOY_SAMPLE, CFG_SEQ_PRIO_0);
 #endif /* CFG_BSP_ON_SEQUENCER */
 #ifdef CFG_BSP_ON_FREERTOS
-  osSemaphoreRelease( JoystickSampleSemaphore );
+  BspInput_Post( BSP_INPUT_JOYSTICK_SAMPLE );
 #endif /* CFG_BSP_ON_FREERTOS */
 #ifdef CFG_BSP_ON_THREADX
   tx_semaphore_put( &JoystickSampleSemaphore );
@@ -885,163 +908,18 @@ static void APP_BSP_JoystickTimerCallback(void *arg)
 #ifdef CFG_BSP_ON_FREERTOS
 
 /**
- * @brief  Management of the Joystick Sample task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickSampleTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickSampleSemaphore, osWaitForever );
-    APP_BSP_JoystickSampleManage();
-  }
-}
-
-/**
- * @brief  Management of the Joystick Up task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickUpTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickUpSemaphore, osWaitForever );
-    APP_BSP_JoystickUpAction();
-  }
-}
-
-/**
- * @brief  Management of the Joystick Right task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickRightTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickRightSemaphore, osWaitForever );
-    APP_BSP_JoystickRightAction();
-  }
-}
-
-/**
- * @brief  Management of the Joystick Down task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickDownTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickDownSemaphore, osWaitForever );
-    APP_BSP_JoystickDownAction();
-  }
-}
-
-/**
- * @brief  Management of the Joystick Left task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickLeftTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickLeftSemaphore, osWaitForever );
-    APP_BSP_JoystickLeftAction();
-  }
-}
-
-/**
- * @brief  Management of the Joystick Select task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickSelectTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickSelectSemaphore, osWaitForever );
-    APP_BSP_JoystickSelectAction();
-  }
-}
-
-/**
- * @brief  Management of the Joystick None task
- * @param  argument  Not used.
- * @retval None
- */
-static void JoystickNoneTask( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( JoystickNoneSemaphore, osWaitForever );
-    APP_BSP_JoystickNoneAction();
-  }
-}
-
-/**
- * @brief  Initialisation of the Joystick Tasks & Semaphores
+ * @brief  Initialisation of the Joystick handlers in the Input Dispatch task
  */
 static void Joystick_InitTask( void )
 {
-  /* Register Semaphore & Task for the Joystick Sample Management Semaphore */
-  JoystickSampleSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickSampleThread = osThreadNew( JoystickSampleTask, NULL, &JoystickSampleThreadAttributes );
-  
-  /* Register Semaphore & Task for the Joystick Up Semaphore */
-  JoystickUpSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickUpThread = osThreadNew( JoystickUpTask, NULL, &JoystickUpThreadAttributes );
-
-  /* Register Semaphore & Task for the Joystick Up Semaphore */
-  JoystickRightSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickRightThread = osThreadNew( JoystickRightTask, NULL, &JoystickRightThreadAttributes );
-
-  /* Register Semaphore & Task for the Joystick Up Semaphore */
-  JoystickDownSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickDownThread = osThreadNew( JoystickDownTask, NULL, &JoystickDownThreadAttributes );
+  BspInput_InitTask();
 
-  /* Register Semaphore & Task for the Joystick Up Semaphore */
-  JoystickLeftSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickLeftThread = osThreadNew( JoystickLeftTask, NULL, &JoystickLeftThreadAttributes );
-
-  /* Register Semaphore & Task for the Joystick Select Semaphore */
-  JoystickSelectSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickSelectThread = osThreadNew( JoystickSelectTask, NULL, &JoystickSelectThreadAttributes );
-
-  /* Register Semaphore & Task for the Joystick None Semaphore */
-  JoystickNoneSemaphore = osSemaphoreNew( 1, 0, NULL );
-  JoystickNoneThread = osThreadNew( JoystickNoneTask, NULL, &JoystickNoneThreadAttributes );
-
-  if ( ( JoystickSampleSemaphore == NULL ) || ( JoystickUpSemaphore == NULL ) || ( JoystickRightSemaphore == NULL ) || ( JoystickDownSemaphore == NULL )
-      || ( JoystickLeftSemaphore == NULL ) || ( JoystickSelectSemaphore == NULL ) || ( JoystickNoneSemaphore == NULL ) )
-  {
-    LOG_ERROR_APP( "FreeRtos : Error during creation of Semaphore for Joystick" );
-    while(1);
-  }
-
-  if ( ( JoystickSampleThread == NULL ) || ( JoystickUpThread == NULL ) || ( JoystickRightThread == NULL ) || ( JoystickDownThread == NULL )
-      || ( JoystickLeftThread == NULL ) || ( JoystickSelectThread == NULL ) || ( JoystickNoneThread == NULL ) )
-  {
-    LOG_ERROR_APP( "FreeRtos : Error during creation of Task for Joystick" );
-    while(1);
-  }
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_UP, APP_BSP_JoystickUpAction );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_RIGHT, APP_BSP_JoystickRightAction );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_DOWN, APP_BSP_JoystickDownAction );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_LEFT, APP_BSP_JoystickLeftAction );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_SELECT, APP_BSP_JoystickSelectAction );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_JOY_NONE, APP_BSP_JoystickNoneAction );
 }
 
 #endif /* CFG_BSP_ON_FREERTOS */
@@ -1312,78 +1190,15 @@ void APP_BSP_JoystickInit( void )
 #ifdef CFG_BSP_ON_FREERTOS
 
 /**
- * @brief  Management of the B1 pushbutton task
- * @param  argument  Not used.
- * @retval None
- */
-static void ButtonB1Task( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( ButtonB1Semaphore, osWaitForever );
-    APP_BSP_Button1Action();
-  }
-}
-
-/**
- * @brief  Management of the B2 pushbutton task
- * @param  argument  Not used.
- * @retval None
- */
-static void ButtonB2Task( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( ButtonB2Semaphore, osWaitForever );
-    APP_BSP_Button2Action();
-  }
-}
-
-/**
- * @brief  Management of the B3 pushbutton task
- * @param  argument  Not used.
- * @retval None
+ * @brief  Initialisation of the Buttons handlers in the Input Dispatch task
  */
-static void ButtonB3Task( void * argument )
-{
-  UNUSED( argument );
-
-  for(;;)
-  {
-    osSemaphoreAcquire( ButtonB3Semaphore, osWaitForever );
-    APP_BSP_Button3Action();
-  }
-}
-
 static void Button_InitTask( void )
 {
-  /* Register Semaphore & Thread to launch the pushbutton B1 Task */
-  ButtonB1Semaphore = osSemaphoreNew( 1, 0, NULL );
-  ButtonB1Thread = osThreadNew( ButtonB1Task, NULL, &ButtonB1ThreadAttributes );
-
-  /* Register Semaphore & Thread to launch the pushbutton B2 Task */
-  ButtonB2Semaphore = osSemaphoreNew( 1, 0, NULL );
-  ButtonB2Thread = osThreadNew( ButtonB2Task, NULL, &ButtonB2ThreadAttributes );
-
-  /* Register Semaphore & Thread to launch the pushbutton B3 Task */
-  ButtonB3Semaphore = osSemaphoreNew( 1, 0, NULL );
-  ButtonB3Thread = osThreadNew( ButtonB3Task, NULL, &ButtonB3ThreadAttributes );
+  BspInput_InitTask();
 
-  if ( ( ButtonB1Semaphore == NULL ) || ( ButtonB2Semaphore == NULL ) || ( ButtonB3Semaphore == NULL ) )
-  {
-    LOG_ERROR_APP( "FreeRtos : Error during creation of Semaphore for Buttons" );
-    while(1);
-  }
-
-  if ( ( ButtonB1Thread == NULL ) || ( ButtonB2Thread == NULL ) || ( ButtonB3Thread == NULL ) )
-  {
-    LOG_ERROR_APP( "FreeRtos : Error during creation of Thread for Buttons" );
-    while(1);
-  }
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_B1, APP_BSP_Button1Action );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_B2, APP_BSP_Button2Action );
+  APP_BSP_InputRegisterHandler( APP_BSP_INPUT_B3, APP_BSP_Button3Action );
 }
 
 #endif /* CFG_BSP_ON_FREERTOS */
@@ -1567,7 +1382,7 @@ static void Button_LaunchActionTask( Button_TypeDef button )
   if ( button == B2 )
   {
 #ifdef CFG_BSP_ON_FREERTOS
-    osSemaphoreRelease( ButtonB2Semaphore );
+    BspInput_Post( APP_BSP_INPUT_B2 );
 #endif /* CFG_BSP_ON_FREERTOS */
 #ifdef CFG_BSP_ON_THREADX
     tx_semaphore_put( &ButtonB2Semaphore );
@@ -1582,15 +1397,15 @@ static void Button_LaunchActionTask( Button_TypeDef button )
   {
 #ifdef CFG_BSP_ON_FREERTOS
     case B1:
-        osSemaphoreRelease( ButtonB1Semaphore );
+        BspInput_Post( APP_BSP_INPUT_B1 );
         break;
 
     case B2:
-        osSemaphoreRelease( ButtonB2Semaphore );
+        BspInput_Post( APP_BSP_INPUT_B2 );
         break;
 
     case B3:
-        osSemaphoreRelease( ButtonB3Semaphore );
+        BspInput_Post( APP_BSP_INPUT_B3 );
         break;
 #endif /* CFG_BSP_ON_FREERTOS */
 #ifdef CFG_BSP_ON_THREADX
@@ -1627,7 +1442,10 @@ static void Button_LaunchActionTask( Button_TypeDef button )
 }
 
 /**
+ * @brief  Long-press sampling of a button : launch the Task when the press is 'long' or when the button is released.
  *
+ * @param  arg  Descriptor of the sampled button.
+ * @retval None
  */
 static void Button_TriggerActions( void * arg )
 {
@@ -1636,31 +1454,50 @@ static void Button_TriggerActions( void * arg )
 
   buttonState = BSP_PB_GetState( p_buttonDesc->button );
 
-  /* If Button pressed and Threshold time not finish, continue waiting */
-  p_buttonDesc->waitingTime += BUTTON_LONG_PRESS_SAMPLE_MS;
-  if ( ( buttonState != 0u ) && ( p_buttonDesc->waitingTime < BUTTON_LONG_PRESS_THRESHOLD_MS ) )
-  {
-    return;
-  }
-
-  /* Save button state */
+  /* If Button pressed, continue waiting the release. A 'long press' is launched once, at the Threshold time */
   if ( buttonState != 0u )
   {
-    APP_BSP_SetButtonIsLongPressed( p_buttonDesc->button );
+    if ( p_buttonDesc->waitingTime < p_buttonDesc->longPressThreshold )
+    {
+      p_buttonDesc->waitingTime += BUTTON_LONG_PRESS_SAMPLE_MS;
+      if ( p_buttonDesc->waitingTime >= p_buttonDesc->longPressThreshold )
+      {
+        APP_BSP_SetButtonIsLongPressed( p_buttonDesc->button );
+        Button_LaunchActionTask( p_buttonDesc->button );
+      }
+    }
+    return;
   }
 
-  /* Stop Timer */
+  /* Stop Timer. The bounces of the release are filtered from now */
   UTIL_TIMER_Stop( &p_buttonDesc->longTimerId );
+  p_buttonDesc->lastEdgeTime = HAL_GetTick();
 
-  /* Launch Task */
-  Button_LaunchActionTask( p_buttonDesc->button );
+  /* Launch Task of a short press */
+  if ( p_buttonDesc->waitingTime < p_buttonDesc->longPressThreshold )
+  {
+    Button_LaunchActionTask( p_buttonDesc->button );
+  }
 }
 
 /**
+ * @brief  EXTI callback of a button : filter contact bounces then start the long-press sampling.
  *
+ * @param  button  ID of pressed button.
+ * @retval None
  */
 void BSP_PB_Callback( Button_TypeDef button )
 {
+  uint32_t  lNow = HAL_GetTick();
+
+  /* Edges during the sampling of a press, or too close to the last accepted edge or release, are contact bounces */
+  if ( ( UTIL_TIMER_IsRunning( &buttonDesc[button].longTimerId ) != 0u ) ||
+       ( ( lNow - buttonDesc[button].lastEdgeTime ) < buttonDesc[button].debounceTime ) )
+  {
+    return;
+  }
+
+  buttonDesc[button].lastEdgeTime = lNow;
   buttonDesc[button].waitingTime = 0;
   UTIL_TIMER_StartWithPeriod( &buttonDesc[button].longTimerId, BUTTON_LONG_PRESS_SAMPLE_MS );
 }
@@ -58,6 +58,24 @@ extern "C" {
 /* Private includes ----------------------------------------------------------*/
 
 /* Exported types ------------------------------------------------------------*/
+#ifdef CFG_BSP_ON_FREERTOS
+/* Inputs dispatched by the BSP Input task */
+typedef enum
+{
+  APP_BSP_INPUT_B1 = 0,
+  APP_BSP_INPUT_B2,
+  APP_BSP_INPUT_B3,
+  APP_BSP_INPUT_JOY_UP,
+  APP_BSP_INPUT_JOY_RIGHT,
+  APP_BSP_INPUT_JOY_DOWN,
+  APP_BSP_INPUT_JOY_LEFT,
+  APP_BSP_INPUT_JOY_SELECT,
+  APP_BSP_INPUT_JOY_NONE,
+  APP_BSP_INPUT_NB
+} APP_BSP_Input_t;
+
+typedef void ( *APP_BSP_InputHandler_t )( void );
+#endif /* CFG_BSP_ON_FREERTOS */
 
 /* Exported constants --------------------------------------------------------*/
 #if (CFG_LCD_SUPPORTED == 1)
@@ -85,18 +103,12 @@ extern "C" {
 #ifdef CFG_BSP_ON_THREADX
 extern TX_SEMAPHORE         ButtonB1Semaphore, ButtonB2Semaphore, ButtonB3Semaphore;
 #endif /* CFG_BSP_ON_THREADX */
-#ifdef CFG_BSP_ON_FREERTOS
-extern osSemaphoreId_t      ButtonB1Semaphore, ButtonB2Semaphore, ButtonB3Semaphore;
-#endif /* CFG_BSP_ON_FREERTOS */
 #endif /* (CFG_BUTTON_SUPPORTED == 1) */
 
 #if (CFG_JOYSTICK_SUPPORTED == 1)
 #ifdef CFG_BSP_ON_THREADX
 extern TX_SEMAPHORE         JoystickUpSemaphore, JoystickRightSemaphore, JoystickDownSemaphore, JoystickLeftSemaphore, JoystickSelectSemaphore, JoystickNoneSemaphore;
 #endif /* CFG_BSP_ON_THREADX */
-#ifdef CFG_BSP_ON_FREERTOS
-extern osSemaphoreId_t      JoystickUpSemaphore, JoystickRightSemaphore, JoystickDownSemaphore, JoystickLeftSemaphore, JoystickSelectSemaphore, JoystickNoneSemaphore;
-#endif /* CFG_BSP_ON_FREERTOS */
 #endif /* (CFG_JOYSTICK_SUPPORTED == 1) */
 
 /* Exported macros ------------------------------------------------------------*/
@@ -107,6 +119,10 @@ void      APP_BSP_PostIdle                ( void );
 void      APP_BSP_StandbyExit             ( void );
 uint8_t   APP_BSP_SerialCmdExecute        ( uint8_t * pRxBuffer, uint16_t iRxBufferSize );
 
+#ifdef CFG_BSP_ON_FREERTOS
+void      APP_BSP_InputRegisterHandler    ( APP_BSP_Input_t input, APP_BSP_InputHandler_t handler );
+#endif /* CFG_BSP_ON_FREERTOS */
+
 #if (CFG_LED_SUPPORTED == 1)
 void      APP_BSP_LedInit                 ( void );
 
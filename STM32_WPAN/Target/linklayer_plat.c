@@ -242,23 +242,15 @@ void LINKLAYER_PLAT_AclkCtrl(uint8_t enable)
   */
 void LINKLAYER_PLAT_GetRNG(uint8_t *ptr_rnd, uint32_t len)
 {
-  uint32_t nb_remaining_rng = len;
-  uint32_t generated_rng;
+  uint32_t nb_rng;
 
-  /* Get the requested RNGs (4 bytes by 4bytes) */
-  while(nb_remaining_rng >= 4)
+  /* Get the requested RNGs, at most one pool at a time */
+  while(len > 0)
   {
-    generated_rng = 0;
-    HW_RNG_Get(1, &generated_rng);
-    memcpy((ptr_rnd+(len-nb_remaining_rng)), &generated_rng, 4);
-    nb_remaining_rng -=4;
-  }
-
-  /* Get the remaining number of RNGs */
-  if(nb_remaining_rng>0){
-    generated_rng = 0;
-    HW_RNG_Get(1, &generated_rng);
-    memcpy((ptr_rnd+(len-nb_remaining_rng)), &generated_rng, nb_remaining_rng);
+    nb_rng = (len > (4 * HW_RNG_POOL_SIZE)) ? (4 * HW_RNG_POOL_SIZE) : len;
+    HW_RNG_GetBytes(ptr_rnd, nb_rng);
+    ptr_rnd += nb_rng;
+    len -= nb_rng;
   }
 }
 
@@ -0,0 +1,48 @@
+/*
+ *  Host build configuration of the OpenThread core for the host tests.
+ *
+ *  The product FTD configuration is used as is, except for the features that
+ *  need the mbedTLS library or the TCPlp sources, which are only shipped as
+ *  prebuilt target libraries. Crypto primitives are provided by the test
+ *  platform.
+ */
+
+#ifndef OPENTHREAD_CORE_HOST_CONFIG_H_
+#define OPENTHREAD_CORE_HOST_CONFIG_H_
+
+#include "stm32wba-openthread-ftd-config.h"
+
+#undef OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
+#define OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT 0
+
+#undef OPENTHREAD_CONFIG_LOG_OUTPUT
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_NONE
+
+#define OPENTHREAD_CONFIG_CRYPTO_LIB OPENTHREAD_CONFIG_CRYPTO_LIB_PLATFORM
+#define OPENTHREAD_CONFIG_ENABLE_BUILTIN_MBEDTLS_MANAGEMENT 0
+#define OPENTHREAD_CONFIG_AES_CONTEXT_SIZE 64
+#define OPENTHREAD_CONFIG_HMAC_SHA256_CONTEXT_SIZE 64
+#define OPENTHREAD_CONFIG_HKDF_CONTEXT_SIZE 64
+#define OPENTHREAD_CONFIG_SHA256_CONTEXT_SIZE 64
+
+/* DTLS, ECDSA and TCP need the mbedTLS and TCPlp libraries */
+#undef OPENTHREAD_CONFIG_COMMISSIONER_ENABLE
+#define OPENTHREAD_CONFIG_COMMISSIONER_ENABLE 0
+#undef OPENTHREAD_CONFIG_JOINER_ENABLE
+#define OPENTHREAD_CONFIG_JOINER_ENABLE 0
+#undef OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE
+#define OPENTHREAD_CONFIG_COAP_SECURE_API_ENABLE 0
+#undef OPENTHREAD_CONFIG_ECDSA_ENABLE
+#define OPENTHREAD_CONFIG_ECDSA_ENABLE 0
+#undef OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE 0
+#undef OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_BUFFERS_ENABLE 0
+#undef OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE 0
+#undef OPENTHREAD_CONFIG_SRP_CLIENT_DOMAIN_NAME_API_ENABLE
+#define OPENTHREAD_CONFIG_SRP_CLIENT_DOMAIN_NAME_API_ENABLE 0
+#undef OPENTHREAD_CONFIG_TCP_ENABLE
+#define OPENTHREAD_CONFIG_TCP_ENABLE 0
+
+#endif // OPENTHREAD_CORE_HOST_CONFIG_H_
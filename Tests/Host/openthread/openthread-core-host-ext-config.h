@@ -0,0 +1,37 @@
+/*
+ *  Host build configuration of the OpenThread core for the EXT_TESTS.
+ *
+ *  The host configuration with the table sizes and features that the product
+ *  does not use but that the tests exercise.
+ */
+
+#ifndef OPENTHREAD_CORE_HOST_EXT_CONFIG_H_
+#define OPENTHREAD_CORE_HOST_EXT_CONFIG_H_
+
+#include "openthread-core-host-config.h"
+
+/* A parent with as many children as the child IDs allow */
+#undef OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 511
+
+/* A border router with the message buffers for hundreds of CoAP exchanges */
+#undef OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 2048
+
+/* A CoAP server caching the responses to many clients */
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 64
+
+/*
+ * The reassembly buffer limit of the target in bytes, half of its 128 message
+ * buffers: they are half the size of the 64 bit host ones.
+ */
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS 32
+
+/* The NAT64 translator of a border router, sharing one IPv4 address by ports */
+#define OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE 1
+#define OPENTHREAD_CONFIG_NAT64_PORT_TRANSLATION_ENABLE 1
+
+/* Settings kept by the flash driver of the core, in the flash of test_platform.cpp */
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 1
+
+#endif // OPENTHREAD_CORE_HOST_EXT_CONFIG_H_
@@ -0,0 +1,161 @@
+/*
+ *  Test of the Address Query pacing of AddressResolver: a burst of new EIDs
+ *  sends at most OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST queries at once,
+ *  the others follow one per pacing interval, and Clear() drops the pending
+ *  queries and gives the burst allowance back.
+ */
+
+#include <string.h>
+
+#include "mac/mac.hpp"
+#include "mac/mac_frame.hpp"
+#include "mac/sub_mac.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/mle.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint8_t  kBurst          = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_BURST;
+static const uint32_t kPacingInterval = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_PACING_INTERVAL;
+static const uint16_t kNumEids        = 10;
+static const uint8_t  kEidIid[]       = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
+
+static bool     sQueried[2 * kNumEids];
+static uint16_t sNumAddressQuery;
+
+/*
+ * Decrypts the MAC secured frames and looks for the Target EID of an Address
+ * Query in them. MPL retransmits each query, so the distinct EIDs are counted.
+ */
+static void HandleTransmit(const otRadioFrame &aFrame, void *aContext)
+{
+    Instance      &instance = *static_cast<Instance *>(aContext);
+    uint8_t        psdu[OT_RADIO_FRAME_MAX_SIZE];
+    otRadioFrame   radioFrame = aFrame;
+    Mac::RxFrame  &frame      = static_cast<Mac::RxFrame &>(radioFrame);
+    const uint8_t *payload;
+
+    memcpy(psdu, aFrame.mPsdu, aFrame.mLength);
+    radioFrame.mPsdu = psdu;
+
+    VerifyOrExit(frame.GetSecurityEnabled());
+    SuccessOrQuit(frame.ProcessReceiveAesCcm(instance.Get<Mac::Mac>().GetExtAddress(),
+                                             instance.Get<Mac::SubMac>().GetCurrentMacKey()));
+
+    payload = frame.GetPayload();
+
+    for (uint16_t i = 0; i + sizeof(kEidIid) + 2 <= frame.GetPayloadLength(); i++)
+    {
+        uint16_t index;
+
+        if (memcmp(&payload[i], kEidIid, sizeof(kEidIid)) != 0)
+        {
+            continue;
+        }
+
+        index = BigEndian::ReadUint16(&payload[i + sizeof(kEidIid)]);
+        VerifyOrQuit(index < GetArrayLength(sQueried));
+
+        if (!sQueried[index])
+        {
+            sQueried[index] = true;
+            sNumAddressQuery++;
+        }
+    }
+
+exit:
+    return;
+}
+
+static void StartCounting(Instance &aInstance)
+{
+    memset(sQueried, 0, sizeof(sQueried));
+    sNumAddressQuery = 0;
+    testSetRadioTransmitHandler(HandleTransmit, &aInstance);
+}
+
+static void GetEid(Instance &aInstance, uint16_t aIndex, Ip6::Address &aEid)
+{
+    aEid.SetPrefix(aInstance.Get<Mle::Mle>().GetMeshLocalPrefix());
+    memcpy(aEid.mFields.m8 + 8, kEidIid, sizeof(kEidIid));
+    BigEndian::WriteUint16(aIndex, aEid.mFields.m8 + 8 + sizeof(kEidIid));
+}
+
+static void ResolveEids(Instance &aInstance, uint16_t aFirst, uint16_t aCount)
+{
+    for (uint16_t i = aFirst; i < aFirst + aCount; i++)
+    {
+        Ip6::Address eid;
+        uint16_t     rloc16;
+
+        GetEid(aInstance, i, eid);
+        VerifyOrQuit(aInstance.Get<AddressResolver>().Resolve(eid, rloc16) == kErrorAddressQuery);
+    }
+
+    testProcess(aInstance);
+}
+
+static void TestQueryPacing(void)
+{
+    Instance *instance = testInitInstance();
+
+    testStartLeader(*instance);
+    StartCounting(*instance);
+
+    ResolveEids(*instance, 0, kNumEids);
+    VerifyOrQuit(sNumAddressQuery == kBurst);
+
+    // The pending EIDs are still in the query list, a new lookup does
+    // not send another query.
+    ResolveEids(*instance, 0, kNumEids);
+    VerifyOrQuit(sNumAddressQuery == kBurst);
+
+    for (uint16_t sent = kBurst; sent < kNumEids; sent++)
+    {
+        testAdvanceTime(*instance, kPacingInterval);
+        VerifyOrQuit(sNumAddressQuery == sent + 1u);
+    }
+
+    testAdvanceTime(*instance, kPacingInterval * 10);
+    VerifyOrQuit(sNumAddressQuery == kNumEids);
+
+    testSetRadioTransmitHandler(nullptr, nullptr);
+    testFreeInstance(instance);
+    printf("TestQueryPacing passed\n");
+}
+
+static void TestClear(void)
+{
+    Instance *instance = testInitInstance();
+
+    testStartLeader(*instance);
+    StartCounting(*instance);
+
+    ResolveEids(*instance, 0, kNumEids);
+    VerifyOrQuit(sNumAddressQuery == kBurst);
+
+    // The burst allowance is back at once, and the pending queries are
+    // dropped with their entries.
+    instance->Get<AddressResolver>().Clear();
+    ResolveEids(*instance, kNumEids, kBurst);
+    VerifyOrQuit(sNumAddressQuery == 2 * kBurst);
+
+    testAdvanceTime(*instance, kPacingInterval * kNumEids);
+    VerifyOrQuit(sNumAddressQuery == 2 * kBurst);
+
+    testSetRadioTransmitHandler(nullptr, nullptr);
+    testFreeInstance(instance);
+    printf("TestClear passed\n");
+}
+
+int main(void)
+{
+    TestQueryPacing();
+    TestClear();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ *  Randomized equivalence test of the word-wise Checksum::AddData() against
+ *  the byte-wise one's complement sum of Checksum::AddUint8(), and benchmark
+ *  of both on an IPv6 MTU sized payload.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "common/message.hpp"
+#include "net/checksum.hpp"
+#include "net/ip6_address.hpp"
+#include "net/ip6_types.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+static uint8_t sData[0xffff];
+
+static uint32_t sRandomState = 0x2468ace1;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+class ChecksumTester
+{
+public:
+    static void VerifySame(const Checksum &aChecksum, const Checksum &aReference)
+    {
+        VerifyOrQuit(aChecksum.mValue == aReference.mValue);
+        VerifyOrQuit(aChecksum.mAtOddIndex == aReference.mAtOddIndex);
+    }
+
+    static void AddBytewise(Checksum &aChecksum, const uint8_t *aBuffer, uint32_t aLength)
+    {
+        for (uint32_t i = 0; i < aLength; i++)
+        {
+            aChecksum.AddUint8(aBuffer[i]);
+        }
+    }
+
+    static void FillData(uint32_t aLength)
+    {
+        switch (NextRandom() % 4)
+        {
+        case 0:
+            memset(sData, 0, aLength);
+            break;
+        case 1:
+            memset(sData, 0xff, aLength);
+            break;
+        default:
+            for (uint32_t i = 0; i < aLength; i++)
+            {
+                sData[i] = static_cast<uint8_t>(NextRandom());
+            }
+            break;
+        }
+    }
+
+    static void TestRandomChunks(void)
+    {
+        static const uint32_t kRounds = 3000;
+
+        for (uint32_t round = 0; round < kRounds; round++)
+        {
+            // One round out of ten is a single chunk up to the largest length.
+            uint32_t length   = (round % 10 == 0) ? (NextRandom() % sizeof(sData)) + 1 : (NextRandom() % 4000) + 1;
+            uint32_t offset   = 0;
+            Checksum checksum;
+            Checksum reference;
+
+            FillData(length);
+
+            // Start from a random state, as the pseudo header leaves it.
+            AddBytewise(reference, sData, NextRandom() % 3);
+            checksum = reference;
+
+            while (offset < length)
+            {
+                uint32_t chunkLength = (round % 10 == 0) ? length : (NextRandom() % 300) + 1;
+
+                if (chunkLength > length - offset)
+                {
+                    chunkLength = length - offset;
+                }
+
+                checksum.AddData(sData + offset, static_cast<uint16_t>(chunkLength));
+                AddBytewise(reference, sData + offset, chunkLength);
+                VerifySame(checksum, reference);
+
+                offset += chunkLength;
+            }
+
+            checksum.AddUint16(static_cast<uint16_t>(NextRandom()));
+            reference.AddUint8(static_cast<uint8_t>(sRandomState >> 8));
+            reference.AddUint8(static_cast<uint8_t>(sRandomState));
+            VerifySame(checksum, reference);
+        }
+
+        printf("TestRandomChunks passed\n");
+    }
+
+    static void TestMessage(void)
+    {
+        Instance     *instance = testInitInstance();
+        Ip6::Address  source;
+        Ip6::Address  destination;
+        uint8_t       pseudoHeader[sizeof(Ip6::Address) * 2 + 4];
+        const uint8_t proto = Ip6::kProtoUdp;
+
+        SuccessOrQuit(source.FromString("fdde:ad00:beef:0:0:ff:fe00:fc00"));
+        SuccessOrQuit(destination.FromString("fdde:ad00:beef:0:1234:5678:9abc:def0"));
+
+        // Lengths across several message buffers, from an odd offset.
+        for (uint16_t length = 1; length < 1500; length += (NextRandom() % 7) + 1)
+        {
+            Message *message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+            Checksum checksum;
+            Checksum reference;
+
+            VerifyOrQuit(message != nullptr);
+            FillData(length + 3);
+            SuccessOrQuit(message->AppendBytes(sData, length + 3));
+            message->SetOffset(3);
+
+            checksum.Calculate(source, destination, proto, *message);
+
+            memcpy(pseudoHeader, source.GetBytes(), sizeof(Ip6::Address));
+            memcpy(pseudoHeader + sizeof(Ip6::Address), destination.GetBytes(), sizeof(Ip6::Address));
+            BigEndian::WriteUint16(length, pseudoHeader + sizeof(Ip6::Address) * 2);
+            BigEndian::WriteUint16(proto, pseudoHeader + sizeof(Ip6::Address) * 2 + 2);
+            AddBytewise(reference, pseudoHeader, sizeof(pseudoHeader));
+            AddBytewise(reference, sData + 3, length);
+
+            VerifySame(checksum, reference);
+            message->Free();
+        }
+
+        testFreeInstance(instance);
+        printf("TestMessage passed\n");
+    }
+
+    static void Benchmark(void)
+    {
+        static const uint16_t kLength     = 1280;
+        static const uint32_t kIterations = 20000;
+
+        uint64_t start;
+        uint64_t wordNs;
+        uint64_t byteNs;
+        uint32_t sink = 0;
+
+        FillData(kLength);
+
+        start = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Checksum checksum;
+
+            checksum.AddData(sData, kLength);
+            sink += checksum.mValue;
+        }
+
+        wordNs = NowNs() - start;
+        start  = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Checksum checksum;
+
+            AddBytewise(checksum, sData, kLength);
+            sink += checksum.mValue;
+        }
+
+        byteNs = NowNs() - start;
+
+        VerifyOrQuit(sink != 0);
+        printf("checksum of %u bytes: word-wise %.3f ns/byte, byte-wise %.3f ns/byte\n", kLength,
+               static_cast<double>(wordNs) / kIterations / kLength, static_cast<double>(byteNs) / kIterations / kLength);
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::ChecksumTester::TestRandomChunks();
+    ot::ChecksumTester::TestMessage();
+    ot::ChecksumTester::Benchmark();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,313 @@
+/*
+ *  Test of the child table indexes: FindChild() by RLOC16 or extended address
+ *  and HasSleepyChildWithAddress() shall return what a scan of the table
+ *  returns while the children change, and benchmark of both lookups for a
+ *  parent with 10, 64 and 511 children.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "thread/child_table.hpp"
+#include "thread/mle.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
+
+static uint32_t sRandomState = 0x13579bdf;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void GetExtAddress(uint32_t aValue, Mac::ExtAddress &aExtAddress)
+{
+    memset(aExtAddress.m8, 0x5a, sizeof(aExtAddress.m8));
+    BigEndian::WriteUint32(aValue, &aExtAddress.m8[4]);
+}
+
+static void GetGroup(uint16_t aGroup, Ip6::Address &aAddress)
+{
+    SuccessOrQuit(aAddress.FromString("ff05::1:0"));
+    aAddress.mFields.m16[7] = BigEndian::HostSwap16(aGroup);
+}
+
+/* Reference lookups: a scan of the whole table, as done before the indexes */
+
+static Child *ScanForRloc16(Instance &aInstance, uint16_t aRloc16, Child::StateFilter aFilter)
+{
+    Child *found = nullptr;
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child &child = *aInstance.Get<ChildTable>().GetChildAtIndex(i);
+
+        if (child.MatchesFilter(aFilter) && (child.GetRloc16() == aRloc16))
+        {
+            found = &child;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static Child *ScanForExtAddress(Instance &aInstance, const Mac::ExtAddress &aExtAddress, Child::StateFilter aFilter)
+{
+    Child *found = nullptr;
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child &child = *aInstance.Get<ChildTable>().GetChildAtIndex(i);
+
+        if (child.MatchesFilter(aFilter) && (child.GetExtAddress() == aExtAddress))
+        {
+            found = &child;
+            break;
+        }
+    }
+
+    return found;
+}
+
+static bool ScanForSleepyChild(Instance &aInstance, const Ip6::Address &aAddress)
+{
+    bool found = false;
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child &child = *aInstance.Get<ChildTable>().GetChildAtIndex(i);
+
+        if (child.IsStateValidOrRestoring() && !child.IsRxOnWhenIdle() && child.HasIp6Address(aAddress))
+        {
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+/*
+ * Adds `aNumChildren` children. The odd ones are sleepy and each child
+ * registers up to three of `aNumGroups` multicast groups.
+ */
+static void AddChildren(Instance &aInstance, uint16_t aNumChildren, uint16_t aNumGroups)
+{
+    uint16_t parentRloc16 = aInstance.Get<Mle::Mle>().GetRloc16();
+
+    for (uint16_t i = 0; i < aNumChildren; i++)
+    {
+        Child          *child = aInstance.Get<ChildTable>().GetNewChild();
+        Mac::ExtAddress extAddress;
+
+        VerifyOrQuit(child != nullptr);
+
+        GetExtAddress(i, extAddress);
+        child->SetExtAddress(extAddress);
+        child->SetRloc16(parentRloc16 | (i + 1));
+        child->SetDeviceMode(Mle::DeviceMode((i % 2) ? 0 : Mle::DeviceMode::kModeRxOnWhenIdle));
+
+        for (uint8_t j = NextRandom() % 4; j > 0; j--)
+        {
+            Ip6::Address group;
+
+            GetGroup(static_cast<uint16_t>(NextRandom() % aNumGroups), group);
+            IgnoreError(child->AddIp6Address(group));
+        }
+
+        child->SetState(Neighbor::kStateValid);
+    }
+}
+
+static void VerifyLookups(Instance &aInstance, uint16_t aNumGroups)
+{
+    static const Child::StateFilter kFilters[] = {Child::kInStateValid, Child::kInStateAnyExceptInvalid,
+                                                  Child::kInStateInvalid};
+
+    ChildTable &childTable   = aInstance.Get<ChildTable>();
+    uint16_t    parentRloc16 = aInstance.Get<Mle::Mle>().GetRloc16();
+
+    for (Child::StateFilter filter : kFilters)
+    {
+        for (uint16_t i = 0; i <= kMaxChildren + 1; i++)
+        {
+            Mac::ExtAddress extAddress;
+            uint16_t        rloc16 = parentRloc16 | i;
+
+            GetExtAddress(i, extAddress);
+
+            VerifyOrQuit(childTable.FindChild(rloc16, filter) == ScanForRloc16(aInstance, rloc16, filter));
+            VerifyOrQuit(childTable.FindChild(extAddress, filter) == ScanForExtAddress(aInstance, extAddress, filter));
+        }
+    }
+
+    for (uint16_t group = 0; group < aNumGroups + 10; group++)
+    {
+        Ip6::Address address;
+
+        GetGroup(group, address);
+        VerifyOrQuit(childTable.HasSleepyChildWithAddress(address) == ScanForSleepyChild(aInstance, address));
+    }
+}
+
+static void TestLookups(void)
+{
+    static const uint16_t kNumGroups = 40;
+
+    Instance   *instance   = testInitInstance();
+    ChildTable &childTable = instance->Get<ChildTable>();
+
+    testStartLeader(*instance);
+    AddChildren(*instance, kMaxChildren, kNumGroups);
+    VerifyLookups(*instance, kNumGroups);
+
+    // Change the keys of some children, give two of them the same
+    // keys, remove addresses and children, and change the modes.
+    for (uint16_t round = 0; round < 400; round++)
+    {
+        Child          *child = childTable.GetChildAtIndex(static_cast<uint16_t>(NextRandom() % kMaxChildren));
+        Mac::ExtAddress extAddress;
+        Ip6::Address    group;
+
+        switch (NextRandom() % 6)
+        {
+        case 0:
+            child->SetRloc16(instance->Get<Mle::Mle>().GetRloc16() | (NextRandom() % (kMaxChildren + 2)));
+            break;
+        case 1:
+            GetExtAddress(NextRandom() % (kMaxChildren + 2), extAddress);
+            child->SetExtAddress(extAddress);
+            break;
+        case 2:
+            child->SetState(Neighbor::kStateInvalid);
+            break;
+        case 3:
+            GetGroup(static_cast<uint16_t>(NextRandom() % kNumGroups), group);
+            IgnoreError(child->RemoveIp6Address(group));
+            break;
+        case 4:
+            child->SetDeviceMode(Mle::DeviceMode(child->IsRxOnWhenIdle() ? 0 : Mle::DeviceMode::kModeRxOnWhenIdle));
+            break;
+        default:
+            child = childTable.GetNewChild();
+
+            if (child != nullptr)
+            {
+                GetExtAddress(kMaxChildren + NextRandom() % 4, extAddress);
+                child->SetExtAddress(extAddress);
+                child->SetRloc16(instance->Get<Mle::Mle>().GetRloc16() | (NextRandom() % (kMaxChildren + 2)));
+                GetGroup(static_cast<uint16_t>(NextRandom() % kNumGroups), group);
+                IgnoreError(child->AddIp6Address(group));
+                child->SetState(Neighbor::kStateValid);
+            }
+            break;
+        }
+
+        if (round % 20 == 0)
+        {
+            VerifyLookups(*instance, kNumGroups);
+        }
+    }
+
+    VerifyLookups(*instance, kNumGroups);
+
+    childTable.Clear();
+    VerifyLookups(*instance, kNumGroups);
+
+    testFreeInstance(instance);
+    printf("TestLookups passed\n");
+}
+
+static void Benchmark(uint16_t aNumChildren)
+{
+    static const uint32_t kIterations = 20000;
+    static const uint16_t kNumGroups  = 8;
+
+    Instance    *instance   = testInitInstance();
+    ChildTable  &childTable = instance->Get<ChildTable>();
+    uint16_t     parentRloc16;
+    Ip6::Address unsubscribed;
+    uint64_t     start;
+    uint64_t     indexedNs[2];
+    uint64_t     scanNs[2];
+    uint32_t     sink = 0;
+
+    testStartLeader(*instance);
+    parentRloc16 = instance->Get<Mle::Mle>().GetRloc16();
+    AddChildren(*instance, aNumChildren, kNumGroups);
+    GetGroup(kNumGroups, unsubscribed);
+
+    // Unicast forwarding to a child by RLOC16, and multicast
+    // forwarding to a group no sleepy child subscribed to.
+    start = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        sink += (childTable.FindChild(parentRloc16 | (i % aNumChildren + 1), Child::kInStateValid) != nullptr);
+    }
+
+    indexedNs[0] = NowNs() - start;
+    start        = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        sink += (ScanForRloc16(*instance, parentRloc16 | (i % aNumChildren + 1), Child::kInStateValid) != nullptr);
+    }
+
+    scanNs[0] = NowNs() - start;
+    start     = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        sink += childTable.HasSleepyChildWithAddress(unsubscribed);
+    }
+
+    indexedNs[1] = NowNs() - start;
+    start        = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        sink += ScanForSleepyChild(*instance, unsubscribed);
+    }
+
+    scanNs[1] = NowNs() - start;
+
+    VerifyOrQuit(sink == 2 * kIterations);
+    printf("%3u children: FindChild indexed %.1f ns, scan %.1f ns; HasSleepyChildWithAddress indexed %.1f ns, "
+           "scan %.1f ns\n",
+           aNumChildren, static_cast<double>(indexedNs[0]) / kIterations,
+           static_cast<double>(scanNs[0]) / kIterations, static_cast<double>(indexedNs[1]) / kIterations,
+           static_cast<double>(scanNs[1]) / kIterations);
+
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestLookups();
+
+    Benchmark(10);
+    Benchmark(64);
+    Benchmark(511);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,424 @@
+/*
+ *  Test of the CoAP request and response matching and of the retransmission
+ *  timer: a client keeps hundreds of confirmable requests to a few servers
+ *  pending over a lossy link, and each request shall get its own response,
+ *  or time out when the server never answers it. A response from another
+ *  peer than the request went to is ignored. Also benchmarks the matching of
+ *  responses and the retransmission timer with up to 500 pending requests.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "coap/coap.hpp"
+#include "common/message.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kPort       = 5683;
+static const uint8_t  kNumServers = 4;
+static const uint16_t kMaxFrames  = 2048;
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    TestCoap(Instance &aInstance, const char *aAddress)
+        : CoapBase(aInstance, &TestCoap::Send)
+    {
+        SuccessOrQuit(mAddress.FromString(aAddress));
+    }
+
+    using CoapBase::Receive;
+
+    const Ip6::Address &GetAddress(void) const { return mAddress; }
+
+private:
+    static Error Send(CoapBase &aCoapBase, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+
+    Ip6::Address mAddress;
+};
+
+/* The link between the CoAP agents: the messages sent and not yet delivered */
+struct Frame
+{
+    Message         *mMessage;
+    TestCoap        *mSender;
+    Ip6::MessageInfo mMessageInfo;
+};
+
+struct Request
+{
+    uint16_t mNumber;
+    uint8_t  mServer;
+    uint8_t  mNumResults;
+    Error    mResult;
+};
+
+static TestCoap *sAgents[kNumServers + 2];
+static Frame     sFrames[kMaxFrames];
+static uint16_t  sNumFrames;
+static uint8_t   sLossPercent;
+static uint32_t  sRandomState = 0x5bd1e995;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+Error TestCoap::Send(CoapBase &aCoapBase, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(sNumFrames < kMaxFrames, error = kErrorNoBufs);
+
+    sFrames[sNumFrames].mMessage     = &aMessage;
+    sFrames[sNumFrames].mSender      = static_cast<TestCoap *>(&aCoapBase);
+    sFrames[sNumFrames].mMessageInfo = aMessageInfo;
+    sNumFrames++;
+
+exit:
+    return error;
+}
+
+static TestCoap *FindAgent(const Ip6::Address &aAddress)
+{
+    TestCoap *agent = nullptr;
+
+    for (TestCoap *candidate : sAgents)
+    {
+        if ((candidate != nullptr) && (candidate->GetAddress() == aAddress))
+        {
+            agent = candidate;
+            break;
+        }
+    }
+
+    return agent;
+}
+
+/* Delivers a frame to its destination, or to `aReceiver` when not null */
+static void DeliverFrame(const Frame &aFrame, TestCoap *aReceiver)
+{
+    TestCoap        *receiver = (aReceiver != nullptr) ? aReceiver : FindAgent(aFrame.mMessageInfo.GetPeerAddr());
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(receiver != nullptr);
+
+    messageInfo.SetPeerAddr(aFrame.mSender->GetAddress());
+    messageInfo.SetPeerPort(kPort);
+    messageInfo.SetSockAddr(receiver->GetAddress());
+    messageInfo.SetSockPort(kPort);
+
+    // The sender left the offset at the payload, the receiver parses
+    // the CoAP header from the offset.
+    aFrame.mMessage->SetOffset(0);
+    receiver->Receive(*aFrame.mMessage, messageInfo);
+    aFrame.mMessage->Free();
+}
+
+/* Delivers the frames sent so far in random order, losing some, and those they trigger */
+static void DeliverFrames(void)
+{
+    while (sNumFrames > 0)
+    {
+        uint16_t index = static_cast<uint16_t>(NextRandom() % sNumFrames);
+        Frame    frame = sFrames[index];
+
+        sFrames[index] = sFrames[--sNumFrames];
+
+        if (NextRandom() % 100 < sLossPercent)
+        {
+            frame.mMessage->Free();
+            continue;
+        }
+
+        DeliverFrame(frame, nullptr);
+    }
+}
+
+static uint16_t ReadNumber(const otMessage *aMessage)
+{
+    const Coap::Message &message = AsCoapMessage(aMessage);
+    uint16_t             number;
+
+    SuccessOrQuit(message.Read(message.GetOffset(), number));
+
+    return number;
+}
+
+/* The servers answer all requests but those numbered 9 modulo 10, echoing the number */
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    TestCoap      &server = *static_cast<TestCoap *>(aContext);
+    uint16_t       number = ReadNumber(aMessage);
+    Coap::Message *response;
+
+    VerifyOrExit(number % 10 != 9);
+
+    response = server.NewResponseMessage(AsCoapMessage(aMessage));
+    VerifyOrQuit(response != nullptr);
+    SuccessOrQuit(response->Append(number));
+    SuccessOrQuit(server.SendMessage(*response, AsCoreType(aMessageInfo)));
+
+exit:
+    return;
+}
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    Request &request = *static_cast<Request *>(aContext);
+
+    request.mNumResults++;
+    request.mResult = aResult;
+
+    if (aResult == kErrorNone)
+    {
+        VerifyOrQuit(ReadNumber(aMessage) == request.mNumber);
+        VerifyOrQuit(AsCoreType(aMessageInfo).GetPeerAddr() == sAgents[1 + request.mServer]->GetAddress());
+    }
+}
+
+static void InitAgents(Instance &aInstance)
+{
+    static const char *const kAddresses[] = {"fd00::1", "fd00::10", "fd00::11", "fd00::12", "fd00::13", "fd00::99"};
+
+    for (uint8_t i = 0; i < GetArrayLength(sAgents); i++)
+    {
+        sAgents[i] = new TestCoap(aInstance, kAddresses[i]);
+
+        if (i > 0)
+        {
+            sAgents[i]->SetDefaultHandler(HandleRequest, sAgents[i]);
+        }
+    }
+
+    sNumFrames   = 0;
+    sLossPercent = 0;
+}
+
+static void FreeAgents(void)
+{
+    for (TestCoap *&agent : sAgents)
+    {
+        agent->ClearAllRequestsAndResponses();
+        delete agent;
+        agent = nullptr;
+    }
+}
+
+static void SendRequest(Request &aRequest)
+{
+    TestCoap        &client  = *sAgents[0];
+    Coap::Message   *message = client.NewConfirmablePostMessage(kUriDiagnosticGetRequest);
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Append(aRequest.mNumber));
+
+    messageInfo.SetPeerAddr(sAgents[1 + aRequest.mServer]->GetAddress());
+    messageInfo.SetPeerPort(kPort);
+    messageInfo.SetSockAddr(client.GetAddress());
+    messageInfo.SetSockPort(kPort);
+
+    SuccessOrQuit(client.SendMessage(*message, messageInfo, HandleResponse, &aRequest));
+}
+
+static uint16_t GetNumQueued(const TestCoap &aAgent)
+{
+    MessageQueue::Info info;
+
+    ClearAllBytes(info);
+    aAgent.GetRequestAndCachedResponsesQueueInfo(info);
+
+    return info.mNumMessages;
+}
+
+static void TestConcurrentRequests(void)
+{
+    static const uint16_t kNumRequests = 400;
+
+    Instance *instance    = testInitInstance();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Request   requests[kNumRequests];
+    uint16_t  numTimeouts = 0;
+
+    InitAgents(*instance);
+    sLossPercent = 20;
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        requests[i].mNumber     = i;
+        requests[i].mServer     = static_cast<uint8_t>(NextRandom() % kNumServers);
+        requests[i].mNumResults = 0;
+        SendRequest(requests[i]);
+    }
+
+    VerifyOrQuit(GetNumQueued(*sAgents[0]) == kNumRequests);
+
+    // Until the last retransmission of the unanswered requests has
+    // timed out.
+    for (uint32_t elapsed = 0; elapsed < 300000; elapsed += 100)
+    {
+        DeliverFrames();
+        testAdvanceTime(*instance, 100);
+    }
+
+    DeliverFrames();
+
+    for (Request &request : requests)
+    {
+        VerifyOrQuit(request.mNumResults == 1);
+
+        // An answered request times out only if all its transmissions
+        // or all the responses were lost.
+        if (request.mNumber % 10 == 9)
+        {
+            VerifyOrQuit(request.mResult == kErrorResponseTimeout);
+        }
+        else if (request.mResult != kErrorNone)
+        {
+            VerifyOrQuit(request.mResult == kErrorResponseTimeout);
+            numTimeouts++;
+        }
+    }
+
+    VerifyOrQuit(numTimeouts < kNumRequests / 100);
+    VerifyOrQuit(GetNumQueued(*sAgents[0]) == 0);
+
+    FreeAgents();
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    testFreeInstance(instance);
+    printf("TestConcurrentRequests passed\n");
+}
+
+static void TestWrongPeer(void)
+{
+    Instance *instance = testInitInstance();
+    Request   request;
+
+    InitAgents(*instance);
+
+    request.mNumber     = 0;
+    request.mServer     = 0;
+    request.mNumResults = 0;
+    SendRequest(request);
+    VerifyOrQuit(sNumFrames == 1);
+
+    // Another peer gets the request and answers it, with its message
+    // ID and token: the response is not the one of the request.
+    sNumFrames--;
+    DeliverFrame(sFrames[0], sAgents[kNumServers + 1]);
+    VerifyOrQuit(sNumFrames == 1);
+    VerifyOrQuit(sFrames[0].mSender == sAgents[kNumServers + 1]);
+    DeliverFrames();
+    VerifyOrQuit(request.mNumResults == 0);
+    VerifyOrQuit(GetNumQueued(*sAgents[0]) == 1);
+
+    // The retransmission reaches the server it was sent to.
+    testAdvanceTime(*instance, 5000);
+    DeliverFrames();
+    VerifyOrQuit(request.mNumResults == 1);
+    VerifyOrQuit(request.mResult == kErrorNone);
+    VerifyOrQuit(GetNumQueued(*sAgents[0]) == 0);
+
+    FreeAgents();
+    testFreeInstance(instance);
+    printf("TestWrongPeer passed\n");
+}
+
+static void Benchmark(uint16_t aNumRequests)
+{
+    static const uint16_t kMaxRequests = 500;
+
+    Instance *instance = testInitInstance();
+    Request   requests[kMaxRequests];
+    uint64_t  start;
+    uint64_t  timerNs;
+    uint64_t  responseNs = 0;
+    uint32_t  numTimerFrames;
+
+    InitAgents(*instance);
+
+    for (uint16_t i = 0; i < aNumRequests; i++)
+    {
+        requests[i].mNumber     = static_cast<uint16_t>(10 * i);
+        requests[i].mServer     = static_cast<uint8_t>(i % kNumServers);
+        requests[i].mNumResults = 0;
+        SendRequest(requests[i]);
+        testAdvanceTime(*instance, 1);
+    }
+
+    // Lost requests: the timer retransmits each one once.
+    while (sNumFrames > 0)
+    {
+        sFrames[--sNumFrames].mMessage->Free();
+    }
+
+    start = NowNs();
+    testAdvanceTime(*instance, 5000);
+    timerNs        = NowNs() - start;
+    numTimerFrames = sNumFrames;
+
+    // The servers answer the retransmissions in random order, the
+    // client matches each response against the pending requests.
+    while (sNumFrames > 0)
+    {
+        uint16_t index = static_cast<uint16_t>(NextRandom() % sNumFrames);
+        Frame    frame = sFrames[index];
+
+        sFrames[index] = sFrames[--sNumFrames];
+
+        if (frame.mSender == sAgents[0])
+        {
+            DeliverFrame(frame, nullptr);
+        }
+        else
+        {
+            start = NowNs();
+            DeliverFrame(frame, nullptr);
+            responseNs += NowNs() - start;
+        }
+    }
+
+    for (uint16_t i = 0; i < aNumRequests; i++)
+    {
+        VerifyOrQuit((requests[i].mNumResults == 1) && (requests[i].mResult == kErrorNone));
+    }
+
+    VerifyOrQuit(numTimerFrames == aNumRequests);
+    printf("%3u pending requests: response matched in %.0f ns, retransmission timer %.0f ns per request due\n",
+           aNumRequests, static_cast<double>(responseNs) / aNumRequests,
+           static_cast<double>(timerNs) / aNumRequests);
+
+    FreeAgents();
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestConcurrentRequests();
+    TestWrongPeer();
+
+    Benchmark(50);
+    Benchmark(200);
+    Benchmark(500);
+
+    printf("All tests passed\n");
+    return 0;
+}
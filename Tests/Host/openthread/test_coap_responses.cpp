@@ -0,0 +1,470 @@
+/*
+ *  Test of the CoAP response cache of a server: clients retransmit their
+ *  confirmable requests in storms of duplicates, and the server shall handle
+ *  each request once and answer the duplicates from the cache. A request
+ *  with the message ID of another peer is not a duplicate. The oldest
+ *  response is evicted from a full cache, and responses expire after the
+ *  exchange lifetime. Also benchmarks the answer to a duplicate with up to
+ *  64 cached responses.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "coap/coap.hpp"
+#include "common/message.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kPort               = 5683;
+static const uint8_t  kNumClients         = 16;
+static const uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+static const uint16_t kMaxFrames          = 2048;
+static const uint16_t kMaxNumbers         = 256;
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    TestCoap(Instance &aInstance, const char *aAddress)
+        : CoapBase(aInstance, &TestCoap::Send)
+    {
+        SuccessOrQuit(mAddress.FromString(aAddress));
+    }
+
+    using CoapBase::Receive;
+
+    const Ip6::Address &GetAddress(void) const { return mAddress; }
+
+private:
+    static Error Send(CoapBase &aCoapBase, Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+
+    Ip6::Address mAddress;
+};
+
+/* The link between the CoAP agents: the messages sent and not yet delivered */
+struct Frame
+{
+    Message         *mMessage;
+    TestCoap        *mSender;
+    Ip6::MessageInfo mMessageInfo;
+};
+
+struct Request
+{
+    uint16_t mNumber;
+    uint8_t  mNumResults;
+    Error    mResult;
+    Frame    mFrame;
+};
+
+static TestCoap *sServer;
+static TestCoap *sClients[kNumClients];
+static Frame     sFrames[kMaxFrames];
+static uint16_t  sNumFrames;
+static uint8_t   sNumHandled[kMaxNumbers];
+static uint32_t  sRandomState = 0x85ebca6b;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+Error TestCoap::Send(CoapBase &aCoapBase, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(sNumFrames < kMaxFrames, error = kErrorNoBufs);
+
+    sFrames[sNumFrames].mMessage     = &aMessage;
+    sFrames[sNumFrames].mSender      = static_cast<TestCoap *>(&aCoapBase);
+    sFrames[sNumFrames].mMessageInfo = aMessageInfo;
+    sNumFrames++;
+
+exit:
+    return error;
+}
+
+static TestCoap *FindAgent(const Ip6::Address &aAddress)
+{
+    TestCoap *agent = (sServer->GetAddress() == aAddress) ? sServer : nullptr;
+
+    for (TestCoap *client : sClients)
+    {
+        if (client->GetAddress() == aAddress)
+        {
+            agent = client;
+            break;
+        }
+    }
+
+    return agent;
+}
+
+/* Delivers a frame to its destination, from its sender */
+static void DeliverFrame(const Frame &aFrame)
+{
+    TestCoap        *receiver = FindAgent(aFrame.mMessageInfo.GetPeerAddr());
+    Ip6::MessageInfo messageInfo;
+
+    VerifyOrQuit(receiver != nullptr);
+
+    messageInfo.SetPeerAddr(aFrame.mSender->GetAddress());
+    messageInfo.SetPeerPort(kPort);
+    messageInfo.SetSockAddr(receiver->GetAddress());
+    messageInfo.SetSockPort(kPort);
+
+    // The sender left the offset at the payload, the receiver parses
+    // the CoAP header from the offset.
+    aFrame.mMessage->SetOffset(0);
+    receiver->Receive(*aFrame.mMessage, messageInfo);
+    aFrame.mMessage->Free();
+}
+
+/* Delivers a copy of a frame, as a retransmission of its message */
+static void DeliverDuplicate(const Frame &aFrame)
+{
+    Frame duplicate = aFrame;
+
+    duplicate.mMessage = aFrame.mMessage->Clone();
+    VerifyOrQuit(duplicate.mMessage != nullptr);
+    DeliverFrame(duplicate);
+}
+
+/* Delivers the frames sent so far in random order, and those they trigger */
+static void DeliverFrames(void)
+{
+    while (sNumFrames > 0)
+    {
+        uint16_t index = static_cast<uint16_t>(NextRandom() % sNumFrames);
+        Frame    frame = sFrames[index];
+
+        sFrames[index] = sFrames[--sNumFrames];
+        DeliverFrame(frame);
+    }
+}
+
+static void DropFrames(void)
+{
+    while (sNumFrames > 0)
+    {
+        sFrames[--sNumFrames].mMessage->Free();
+    }
+}
+
+static uint16_t ReadNumber(const otMessage *aMessage)
+{
+    const Coap::Message &message = AsCoapMessage(aMessage);
+    uint16_t             number;
+
+    SuccessOrQuit(message.Read(message.GetOffset(), number));
+
+    return number;
+}
+
+/* The server counts the requests it handles, and answers them echoing the number */
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    uint16_t       number = ReadNumber(aMessage);
+    Coap::Message *response;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    VerifyOrQuit(number < kMaxNumbers);
+    sNumHandled[number]++;
+
+    response = sServer->NewResponseMessage(AsCoapMessage(aMessage));
+    VerifyOrQuit(response != nullptr);
+    SuccessOrQuit(response->Append(number));
+    SuccessOrQuit(sServer->SendMessage(*response, AsCoreType(aMessageInfo)));
+}
+
+static void HandleResponse(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo, otError aResult)
+{
+    Request &request = *static_cast<Request *>(aContext);
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    request.mNumResults++;
+    request.mResult = aResult;
+
+    if (aResult == kErrorNone)
+    {
+        VerifyOrQuit(ReadNumber(aMessage) == request.mNumber);
+    }
+}
+
+static void InitAgents(Instance &aInstance)
+{
+    sServer = new TestCoap(aInstance, "fd00::10");
+    sServer->SetDefaultHandler(HandleRequest, nullptr);
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        char address[sizeof("fd00::1:ff")];
+
+        snprintf(address, sizeof(address), "fd00::1:%x", i);
+        sClients[i] = new TestCoap(aInstance, address);
+    }
+
+    sNumFrames = 0;
+    memset(sNumHandled, 0, sizeof(sNumHandled));
+}
+
+static void FreeAgents(void)
+{
+    DropFrames();
+
+    sServer->ClearAllRequestsAndResponses();
+    delete sServer;
+    sServer = nullptr;
+
+    for (TestCoap *&client : sClients)
+    {
+        client->ClearAllRequestsAndResponses();
+        delete client;
+        client = nullptr;
+    }
+}
+
+/*
+ * Sends a request from a client and takes its frame off the link, keeping it
+ * in `aRequest` for the test to deliver.
+ */
+static void SendRequest(TestCoap &aClient, Request &aRequest, uint16_t aNumber)
+{
+    Coap::Message   *message = aClient.NewConfirmablePostMessage(kUriDiagnosticGetRequest);
+    Ip6::MessageInfo messageInfo;
+
+    aRequest.mNumber     = aNumber;
+    aRequest.mNumResults = 0;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->Append(aNumber));
+
+    messageInfo.SetPeerAddr(sServer->GetAddress());
+    messageInfo.SetPeerPort(kPort);
+    messageInfo.SetSockAddr(aClient.GetAddress());
+    messageInfo.SetSockPort(kPort);
+
+    SuccessOrQuit(aClient.SendMessage(*message, messageInfo, HandleResponse, &aRequest));
+
+    VerifyOrQuit(sNumFrames > 0);
+    aRequest.mFrame = sFrames[--sNumFrames];
+}
+
+static uint16_t GetNumCached(const TestCoap &aServer)
+{
+    MessageQueue::Info info;
+
+    ClearAllBytes(info);
+    aServer.GetRequestAndCachedResponsesQueueInfo(info);
+
+    return info.mNumMessages;
+}
+
+static void TestRetransmissionStorm(void)
+{
+    static const uint8_t kNumDuplicates = 20;
+
+    Instance *instance    = testInitInstance();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Request   requests[kNumClients];
+    uint8_t   numSent[kNumClients];
+    uint16_t  numPending = kNumClients;
+
+    InitAgents(*instance);
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        SendRequest(*sClients[i], requests[i], i);
+        numSent[i] = 0;
+    }
+
+    // The transmissions of the clients interleave, each one reaching
+    // the server with its duplicates.
+    while (numPending > 0)
+    {
+        uint8_t i = static_cast<uint8_t>(NextRandom() % kNumClients);
+
+        if (numSent[i] > kNumDuplicates)
+        {
+            continue;
+        }
+
+        if (++numSent[i] > kNumDuplicates)
+        {
+            DeliverFrame(requests[i].mFrame);
+            numPending--;
+        }
+        else
+        {
+            DeliverDuplicate(requests[i].mFrame);
+        }
+    }
+
+    VerifyOrQuit(sNumFrames == kNumClients * (kNumDuplicates + 1));
+    VerifyOrQuit(GetNumCached(*sServer) == kNumClients);
+    DeliverFrames();
+
+    for (uint8_t i = 0; i < kNumClients; i++)
+    {
+        VerifyOrQuit(sNumHandled[i] == 1);
+        VerifyOrQuit((requests[i].mNumResults == 1) && (requests[i].mResult == kErrorNone));
+    }
+
+    // The message ID of a request from another peer: the server handles
+    // the request, and the client it answers ignores the response.
+    SendRequest(*sClients[0], requests[0], kNumClients);
+    requests[0].mFrame.mSender = sClients[1];
+    DeliverDuplicate(requests[0].mFrame);
+    DeliverFrames();
+    VerifyOrQuit(sNumHandled[kNumClients] == 1);
+    VerifyOrQuit(requests[0].mNumResults == 0);
+
+    requests[0].mFrame.mSender = sClients[0];
+    DeliverFrame(requests[0].mFrame);
+    DeliverFrames();
+    VerifyOrQuit(sNumHandled[kNumClients] == 2);
+    VerifyOrQuit((requests[0].mNumResults == 1) && (requests[0].mResult == kErrorNone));
+
+    FreeAgents();
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    testFreeInstance(instance);
+    printf("TestRetransmissionStorm passed\n");
+}
+
+static void TestEvictionAndExpiry(void)
+{
+    static const uint16_t kNumRequests = kMaxCachedResponses + 1;
+
+    Instance *instance = testInitInstance();
+    Request   requests[kNumRequests];
+    Frame     duplicates[kNumRequests];
+
+    InitAgents(*instance);
+
+    // Responses cached 1 ms apart: the first one expires first.
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        SendRequest(*sClients[i % kNumClients], requests[i], i);
+        duplicates[i]          = requests[i].mFrame;
+        duplicates[i].mMessage = requests[i].mFrame.mMessage->Clone();
+        VerifyOrQuit(duplicates[i].mMessage != nullptr);
+
+        DeliverFrame(requests[i].mFrame);
+        DeliverFrames();
+        VerifyOrQuit(GetNumCached(*sServer) == Min<uint16_t>(i + 1, kMaxCachedResponses));
+        testAdvanceTime(*instance, 1);
+    }
+
+    // The response to the first request was evicted, the others are
+    // still cached.
+    for (uint16_t i = kNumRequests; i > 0; i--)
+    {
+        DeliverDuplicate(duplicates[i - 1]);
+        DropFrames();
+        VerifyOrQuit(sNumHandled[i - 1] == ((i == 1) ? 2 : 1));
+    }
+
+    // After the exchange lifetime of the default parameters, 247 s, the
+    // responses have expired.
+    testAdvanceTime(*instance, 250000);
+    VerifyOrQuit(GetNumCached(*sServer) == 0);
+
+    for (uint16_t i = 1; i < kNumRequests; i++)
+    {
+        DeliverFrame(duplicates[i]);
+        DropFrames();
+        VerifyOrQuit(sNumHandled[i] == 2);
+    }
+
+    duplicates[0].mMessage->Free();
+
+    FreeAgents();
+    testFreeInstance(instance);
+    printf("TestEvictionAndExpiry passed\n");
+}
+
+static void Benchmark(uint16_t aNumCached)
+{
+    static const uint32_t kIterations = 20000;
+
+    Instance *instance = testInitInstance();
+    Request   requests[kMaxCachedResponses];
+    Frame     duplicates[kMaxCachedResponses];
+    uint64_t  duplicateNs = 0;
+
+    InitAgents(*instance);
+
+    for (uint16_t i = 0; i < aNumCached; i++)
+    {
+        SendRequest(*sClients[i % kNumClients], requests[i], i);
+        duplicates[i]          = requests[i].mFrame;
+        duplicates[i].mMessage = requests[i].mFrame.mMessage->Clone();
+        VerifyOrQuit(duplicates[i].mMessage != nullptr);
+
+        DeliverFrame(requests[i].mFrame);
+        DropFrames();
+    }
+
+    VerifyOrQuit(GetNumCached(*sServer) == aNumCached);
+
+    // A storm of retransmissions of random requests, each answered from
+    // the cache.
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Frame    duplicate = duplicates[NextRandom() % aNumCached];
+        uint64_t start;
+
+        duplicate.mMessage = duplicate.mMessage->Clone();
+        VerifyOrQuit(duplicate.mMessage != nullptr);
+
+        start = NowNs();
+        DeliverFrame(duplicate);
+        duplicateNs += NowNs() - start;
+
+        VerifyOrQuit(sNumFrames == 1);
+        DropFrames();
+    }
+
+    for (uint16_t i = 0; i < aNumCached; i++)
+    {
+        VerifyOrQuit(sNumHandled[i] == 1);
+        duplicates[i].mMessage->Free();
+    }
+
+    printf("%2u cached responses: duplicate request answered in %.0f ns\n", aNumCached,
+           static_cast<double>(duplicateNs) / kIterations);
+
+    FreeAgents();
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestRetransmissionStorm();
+    TestEvictionAndExpiry();
+
+    Benchmark(8);
+    Benchmark(kMaxCachedResponses / 2);
+    Benchmark(kMaxCachedResponses);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,421 @@
+/*
+ *  Test of the 6LoWPAN context table of the Network Data leader: the context
+ *  found for an address or a Context ID shall be the one the former walk of
+ *  the Prefix TLVs finds, for random Network Data with nested and repeated
+ *  prefixes, repeated Context IDs, prefixes without context and mesh-local
+ *  addresses. Also benchmarks both lookups against the walk.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "common/message.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mle.hpp"
+#include "thread/network_data_leader.hpp"
+#include "thread/network_data_tlvs.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+static const uint8_t kNumBases = 3;
+
+static Ip6::Address sBases[kNumBases];
+static uint32_t     sRandomState = 0x4b1d2c3e;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void InitBases(Instance &aInstance)
+{
+    SuccessOrQuit(sBases[0].FromString("2001:db8:1234:5678:9abc:def0:1357:9bdf"));
+    SuccessOrQuit(sBases[1].FromString("fd11:2233:4455:6677:8899:aabb:ccdd:eeff"));
+    sBases[2].SetPrefix(aInstance.Get<Mle::Mle>().GetMeshLocalPrefix());
+    sBases[2].GetIid().GenerateRandom();
+}
+
+/* An address sharing the first `aLength` bits with a base, the next bit differs */
+static void GetAddress(uint8_t aBase, uint8_t aLength, Ip6::Address &aAddress)
+{
+    aAddress = sBases[aBase];
+
+    for (uint8_t bit = aLength; bit < 128; bit++)
+    {
+        uint8_t mask = static_cast<uint8_t>(0x80 >> (bit % 8));
+
+        if ((bit == aLength) ? true : (NextRandom() % 2 == 0))
+        {
+            aAddress.mFields.m8[bit / 8] ^= mask;
+        }
+    }
+}
+
+static uint8_t RandomPrefixLength(void)
+{
+    static const uint8_t kLengths[] = {1, 8, 16, 23, 32, 48, 56, 63, 64, 64, 64, 65, 80, 96, 127, 128};
+
+    return kLengths[NextRandom() % GetArrayLength(kLengths)];
+}
+
+class UnitTester
+{
+public:
+    static bool AreEqual(const Lowpan::Context &aFirst, const Lowpan::Context &aSecond)
+    {
+        return (aFirst.mPrefix == aSecond.mPrefix) && (aFirst.mContextId == aSecond.mContextId) &&
+               (aFirst.mCompressFlag == aSecond.mCompressFlag) && (aFirst.mIsValid == aSecond.mIsValid);
+    }
+
+    /* The former GetContext(address): a walk of the Prefix TLVs matching the address */
+    static Error WalkForContext(const NetworkData::Leader &aLeader,
+                                const Ip6::Address        &aAddress,
+                                Lowpan::Context           &aContext)
+    {
+        const NetworkData::PrefixTlv  *prefixTlv = nullptr;
+        const NetworkData::ContextTlv *contextTlv;
+
+        aContext.mPrefix.SetLength(0);
+
+        if (aLeader.Get<Mle::Mle>().IsMeshLocalAddress(aAddress))
+        {
+            aLeader.GetContextForMeshLocalPrefix(aContext);
+        }
+
+        while ((prefixTlv = aLeader.FindNextMatchingPrefixTlv(aAddress, prefixTlv)) != nullptr)
+        {
+            contextTlv = prefixTlv->FindSubTlv<NetworkData::ContextTlv>();
+
+            if (contextTlv == nullptr)
+            {
+                continue;
+            }
+
+            if (prefixTlv->GetPrefixLength() > aContext.mPrefix.GetLength())
+            {
+                prefixTlv->CopyPrefixTo(aContext.mPrefix);
+                aContext.mContextId    = contextTlv->GetContextId();
+                aContext.mCompressFlag = contextTlv->IsCompress();
+                aContext.mIsValid      = true;
+            }
+        }
+
+        return (aContext.mPrefix.GetLength() > 0) ? kErrorNone : kErrorNotFound;
+    }
+
+    /* The former GetContext(id): the first Prefix TLV with a Context TLV of the ID */
+    static Error WalkForContext(const NetworkData::Leader &aLeader, uint8_t aContextId, Lowpan::Context &aContext)
+    {
+        Error                          error = kErrorNone;
+        const NetworkData::PrefixTlv  *prefixTlv;
+        const NetworkData::ContextTlv *contextTlv;
+
+        if (aContextId == Mle::kMeshLocalPrefixContextId)
+        {
+            aLeader.GetContextForMeshLocalPrefix(aContext);
+            ExitNow();
+        }
+
+        prefixTlv = aLeader.FindPrefixTlvForContextId(aContextId, contextTlv);
+        VerifyOrExit(prefixTlv != nullptr, error = kErrorNotFound);
+
+        prefixTlv->CopyPrefixTo(aContext.mPrefix);
+        aContext.mContextId    = contextTlv->GetContextId();
+        aContext.mCompressFlag = contextTlv->IsCompress();
+        aContext.mIsValid      = true;
+
+    exit:
+        return error;
+    }
+
+    /*
+     * Appends a Prefix TLV of the first `aLength` bits of a base with a Context
+     * TLV when `aContextId` is valid, and a Border Router TLV before it when
+     * `aWithBorderRouter`. Returns the TLV size, zero when it does not fit.
+     */
+    static uint8_t AppendPrefixTlv(uint8_t *aBuffer,
+                                   uint8_t  aMaxLength,
+                                   uint8_t  aBase,
+                                   uint8_t  aLength,
+                                   uint8_t  aContextId,
+                                   bool     aCompress,
+                                   bool     aWithBorderRouter)
+    {
+        static const uint8_t kNoContextId = 0xff;
+
+        uint8_t                      buffer[NetworkData::NetworkData::kMaxSize];
+        NetworkData::PrefixTlv      *prefixTlv = reinterpret_cast<NetworkData::PrefixTlv *>(buffer);
+        NetworkData::NetworkDataTlv *subTlv;
+        Ip6::Prefix                  prefix;
+        uint8_t                      size = 0;
+
+        prefix.Set(sBases[aBase].GetBytes(), aLength);
+        prefixTlv->Init(0, prefix);
+        subTlv = prefixTlv->GetSubTlvs();
+
+        if (aWithBorderRouter || (aContextId == kNoContextId))
+        {
+            NetworkData::BorderRouterTlv *borderRouterTlv = static_cast<NetworkData::BorderRouterTlv *>(subTlv);
+
+            borderRouterTlv->Init();
+            borderRouterTlv->SetLength(sizeof(NetworkData::BorderRouterEntry));
+            borderRouterTlv->GetFirstEntry()->Init();
+            borderRouterTlv->GetFirstEntry()->SetRloc(0x0400);
+            subTlv = subTlv->GetNext();
+        }
+
+        if (aContextId != kNoContextId)
+        {
+            NetworkData::ContextTlv *contextTlv = static_cast<NetworkData::ContextTlv *>(subTlv);
+
+            contextTlv->Init(aContextId, aLength);
+
+            if (aCompress)
+            {
+                contextTlv->SetCompress();
+            }
+
+            subTlv = subTlv->GetNext();
+        }
+
+        prefixTlv->SetSubTlvsLength(static_cast<uint8_t>(reinterpret_cast<uint8_t *>(subTlv) -
+                                                         reinterpret_cast<uint8_t *>(prefixTlv->GetSubTlvs())));
+
+        if (prefixTlv->GetSize() <= aMaxLength)
+        {
+            size = static_cast<uint8_t>(prefixTlv->GetSize());
+            memcpy(aBuffer, buffer, size);
+        }
+
+        return size;
+    }
+
+    static void SetNetworkData(Instance &aInstance, const uint8_t *aTlvs, uint8_t aLength)
+    {
+        static uint8_t sVersion = 0;
+
+        Message    *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeOther);
+        OffsetRange offsetRange;
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(aTlvs, aLength));
+        offsetRange.InitFromMessageFullLength(*message);
+        sVersion++;
+        SuccessOrQuit(aInstance.Get<NetworkData::Leader>().SetNetworkData(sVersion, sVersion, NetworkData::kFullSet,
+                                                                          *message, offsetRange));
+        message->Free();
+    }
+
+    /*
+     * Random Network Data of up to `aMaxPrefixes` Prefix TLVs of the bases.
+     * Context IDs are drawn from `aNumIds` values, so that they repeat when
+     * it is small.
+     */
+    static void SetRandomNetworkData(Instance &aInstance, uint8_t aMaxPrefixes, uint8_t aNumIds)
+    {
+        uint8_t tlvs[NetworkData::NetworkData::kMaxSize];
+        uint8_t length = 0;
+
+        for (uint8_t i = 0; i < aMaxPrefixes; i++)
+        {
+            uint8_t contextId = (NextRandom() % 4 == 0) ? 0xff : static_cast<uint8_t>(1 + NextRandom() % aNumIds);
+            uint8_t size;
+
+            size = AppendPrefixTlv(&tlvs[length], sizeof(tlvs) - length, NextRandom() % kNumBases,
+                                   RandomPrefixLength(), contextId, NextRandom() % 2, NextRandom() % 3 == 0);
+
+            if (size == 0)
+            {
+                break;
+            }
+
+            length += size;
+        }
+
+        SetNetworkData(aInstance, tlvs, length);
+    }
+
+    static void VerifyLookups(Instance &aInstance)
+    {
+        NetworkData::Leader &leader = aInstance.Get<NetworkData::Leader>();
+
+        for (uint8_t id = 0; id < 16; id++)
+        {
+            Lowpan::Context context;
+            Lowpan::Context walked;
+
+            memset(&context, 0, sizeof(context));
+            memset(&walked, 0, sizeof(walked));
+            VerifyOrQuit(leader.GetContext(id, context) == WalkForContext(leader, id, walked));
+            VerifyOrQuit(AreEqual(context, walked));
+        }
+
+        for (uint8_t base = 0; base < kNumBases; base++)
+        {
+            for (uint8_t length = 0; length <= 128; length++)
+            {
+                Ip6::Address    address;
+                Lowpan::Context context;
+                Lowpan::Context walked;
+
+                GetAddress(base, length, address);
+                memset(&context, 0, sizeof(context));
+                memset(&walked, 0, sizeof(walked));
+                VerifyOrQuit(leader.GetContext(address, context) == WalkForContext(leader, address, walked));
+                VerifyOrQuit(AreEqual(context, walked));
+            }
+        }
+    }
+
+    static void TestRandomNetworkData(void)
+    {
+        static const uint16_t kRounds = 2000;
+
+        Instance *instance = testInitInstance();
+
+        InitBases(*instance);
+
+        for (uint16_t round = 0; round < kRounds; round++)
+        {
+            // Few prefixes with distinct IDs mostly, up to Network Data
+            // full of prefixes with repeated IDs.
+            SetRandomNetworkData(*instance, static_cast<uint8_t>(1 + NextRandom() % 32),
+                                 static_cast<uint8_t>(1 + NextRandom() % 15));
+            VerifyLookups(*instance);
+        }
+
+        // No Network Data at all, only the mesh-local prefix.
+        SetNetworkData(*instance, nullptr, 0);
+        VerifyLookups(*instance);
+
+        testFreeInstance(instance);
+        printf("TestRandomNetworkData passed\n");
+    }
+
+    static void Benchmark(uint8_t aNumContexts)
+    {
+        static const uint32_t kIterations = 20000;
+        static const uint8_t  kNumAddresses = 64;
+
+        Instance            *instance = testInitInstance();
+        NetworkData::Leader &leader   = instance->Get<NetworkData::Leader>();
+        uint8_t              tlvs[NetworkData::NetworkData::kMaxSize];
+        uint8_t              length = 0;
+        Ip6::Address         addresses[kNumAddresses];
+        uint64_t             start;
+        uint64_t             tableNs[2];
+        uint64_t             walkNs[2];
+        uint32_t             sink = 0;
+
+        InitBases(*instance);
+
+        // An on-mesh prefix and an external route without context, and
+        // /64 prefixes with a context each.
+        length += AppendPrefixTlv(&tlvs[length], sizeof(tlvs) - length, 0, 48, 0xff, false, true);
+        length += AppendPrefixTlv(&tlvs[length], sizeof(tlvs) - length, 1, 16, 0xff, false, true);
+
+        for (uint8_t i = 0; i < aNumContexts; i++)
+        {
+            uint8_t size;
+
+            sBases[0].mFields.m8[7] = i;
+            size = AppendPrefixTlv(&tlvs[length], sizeof(tlvs) - length, 0, 64, i + 1, true, false);
+            VerifyOrQuit(size != 0);
+            length += size;
+        }
+
+        SetNetworkData(*instance, tlvs, length);
+
+        // The source and destination of the frames: mesh-local and
+        // global addresses of the context prefixes.
+        for (uint8_t i = 0; i < kNumAddresses; i++)
+        {
+            uint8_t base = (i % 2 == 0) ? 2 : 0;
+
+            sBases[0].mFields.m8[7] = static_cast<uint8_t>(i % aNumContexts);
+            GetAddress(base, 64, addresses[i]);
+        }
+
+        start = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Lowpan::Context context;
+
+            SuccessOrQuit(leader.GetContext(addresses[i % kNumAddresses], context));
+            sink += context.mContextId;
+        }
+
+        tableNs[0] = NowNs() - start;
+        start      = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Lowpan::Context context;
+
+            SuccessOrQuit(WalkForContext(leader, addresses[i % kNumAddresses], context));
+            sink -= context.mContextId;
+        }
+
+        walkNs[0] = NowNs() - start;
+        start     = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Lowpan::Context context;
+
+            SuccessOrQuit(leader.GetContext(static_cast<uint8_t>(i % (aNumContexts + 1)), context));
+            sink += context.mContextId;
+        }
+
+        tableNs[1] = NowNs() - start;
+        start      = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            Lowpan::Context context;
+
+            SuccessOrQuit(WalkForContext(leader, static_cast<uint8_t>(i % (aNumContexts + 1)), context));
+            sink -= context.mContextId;
+        }
+
+        walkNs[1] = NowNs() - start;
+
+        VerifyOrQuit(sink == 0);
+        printf("%2u contexts: by address table %.1f ns, walk %.1f ns; by ID table %.1f ns, walk %.1f ns\n",
+               aNumContexts, static_cast<double>(tableNs[0]) / kIterations,
+               static_cast<double>(walkNs[0]) / kIterations, static_cast<double>(tableNs[1]) / kIterations,
+               static_cast<double>(walkNs[1]) / kIterations);
+
+        testFreeInstance(instance);
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestRandomNetworkData();
+
+    ot::UnitTester::Benchmark(1);
+    ot::UnitTester::Benchmark(4);
+    ot::UnitTester::Benchmark(12);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,315 @@
+/*
+ *  Test of the flash settings driver with its record index: random Set, Add
+ *  and Delete of values of up to 48 keys, more valid records than the index
+ *  holds, shall read back as a reference model does, from the driver and from
+ *  a second driver initialized from the flash. Also benchmarks the flash
+ *  reads and the time of a Get with the index and with the scan of flash.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include <openthread/platform/flash.h>
+
+#include "utils/flash.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kIndexSize      = OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE;
+static const uint16_t kNumKeys        = 48;
+static const uint8_t  kMaxValues      = 2;
+static const uint16_t kMaxValueLength = 24;
+
+struct Value
+{
+    uint16_t mLength;
+    uint8_t  mData[kMaxValueLength];
+};
+
+static Value    sValues[kNumKeys][kMaxValues];
+static uint8_t  sNumValues[kNumKeys];
+static uint32_t sRandomState = 0x1b873593;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void RandomValue(Value &aValue)
+{
+    aValue.mLength = static_cast<uint16_t>(NextRandom() % (kMaxValueLength + 1));
+
+    for (uint16_t i = 0; i < aValue.mLength; i++)
+    {
+        aValue.mData[i] = static_cast<uint8_t>(NextRandom());
+    }
+}
+
+static void ClearModel(void) { memset(sNumValues, 0, sizeof(sNumValues)); }
+
+static uint16_t GetNumRecords(void)
+{
+    uint16_t numRecords = 0;
+
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        numRecords += sNumValues[key];
+    }
+
+    return numRecords;
+}
+
+static void VerifyFlash(const Flash &aFlash)
+{
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        for (uint8_t index = 0; index <= kMaxValues; index++)
+        {
+            uint8_t  data[kMaxValueLength + 1];
+            uint16_t length = sizeof(data);
+
+            if (index >= sNumValues[key])
+            {
+                VerifyOrQuit(aFlash.Get(key, index, data, &length) == kErrorNotFound);
+                VerifyOrQuit(length == 0);
+                continue;
+            }
+
+            SuccessOrQuit(aFlash.Get(key, index, data, &length));
+            VerifyOrQuit(length == sValues[key][index].mLength);
+            VerifyOrQuit(memcmp(data, sValues[key][index].mData, length) == 0);
+
+            // A shorter buffer gets the start of the value, and the
+            // full length.
+            length = 1;
+            SuccessOrQuit(aFlash.Get(key, index, data, &length));
+            VerifyOrQuit(length == sValues[key][index].mLength);
+            SuccessOrQuit(aFlash.Get(key, index, nullptr, nullptr));
+        }
+    }
+}
+
+/* A driver initialized from the flash, as after a reset, reads the same values */
+static void VerifyFlashAfterReset(Instance &aInstance)
+{
+    Flash flash(aInstance);
+
+    flash.Init();
+    VerifyFlash(flash);
+}
+
+/* Presence checks of indexed records do not read the flash */
+static bool IsIndexUsed(const Flash &aFlash)
+{
+    uint32_t readCount = testGetFlashReadCount();
+
+    for (uint16_t key = 0; key < kNumKeys; key++)
+    {
+        IgnoreError(aFlash.Get(key, 0, nullptr, nullptr));
+    }
+
+    return (testGetFlashReadCount() == readCount);
+}
+
+static void RandomOperation(Flash &aFlash, uint16_t aNumKeys)
+{
+    uint16_t key       = static_cast<uint16_t>(NextRandom() % aNumKeys);
+    uint32_t operation = NextRandom() % 10;
+
+    if (operation < 4)
+    {
+        RandomValue(sValues[key][0]);
+        SuccessOrQuit(aFlash.Set(key, sValues[key][0].mData, sValues[key][0].mLength));
+        sNumValues[key] = 1;
+    }
+    else if (operation < 7)
+    {
+        Value value;
+
+        RandomValue(value);
+
+        if (sNumValues[key] < kMaxValues)
+        {
+            SuccessOrQuit(aFlash.Add(key, value.mData, value.mLength));
+            sValues[key][sNumValues[key]++] = value;
+        }
+    }
+    else
+    {
+        int index = static_cast<int>(NextRandom() % (kMaxValues + 2)) - 1;
+
+        if (index == -1)
+        {
+            VerifyOrQuit(aFlash.Delete(key, index) == ((sNumValues[key] > 0) ? kErrorNone : kErrorNotFound));
+            sNumValues[key] = 0;
+        }
+        else if (index < sNumValues[key])
+        {
+            SuccessOrQuit(aFlash.Delete(key, index));
+            memmove(&sValues[key][index], &sValues[key][index + 1],
+                    (sNumValues[key] - index - 1) * sizeof(sValues[key][0]));
+            sNumValues[key]--;
+        }
+        else
+        {
+            VerifyOrQuit(aFlash.Delete(key, index) == kErrorNotFound);
+        }
+    }
+}
+
+static void TestRandomOperations(void)
+{
+    static const uint16_t kNumOperations = 3000;
+
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+    uint16_t  maxRecords;
+    uint16_t  numSets;
+
+    flash.Init();
+    flash.Wipe();
+    ClearModel();
+
+    // Few keys: the valid records stay within the index.
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        RandomOperation(flash, kIndexSize / kMaxValues);
+        VerifyFlash(flash);
+        VerifyOrQuit(IsIndexUsed(flash));
+
+        if (i % 100 == 0)
+        {
+            VerifyFlashAfterReset(*instance);
+        }
+    }
+
+    // All keys: more valid records than the index holds.
+    maxRecords = 0;
+
+    for (uint16_t i = 0; i < kNumOperations; i++)
+    {
+        RandomOperation(flash, kNumKeys);
+        VerifyFlash(flash);
+        maxRecords = Max(maxRecords, GetNumRecords());
+
+        if (i % 100 == 0)
+        {
+            VerifyFlashAfterReset(*instance);
+        }
+
+        if (i % 1000 == 0)
+        {
+            flash.Init();
+            VerifyFlash(flash);
+        }
+    }
+
+    VerifyOrQuit(maxRecords > kIndexSize);
+
+    // Back to few records: the next swap rebuilds the index.
+    for (uint16_t key = kIndexSize / 2; key < kNumKeys; key++)
+    {
+        IgnoreError(flash.Delete(key, -1));
+        sNumValues[key] = 0;
+    }
+
+    VerifyFlash(flash);
+
+    for (numSets = 0; !IsIndexUsed(flash); numSets++)
+    {
+        VerifyOrQuit(numSets < otPlatFlashGetSwapSize(instance));
+        RandomValue(sValues[0][0]);
+        SuccessOrQuit(flash.Set(0, sValues[0][0].mData, sValues[0][0].mLength));
+        sNumValues[0] = 1;
+    }
+
+    VerifyFlash(flash);
+    VerifyFlashAfterReset(*instance);
+
+    testFreeInstance(instance);
+    printf("TestRandomOperations passed\n");
+}
+
+static void Benchmark(uint16_t aNumKeys)
+{
+    static const uint32_t kIterations = 20000;
+
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+    uint32_t  readCount;
+    uint64_t  start;
+    uint64_t  getNs;
+    uint64_t  setNs;
+    uint32_t  sink = 0;
+
+    flash.Init();
+    flash.Wipe();
+    ClearModel();
+
+    for (uint16_t key = 0; key < aNumKeys; key++)
+    {
+        RandomValue(sValues[key][0]);
+        SuccessOrQuit(flash.Set(key, sValues[key][0].mData, sValues[key][0].mLength));
+        sNumValues[key] = 1;
+    }
+
+    readCount = testGetFlashReadCount();
+    start     = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        uint8_t  data[kMaxValueLength];
+        uint16_t length = sizeof(data);
+
+        SuccessOrQuit(flash.Get(static_cast<uint16_t>(NextRandom() % aNumKeys), 0, data, &length));
+        sink += length;
+    }
+
+    getNs     = NowNs() - start;
+    readCount = testGetFlashReadCount() - readCount;
+    start     = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        uint16_t key = static_cast<uint16_t>(NextRandom() % aNumKeys);
+
+        SuccessOrQuit(flash.Set(key, sValues[key][0].mData, sValues[key][0].mLength));
+    }
+
+    setNs = NowNs() - start;
+
+    VerifyOrQuit(sink != 0);
+    VerifyFlash(flash);
+    printf("%2u records (%s): Get %.1f flash reads, %.0f ns; Set %.0f ns\n", aNumKeys,
+           (aNumKeys <= kIndexSize) ? "indexed" : "scanned", static_cast<double>(readCount) / kIterations,
+           static_cast<double>(getNs) / kIterations, static_cast<double>(setNs) / kIterations);
+
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestRandomOperations();
+
+    Benchmark(8);
+    Benchmark(kIndexSize);
+    Benchmark(kNumKeys);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*
+ *  Test of the MPL seed set and buffered message set of Ip6::Mpl.
+ */
+
+#include <openthread/ip6.h>
+
+#include "common/message.hpp"
+#include "net/ip6.hpp"
+#include "net/ip6_mpl.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kSeedId = 0x1234;
+
+static Message *NewMplMessage(Instance &aInstance, uint16_t aSeedId, uint8_t aSequence)
+{
+    static const uint8_t kPayload[16] = {0};
+
+    Message            *message = aInstance.Get<Ip6::Ip6>().NewMessage();
+    Ip6::Header         header;
+    Ip6::HopByHopHeader hbh;
+    Ip6::MplOption      option;
+
+    VerifyOrQuit(message != nullptr);
+
+    header.InitVersionTrafficClassFlow();
+    header.SetPayloadLength(sizeof(hbh) + sizeof(option) + sizeof(kPayload));
+    header.SetNextHeader(Ip6::kProtoHopOpts);
+    header.SetHopLimit(64);
+    SuccessOrQuit(header.GetSource().FromString("fdde:ad00:beef:0:0:ff:fe00:fc00"));
+    SuccessOrQuit(header.GetDestination().FromString("ff03::fc"));
+
+    hbh.SetNextHeader(Ip6::kProtoNone);
+    hbh.SetLength(0);
+
+    option.Init(Ip6::MplOption::kSeedIdLength2);
+    option.SetSeedId(aSeedId);
+    option.SetSequence(aSequence);
+
+    SuccessOrQuit(message->Append(header));
+    SuccessOrQuit(message->Append(hbh));
+    SuccessOrQuit(message->Append(option));
+    SuccessOrQuit(message->AppendBytes(kPayload, sizeof(kPayload)));
+    message->SetOrigin(Message::kOriginThreadNetif);
+
+    return message;
+}
+
+/* Feeds a received MPL Data Message, returns the ProcessOption() result */
+static Error Receive(Instance &aInstance, uint16_t aSeedId, uint8_t aSequence)
+{
+    Message    *message = NewMplMessage(aInstance, aSeedId, aSequence);
+    Ip6::Header header;
+    OffsetRange offsetRange;
+    bool        receive = true;
+    Error       error;
+
+    SuccessOrQuit(message->Read(0, header));
+    offsetRange.Init(sizeof(Ip6::Header) + sizeof(Ip6::HopByHopHeader), sizeof(Ip6::MplOption));
+
+    error = aInstance.Get<Ip6::Mpl>().ProcessOption(*message, offsetRange, header.GetSource(), receive);
+    message->Free();
+
+    return error;
+}
+
+static uint16_t GetBufferedCount(Instance &aInstance)
+{
+    MessageQueue::Info info;
+
+    aInstance.Get<Ip6::Mpl>().GetBufferedMessageSetInfo(info);
+    return info.mNumMessages;
+}
+
+static void TestDuplicateAndRestartedSeed(void)
+{
+    Instance *instance = testInitInstance();
+
+    testStartLeader(*instance);
+
+    SuccessOrQuit(Receive(*instance, kSeedId, 100));
+    VerifyOrQuit(Receive(*instance, kSeedId, 100) == kErrorDrop);
+    SuccessOrQuit(Receive(*instance, kSeedId, 99));
+    VerifyOrQuit(Receive(*instance, kSeedId, 99) == kErrorDrop);
+
+    // A seed which rebooted restarts from a sequence far behind the
+    // window of the previous one, it must not be dropped.
+    SuccessOrQuit(Receive(*instance, kSeedId, 10));
+    VerifyOrQuit(Receive(*instance, kSeedId, 10) == kErrorDrop);
+    SuccessOrQuit(Receive(*instance, kSeedId, 11));
+    VerifyOrQuit(Receive(*instance, kSeedId, 100) == kErrorDrop);
+
+    // Entries expire after the seed set entry lifetime.
+    testAdvanceTime(*instance, (OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRY_LIFETIME + 2) * 1000);
+    SuccessOrQuit(Receive(*instance, kSeedId, 100));
+
+    testFreeInstance(instance);
+    printf("TestDuplicateAndRestartedSeed passed\n");
+}
+
+static void TestFullSeedSet(void)
+{
+    Instance *instance = testInitInstance();
+
+    testStartLeader(*instance);
+
+    for (uint16_t seed = 0; seed < OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES - 1; seed++)
+    {
+        SuccessOrQuit(Receive(*instance, 0x1000 + seed, 1));
+    }
+
+    // A sequence far behind the window takes another entry of the seed.
+    SuccessOrQuit(Receive(*instance, 0x1000, 200));
+
+    // The set is full: a new seed evicts an entry of the seed having
+    // two, and is then dropped as the last entry of a seed is never
+    // evicted.
+    SuccessOrQuit(Receive(*instance, 0x2000, 1));
+    VerifyOrQuit(Receive(*instance, 0x2001, 1) == kErrorDrop);
+
+    for (uint16_t seed = 1; seed < OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES - 1; seed++)
+    {
+        VerifyOrQuit(Receive(*instance, 0x1000 + seed, 1) == kErrorDrop);
+    }
+
+    VerifyOrQuit(Receive(*instance, 0x2000, 1) == kErrorDrop);
+
+    testFreeInstance(instance);
+    printf("TestFullSeedSet passed\n");
+}
+
+static void TestFullBufferedSet(void)
+{
+    Instance *instance = testInitInstance();
+    uint32_t  txCount;
+    uint8_t   sequence = 0;
+
+    testStartLeader(*instance);
+
+    for (; sequence < OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE; sequence++)
+    {
+        SuccessOrQuit(Receive(*instance, kSeedId, sequence));
+    }
+
+    VerifyOrQuit(GetBufferedCount(*instance) == OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE);
+
+    // With no room left for retransmissions, a received message is
+    // forwarded once and recorded.
+    txCount = testGetRadioTxCount();
+    SuccessOrQuit(Receive(*instance, kSeedId, sequence));
+    testProcess(*instance);
+    VerifyOrQuit(testGetRadioTxCount() == txCount + 1);
+    VerifyOrQuit(GetBufferedCount(*instance) == OPENTHREAD_CONFIG_MPL_BUFFERED_MESSAGE_SET_SIZE);
+    VerifyOrQuit(Receive(*instance, kSeedId, sequence) == kErrorDrop);
+
+    testFreeInstance(instance);
+    printf("TestFullBufferedSet passed\n");
+}
+
+static void TestNoBufs(void)
+{
+    Instance *instance = testInitInstance();
+    Message  *message = nullptr;
+    Message  *held[OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS];
+    uint16_t  count = 0;
+
+    testStartLeader(*instance);
+
+    message = NewMplMessage(*instance, kSeedId, 5);
+
+    // Exhaust the message buffers, the received message cannot be
+    // cloned and so is not forwarded.
+    while (count < OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS)
+    {
+        held[count] = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+
+        if (held[count] == nullptr)
+        {
+            break;
+        }
+
+        count++;
+    }
+
+    VerifyOrQuit(count < OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS);
+
+    {
+        Ip6::Header header;
+        OffsetRange offsetRange;
+        bool        receive = true;
+
+        SuccessOrQuit(message->Read(0, header));
+        offsetRange.Init(sizeof(Ip6::Header) + sizeof(Ip6::HopByHopHeader), sizeof(Ip6::MplOption));
+        SuccessOrQuit(instance->Get<Ip6::Mpl>().ProcessOption(*message, offsetRange, header.GetSource(), receive));
+        message->Free();
+    }
+
+    VerifyOrQuit(GetBufferedCount(*instance) == 0);
+
+    while (count > 0)
+    {
+        held[--count]->Free();
+    }
+
+    // It is not recorded as received, a retransmission is accepted.
+    SuccessOrQuit(Receive(*instance, kSeedId, 5));
+    VerifyOrQuit(GetBufferedCount(*instance) == 1);
+    VerifyOrQuit(Receive(*instance, kSeedId, 5) == kErrorDrop);
+
+    testFreeInstance(instance);
+    printf("TestNoBufs passed\n");
+}
+
+int main(void)
+{
+    TestDuplicateAndRestartedSeed();
+    TestFullSeedSet();
+    TestFullBufferedSet();
+    TestNoBufs();
+
+    printf("All tests passed\n");
+    return 0;
+}
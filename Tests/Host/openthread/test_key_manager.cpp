@@ -0,0 +1,149 @@
+/*
+ *  Test of the derived key cache of KeyManager: the MLE/MAC keys shall match
+ *  a direct HMAC-SHA256 of the network key, and a key rotation or a repeated
+ *  request for the same key sequence shall not recompute the cached keys.
+ */
+
+#include <string.h>
+
+#include <openssl/evp.h>
+
+#include "thread/key_manager.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint8_t kNetworkKey1[] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+                                       0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff};
+static const uint8_t kNetworkKey2[] = {0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+                                       0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};
+
+static void SetNetworkKey(Instance &aInstance, const uint8_t *aKey)
+{
+    NetworkKey networkKey;
+
+    memcpy(networkKey.m8, aKey, sizeof(networkKey.m8));
+    aInstance.Get<KeyManager>().SetNetworkKey(networkKey);
+}
+
+/* The MLE key is the first half of HMAC-SHA256(network key, key sequence || "Thread") */
+static void VerifyMleKey(Instance &aInstance, const uint8_t *aNetworkKey, uint32_t aKeySequence)
+{
+    uint8_t data[sizeof(uint32_t) + 6];
+    uint8_t hash[32];
+
+    BigEndian::WriteUint32(aKeySequence, data);
+    memcpy(data + sizeof(uint32_t), "Thread", 6);
+    VerifyOrQuit(EVP_Q_mac(nullptr, "HMAC", nullptr, "SHA256", nullptr, aNetworkKey, sizeof(kNetworkKey1), data,
+                           sizeof(data), hash, sizeof(hash), nullptr) != nullptr);
+
+    VerifyOrQuit(memcmp(aInstance.Get<KeyManager>().GetTemporaryMleKey(aKeySequence).GetKey().GetBytes(), hash,
+                        Mle::Key::kSize) == 0);
+}
+
+static uint32_t HmacCountOf(Instance &aInstance, uint32_t aKeySequence)
+{
+    uint32_t count = testGetHmacCount();
+
+    aInstance.Get<KeyManager>().GetTemporaryMleKey(aKeySequence);
+
+    return testGetHmacCount() - count;
+}
+
+static void TestDerivedKeys(void)
+{
+    static const uint32_t kKeySequences[] = {0, 1, 0xffffffff, 7, 100, 0, 7};
+
+    Instance *instance = testInitInstance();
+
+    SetNetworkKey(*instance, kNetworkKey1);
+
+    for (uint32_t keySequence : kKeySequences)
+    {
+        VerifyMleKey(*instance, kNetworkKey1, keySequence);
+    }
+
+    // A new network key drops the keys derived from the previous one.
+    SetNetworkKey(*instance, kNetworkKey2);
+
+    for (uint32_t keySequence : kKeySequences)
+    {
+        VerifyMleKey(*instance, kNetworkKey2, keySequence);
+    }
+
+    testFreeInstance(instance);
+    printf("TestDerivedKeys passed\n");
+}
+
+static void TestKeyRotation(void)
+{
+    Instance   *instance   = testInitInstance();
+    KeyManager &keyManager = instance->Get<KeyManager>();
+    uint32_t    count;
+
+    SetNetworkKey(*instance, kNetworkKey1);
+    keyManager.SetCurrentKeySequence(10, KeyManager::kForceUpdate);
+
+    // The previous, current and next keys are cached.
+    VerifyOrQuit(HmacCountOf(*instance, 9) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 10) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 11) == 0);
+
+    // A rotation only derives the new next key.
+    count = testGetHmacCount();
+    keyManager.SetCurrentKeySequence(11, KeyManager::kForceUpdate);
+    VerifyOrQuit(testGetHmacCount() - count == 1);
+    VerifyMleKey(*instance, kNetworkKey1, 12);
+
+    testFreeInstance(instance);
+    printf("TestKeyRotation passed\n");
+}
+
+static void TestOtherKeySequences(void)
+{
+    static const uint8_t kOtherEntries = OPENTHREAD_CONFIG_KEY_MANAGER_KEY_CACHE_SIZE - 3;
+
+    Instance   *instance   = testInitInstance();
+    KeyManager &keyManager = instance->Get<KeyManager>();
+
+    SetNetworkKey(*instance, kNetworkKey1);
+    keyManager.SetCurrentKeySequence(50, KeyManager::kForceUpdate);
+
+    // The entries left by the neighbors of the current key sequence
+    // hold the other keys in least recently used order.
+    for (uint32_t i = 0; i < kOtherEntries; i++)
+    {
+        VerifyOrQuit(HmacCountOf(*instance, 100 + i) == 1);
+        VerifyOrQuit(HmacCountOf(*instance, 100 + i) == 0);
+    }
+
+    VerifyOrQuit(HmacCountOf(*instance, 100) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 200) == 1);
+
+    // 101 was the least recently used, 100 was refreshed.
+    VerifyOrQuit(HmacCountOf(*instance, 100) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 101) == 1);
+
+    // The neighbors of the current key sequence are never replaced.
+    VerifyOrQuit(HmacCountOf(*instance, 49) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 50) == 0);
+    VerifyOrQuit(HmacCountOf(*instance, 51) == 0);
+
+    VerifyMleKey(*instance, kNetworkKey1, 101);
+    VerifyMleKey(*instance, kNetworkKey1, 200);
+
+    testFreeInstance(instance);
+    printf("TestOtherKeySequences passed\n");
+}
+
+int main(void)
+{
+    TestDerivedKeys();
+    TestKeyRotation();
+    TestOtherKeySequences();
+
+    printf("All tests passed\n");
+    return 0;
+}
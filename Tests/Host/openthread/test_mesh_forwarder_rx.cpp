@@ -0,0 +1,400 @@
+/*
+ *  Test of the receive path of MeshForwarder: single frame and fragmented
+ *  UDP datagrams are fed to the radio and shall reach a socket unchanged,
+ *  with all message buffers given back. A first fragment announcing a
+ *  datagram smaller than itself is dropped. Also benchmarks a received frame
+ *  and the sizing of a message for a first fragment in one step against the
+ *  former append and resize.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include <openthread/udp.h>
+
+#include "common/frame_builder.hpp"
+#include "common/message.hpp"
+#include "mac/mac.hpp"
+#include "net/checksum.hpp"
+#include "net/ip6.hpp"
+#include "net/ip6_filter.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kUdpPort       = 1234;
+static const uint8_t  kMacHeaderSize = 21; // Data frame, PAN ID compression, extended addresses
+static const uint8_t  kMaxPayload    = OT_RADIO_FRAME_MAX_SIZE - kMacHeaderSize - sizeof(uint16_t);
+
+static const uint8_t kSenderAddress[sizeof(Mac::ExtAddress)] = {0x1a, 0x2b, 0x3c, 0x4d, 0x5e, 0x6f, 0x70, 0x81};
+
+static uint8_t  sSent[1280];
+static uint16_t sSentLength;
+static uint16_t sNumReceived;
+static uint8_t  sSequence;
+static uint32_t sRandomState = 0x0badcafe;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    const Message &message = AsCoreType(aMessage);
+    uint8_t        payload[sizeof(sSent)];
+
+    VerifyOrQuit(message.GetLength() - message.GetOffset() == sSentLength);
+    VerifyOrQuit(message.ReadBytes(message.GetOffset(), payload, sSentLength) == sSentLength);
+    VerifyOrQuit(memcmp(payload, sSent, sSentLength) == 0);
+
+    sNumReceived++;
+}
+
+static void GetMacAddresses(Instance &aInstance, Mac::Addresses &aMacAddrs)
+{
+    Mac::ExtAddress sender;
+
+    sender.Set(kSenderAddress);
+    aMacAddrs.mSource.SetExtended(sender);
+    aMacAddrs.mDestination.SetExtended(aInstance.Get<Mac::Mac>().GetExtAddress());
+}
+
+/* Link-local UDP datagram from the sender to the instance, with `sSent` as payload */
+static Message *NewDatagram(Instance &aInstance, uint16_t aPayloadLength)
+{
+    Message         *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+    Mac::Addresses   macAddrs;
+    Ip6::Header      ip6Header;
+    Ip6::Udp::Header udpHeader;
+
+    VerifyOrQuit(message != nullptr);
+    GetMacAddresses(aInstance, macAddrs);
+
+    for (uint16_t i = 0; i < aPayloadLength; i++)
+    {
+        sSent[i] = static_cast<uint8_t>(NextRandom());
+    }
+
+    sSentLength = aPayloadLength;
+
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + aPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(255);
+    ip6Header.GetSource().SetToLinkLocalAddress(macAddrs.mSource.GetExtended());
+    ip6Header.GetDestination().SetToLinkLocalAddress(macAddrs.mDestination.GetExtended());
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(kUdpPort);
+    udpHeader.SetDestinationPort(kUdpPort);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->AppendBytes(sSent, aPayloadLength));
+
+    message->SetOffset(sizeof(ip6Header));
+    Checksum::UpdateMessageChecksum(*message, ip6Header.GetSource(), ip6Header.GetDestination(), Ip6::kProtoUdp);
+    message->SetOffset(0);
+
+    return message;
+}
+
+/* Unsecured data frame from the sender, `aPayload` is the 6LoWPAN payload */
+static uint16_t BuildFrame(Instance &aInstance, const uint8_t *aPayload, uint16_t aLength, uint8_t *aPsdu)
+{
+    const Mac::ExtAddress &dst   = aInstance.Get<Mac::Mac>().GetExtAddress();
+    Mac::PanId             panId = aInstance.Get<Mac::Mac>().GetPanId();
+    uint8_t               *cur   = aPsdu;
+
+    VerifyOrQuit(aLength <= kMaxPayload);
+
+    // Frame Control: data, PAN ID compression, 2006, extended addresses
+    *cur++ = 0x41;
+    *cur++ = 0xdc;
+    *cur++ = sSequence++;
+    LittleEndian::WriteUint16(panId, cur);
+    cur += sizeof(uint16_t);
+
+    for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i++)
+    {
+        *cur++ = dst.m8[sizeof(Mac::ExtAddress) - 1 - i];
+    }
+
+    for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i++)
+    {
+        *cur++ = kSenderAddress[sizeof(Mac::ExtAddress) - 1 - i];
+    }
+
+    memcpy(cur, aPayload, aLength);
+    cur += aLength;
+
+    // FCS, not checked by the MAC
+    *cur++ = 0;
+    *cur++ = 0;
+
+    return static_cast<uint16_t>(cur - aPsdu);
+}
+
+/*
+ * Compresses the datagram and sends it in one frame when it fits, else in a
+ * first fragment and next fragments. `aDatagramSize` overrides the datagram
+ * size announced in the fragment headers when not zero.
+ */
+static void SendDatagram(Instance &aInstance, Message &aDatagram, uint16_t aDatagramSize = 0)
+{
+    uint8_t        payload[kMaxPayload];
+    uint8_t        psdu[OT_RADIO_FRAME_MAX_SIZE];
+    FrameBuilder   frameBuilder;
+    Mac::Addresses macAddrs;
+    uint16_t       headerLength;
+    uint16_t       size = (aDatagramSize != 0) ? aDatagramSize : aDatagram.GetLength();
+    uint16_t       tag  = static_cast<uint16_t>(NextRandom());
+
+    GetMacAddresses(aInstance, macAddrs);
+
+    frameBuilder.Init(payload, sizeof(payload));
+    SuccessOrQuit(aInstance.Get<Lowpan::Lowpan>().Compress(aDatagram, macAddrs, frameBuilder));
+    headerLength = frameBuilder.GetLength();
+
+    if ((aDatagramSize == 0) && (headerLength + aDatagram.GetLength() - aDatagram.GetOffset() <= kMaxPayload))
+    {
+        SuccessOrQuit(frameBuilder.AppendBytesFromMessage(aDatagram, aDatagram.GetOffset(),
+                                                          aDatagram.GetLength() - aDatagram.GetOffset()));
+        testReceiveFrame(aInstance, psdu, BuildFrame(aInstance, payload, frameBuilder.GetLength(), psdu), 11);
+        ExitNow();
+    }
+
+    {
+        Lowpan::FragmentHeader::FirstFrag firstFrag;
+        uint16_t                          offset = aDatagram.GetOffset();
+        uint16_t                          length;
+
+        // The payload of a fragment but the last ends on an 8 byte boundary
+        // of the uncompressed datagram.
+        length = kMaxPayload - sizeof(firstFrag) - headerLength;
+        length = ((offset + length) & ~7) - offset;
+        length = (offset + length < aDatagram.GetLength()) ? length : aDatagram.GetLength() - offset;
+
+        frameBuilder.Init(payload, sizeof(payload));
+        firstFrag.Init(size, tag);
+        SuccessOrQuit(frameBuilder.Append(firstFrag));
+        aDatagram.SetOffset(0);
+        SuccessOrQuit(aInstance.Get<Lowpan::Lowpan>().Compress(aDatagram, macAddrs, frameBuilder));
+        SuccessOrQuit(frameBuilder.AppendBytesFromMessage(aDatagram, offset, length));
+        testReceiveFrame(aInstance, psdu, BuildFrame(aInstance, payload, frameBuilder.GetLength(), psdu), 11);
+
+        for (offset += length; offset < aDatagram.GetLength(); offset += length)
+        {
+            Lowpan::FragmentHeader::NextFrag nextFrag;
+
+            length = (kMaxPayload - sizeof(nextFrag)) & ~7;
+            length = (offset + length < aDatagram.GetLength()) ? length : aDatagram.GetLength() - offset;
+
+            frameBuilder.Init(payload, sizeof(payload));
+            nextFrag.Init(size, tag, offset);
+            SuccessOrQuit(frameBuilder.Append(nextFrag));
+            SuccessOrQuit(frameBuilder.AppendBytesFromMessage(aDatagram, offset, length));
+            testReceiveFrame(aInstance, psdu, BuildFrame(aInstance, payload, frameBuilder.GetLength(), psdu), 11);
+        }
+    }
+
+exit:
+    return;
+}
+
+static Instance *InitReceiver(otUdpSocket &aSocket)
+{
+    Instance  *instance = testInitInstance();
+    otSockAddr sockName;
+
+    testStartLeader(*instance);
+    SuccessOrQuit(instance->Get<Ip6::Filter>().AddUnsecurePort(kUdpPort));
+
+    memset(&sockName, 0, sizeof(sockName));
+    sockName.mPort = kUdpPort;
+    SuccessOrQuit(otUdpOpen(instance, &aSocket, HandleUdpReceive, nullptr));
+    SuccessOrQuit(otUdpBind(instance, &aSocket, &sockName, OT_NETIF_THREAD_INTERNAL));
+
+    return instance;
+}
+
+static void TestReceive(void)
+{
+    otUdpSocket socket;
+    Instance   *instance = InitReceiver(socket);
+    uint16_t    freeBuffers;
+    uint16_t    expected = 0;
+
+    testProcess(*instance);
+    freeBuffers  = instance->Get<MessagePool>().GetFreeBufferCount();
+    sNumReceived = 0;
+
+    // Single frames up to the largest payload, then datagrams of one to
+    // many fragments, the last one of any size.
+    for (uint16_t length = 0; length <= 1200; length += (length < 120) ? 1 : 37)
+    {
+        Message *datagram = NewDatagram(*instance, length);
+
+        SendDatagram(*instance, *datagram);
+        datagram->Free();
+        expected++;
+
+        VerifyOrQuit(sNumReceived == expected);
+        VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+    }
+
+    SuccessOrQuit(otUdpClose(instance, &socket));
+    testFreeInstance(instance);
+    printf("TestReceive passed\n");
+}
+
+static void TestDatagramSizeTooSmall(void)
+{
+    otUdpSocket socket;
+    Instance   *instance = InitReceiver(socket);
+    Message    *datagram;
+    uint16_t    freeBuffers;
+
+    testProcess(*instance);
+    freeBuffers  = instance->Get<MessagePool>().GetFreeBufferCount();
+    sNumReceived = 0;
+
+    // The first fragment carries more than the announced datagram size.
+    datagram = NewDatagram(*instance, 300);
+    SendDatagram(*instance, *datagram, 64);
+    datagram->Free();
+
+    VerifyOrQuit(sNumReceived == 0);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    // The announced size is checked against the uncompressed headers
+    // and the payload of the first fragment, the exact size passes.
+    datagram = NewDatagram(*instance, 300);
+    SendDatagram(*instance, *datagram, datagram->GetLength());
+    datagram->Free();
+
+    VerifyOrQuit(sNumReceived == 1);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    SuccessOrQuit(otUdpClose(instance, &socket));
+    testFreeInstance(instance);
+    printf("TestDatagramSizeTooSmall passed\n");
+}
+
+static void Benchmark(void)
+{
+    static const uint32_t kIterations   = 20000;
+    static const uint16_t kHeaderLength = sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header);
+    static const uint16_t kDatagramSize = 1280;
+
+    otUdpSocket socket;
+    Instance   *instance = InitReceiver(socket);
+    Message    *datagram;
+    uint8_t     headers[kHeaderLength];
+    uint8_t     payload[kMaxPayload];
+    uint64_t    start;
+    uint64_t    frameNs;
+    uint64_t    fragmentsNs;
+    uint64_t    formerNs;
+    uint64_t    sizedNs;
+
+    sNumReceived = 0;
+    memset(headers, 0x60, sizeof(headers));
+    memset(payload, 0x5a, sizeof(payload));
+
+    // A received single frame datagram and a 1280 byte datagram in
+    // fragments, from the radio to the socket.
+    datagram = NewDatagram(*instance, 60);
+    start    = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        datagram->SetOffset(0);
+        SendDatagram(*instance, *datagram);
+    }
+
+    frameNs = NowNs() - start;
+    datagram->Free();
+
+    datagram = NewDatagram(*instance, kDatagramSize - kHeaderLength);
+    start    = NowNs();
+
+    for (uint32_t i = 0; i < kIterations / 10; i++)
+    {
+        datagram->SetOffset(0);
+        SendDatagram(*instance, *datagram);
+    }
+
+    fragmentsNs = NowNs() - start;
+    datagram->Free();
+
+    VerifyOrQuit(sNumReceived == kIterations + kIterations / 10);
+
+    // The message of a first fragment: the payload used to be appended
+    // and the message then resized to the datagram size.
+    start = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Message *message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(headers, sizeof(headers)));
+        SuccessOrQuit(message->AppendBytes(payload, sizeof(payload)));
+        SuccessOrQuit(message->SetLength(kDatagramSize));
+        message->Free();
+    }
+
+    formerNs = NowNs() - start;
+    start    = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Message *message = instance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(headers, sizeof(headers)));
+        SuccessOrQuit(message->SetLength(kDatagramSize));
+        message->WriteBytes(sizeof(headers), payload, sizeof(payload));
+        message->Free();
+    }
+
+    sizedNs = NowNs() - start;
+
+    printf("received frame %.0f ns, %u byte datagram in fragments %.0f ns; first fragment message: append and "
+           "resize %.0f ns, sized once %.0f ns\n",
+           static_cast<double>(frameNs) / kIterations, kDatagramSize,
+           static_cast<double>(fragmentsNs) / (kIterations / 10), static_cast<double>(formerNs) / kIterations,
+           static_cast<double>(sizedNs) / kIterations);
+
+    SuccessOrQuit(otUdpClose(instance, &socket));
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestReceive();
+    TestDatagramSizeTooSmall();
+    Benchmark();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,212 @@
+/*
+ *  Test of the ready view of PriorityQueue, used by the direct transmission
+ *  of MeshForwarder, and benchmark of the lookup of the next ready message
+ *  when most of the send queue waits for address resolution.
+ */
+
+#include <time.h>
+
+#include "common/message.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kMaxMessages = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
+
+static Message *NewMessage(Instance &aInstance, Message::Priority aPriority, bool aResolving)
+{
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetPriority(aPriority));
+    message->SetDirectTransmission();
+    message->SetResolvingAddress(aResolving);
+
+    return message;
+}
+
+static void VerifyViewInfo(const PriorityQueue &aQueue, uint16_t aReady, uint16_t aResolving, uint16_t aIndirect)
+{
+    PriorityQueue::ViewInfo info;
+
+    aQueue.GetViewInfo(info);
+    VerifyOrQuit(info.mNumReady == aReady);
+    VerifyOrQuit(info.mNumResolving == aResolving);
+    VerifyOrQuit(info.mNumIndirect == aIndirect);
+}
+
+static void TestReadyView(void)
+{
+    Instance     *instance = testInitInstance();
+    PriorityQueue queue;
+    Message      *messages[4];
+
+    for (Message *&message : messages)
+    {
+        message = NewMessage(*instance, Message::kPriorityNormal, /* aResolving */ false);
+        queue.Enqueue(*message);
+    }
+
+    VerifyViewInfo(queue, 4, 0, 0);
+
+    messages[1]->SetResolvingAddress(true);
+    messages[2]->ClearDirectTransmission();
+    VerifyViewInfo(queue, 2, 1, 1);
+
+    VerifyOrQuit(queue.GetHeadReady() == messages[0]);
+    VerifyOrQuit(queue.GetNextReady(*messages[0]) == messages[3]);
+    VerifyOrQuit(queue.GetNextReady(*messages[3]) == nullptr);
+
+    // A message which becomes ready is appended to the view of its
+    // priority level, a higher priority one comes first.
+    messages[1]->SetResolvingAddress(false);
+    VerifyOrQuit(queue.GetNextReady(*messages[3]) == messages[1]);
+
+    queue.Dequeue(*messages[3]);
+    SuccessOrQuit(messages[3]->SetPriority(Message::kPriorityHigh));
+    queue.Enqueue(*messages[3]);
+    VerifyOrQuit(queue.GetHeadReady() == messages[3]);
+    VerifyOrQuit(queue.GetNextReady(*messages[3]) == messages[0]);
+    VerifyViewInfo(queue, 3, 0, 1);
+
+    queue.DequeueAndFreeAll();
+    VerifyViewInfo(queue, 0, 0, 0);
+
+    testFreeInstance(instance);
+    printf("TestReadyView passed\n");
+}
+
+static void TestRemoveReadyDuringIteration(void)
+{
+    Instance     *instance = testInitInstance();
+    PriorityQueue queue;
+    Message      *messages[3];
+    uint8_t       visited = 0;
+
+    // The ready view is in the order the messages became ready, which
+    // differs from the queue order: [1] [2] [0].
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        messages[i] = NewMessage(*instance, Message::kPriorityNormal, /* aResolving */ (i == 0));
+        queue.Enqueue(*messages[i]);
+    }
+
+    messages[0]->SetResolvingAddress(false);
+
+    // Iterate as `MeshForwarder::PrepareNextDirectTransmission()` does
+    // when each message needs an address query: the current message
+    // leaves the ready view before the next one is looked up.
+    for (Message *message = queue.GetHeadReady(); message != nullptr;)
+    {
+        VerifyOrQuit(visited < 3);
+        visited++;
+        message->SetResolvingAddress(true);
+        message = queue.GetNextReady(*message);
+    }
+
+    VerifyOrQuit(visited == 3);
+    VerifyViewInfo(queue, 0, 3, 0);
+
+    // Same when the message is removed from the queue, with the next
+    // message looked up first as the forwarder does.
+    for (Message *message : messages)
+    {
+        message->SetResolvingAddress(false);
+    }
+
+    visited = 0;
+
+    for (Message *message = queue.GetHeadReady(); message != nullptr;)
+    {
+        Message *next;
+
+        visited++;
+        message->ClearDirectTransmission();
+        next = queue.GetNextReady(*message);
+        queue.DequeueAndFree(*message);
+        message = next;
+    }
+
+    VerifyOrQuit(visited == 3);
+    VerifyOrQuit(queue.GetHead() == nullptr);
+
+    testFreeInstance(instance);
+    printf("TestRemoveReadyDuringIteration passed\n");
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void BenchmarkNextReady(void)
+{
+    static const uint32_t kIterations = 100000;
+
+    Instance     *instance = testInitInstance();
+    PriorityQueue queue;
+    Message      *ready;
+    uint16_t      parked = 0;
+    uint64_t      start;
+    uint64_t      viewNs;
+    uint64_t      walkNs;
+    uintptr_t     sink = 0;
+
+    // All the message buffers but a few are parked waiting for address
+    // resolution ahead of one ready message.
+    while (parked < kMaxMessages - 8)
+    {
+        queue.Enqueue(*NewMessage(*instance, Message::kPriorityNormal, /* aResolving */ true));
+        parked++;
+    }
+
+    ready = NewMessage(*instance, Message::kPriorityNormal, /* aResolving */ false);
+    queue.Enqueue(*ready);
+
+    start = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        sink += reinterpret_cast<uintptr_t>(queue.GetHeadReady());
+    }
+
+    viewNs = NowNs() - start;
+    start  = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        // The scan from the head of the send queue done before the views.
+        const Message *message = queue.GetHead();
+
+        while ((message != nullptr) && (!message->IsDirectTransmission() || message->IsResolvingAddress()))
+        {
+            message = message->GetNext();
+        }
+
+        sink += reinterpret_cast<uintptr_t>(message);
+    }
+
+    walkNs = NowNs() - start;
+
+    VerifyOrQuit(sink != 0);
+    printf("next ready message behind %u parked: ready view %.1f ns, queue scan %.1f ns\n", parked,
+           static_cast<double>(viewNs) / kIterations, static_cast<double>(walkNs) / kIterations);
+
+    queue.DequeueAndFreeAll();
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestReadyView();
+    TestRemoveReadyDuringIteration();
+    BenchmarkNextReady();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,472 @@
+/*
+ *  Test of the NAT64 translator mappings: hundreds of UDP and ICMP flows from
+ *  the Thread network share one IPv4 address by ports, or take an address of
+ *  the CIDR each, and the replies shall reach the flow they belong to until
+ *  the mapping expires. Also benchmarks the translation with up to the
+ *  maximum number of mappings against a linear scan of them.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "common/message.hpp"
+#include "net/ip4_types.hpp"
+#include "net/ip6.hpp"
+#include "net/nat64_translator.hpp"
+#include "net/udp6.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+typedef Nat64::Translator Translator;
+
+static const uint16_t kNumFlows      = Translator::kAddressMappingPoolSize;
+static const uint16_t kServerPort    = 5683;
+static const uint16_t kPayloadLength = 32;
+static const uint32_t kIdleTimeout   = Translator::kAddressMappingIdleTimeoutMsec;
+
+struct Flow
+{
+    Ip6::Address mIp6;
+    uint16_t     mPortOrId;
+    bool         mIsIcmp;
+    Ip4::Address mIp4;
+    uint16_t     mTranslatedPortOrId;
+};
+
+static Flow         sFlows[kNumFlows + 1];
+static Ip6::Prefix  sNat64Prefix;
+static Ip4::Address sServer;
+static uint32_t     sRandomState = 0x7f4a7c15;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static Instance *InitTranslator(const char *aCidr)
+{
+    Instance *instance = testInitInstance();
+    Ip4::Cidr cidr;
+
+    SuccessOrQuit(cidr.FromString(aCidr));
+    SuccessOrQuit(sNat64Prefix.FromString("64:ff9b::/96"));
+    SuccessOrQuit(sServer.FromString("198.51.100.7"));
+
+    instance->Get<Translator>().SetEnabled(true);
+    SuccessOrQuit(instance->Get<Translator>().SetIp4Cidr(cidr));
+    instance->Get<Translator>().SetNat64Prefix(sNat64Prefix);
+    VerifyOrQuit(instance->Get<Translator>().GetState() == Nat64::kStateActive);
+
+    return instance;
+}
+
+/* Flows from 16 hosts of the Thread network, one in four an ICMP echo session */
+static void InitFlows(void)
+{
+    for (uint16_t i = 0; i <= kNumFlows; i++)
+    {
+        Flow &flow = sFlows[i];
+
+        SuccessOrQuit(flow.mIp6.FromString("fd00:db8::"));
+        flow.mIp6.GetIid().SetBytes(reinterpret_cast<const uint8_t *>("\x02\x11\x22\xff\xfe\x33\x44\x00"));
+        flow.mIp6.mFields.m8[15] = static_cast<uint8_t>(i % 16);
+        flow.mIsIcmp             = (i % 4 == 3);
+        flow.mPortOrId           = static_cast<uint16_t>(flow.mIsIcmp ? 0x1000 + i : 49152 + i);
+    }
+}
+
+static Message *NewIp6Datagram(Instance &aInstance, const Flow &aFlow)
+{
+    Message    *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+    Ip6::Header header;
+    uint8_t     payload[kPayloadLength];
+
+    VerifyOrQuit(message != nullptr);
+    memset(payload, 0x5a, sizeof(payload));
+
+    header.InitVersionTrafficClassFlow();
+    header.SetPayloadLength(sizeof(Ip6::Udp::Header) + kPayloadLength);
+    header.SetHopLimit(64);
+    header.SetSource(aFlow.mIp6);
+    header.GetDestination().SynthesizeFromIp4Address(sNat64Prefix, sServer);
+
+    if (aFlow.mIsIcmp)
+    {
+        Ip6::Icmp::Header icmpHeader;
+
+        icmpHeader.Clear();
+        icmpHeader.SetType(Ip6::Icmp::Header::kTypeEchoRequest);
+        icmpHeader.SetId(aFlow.mPortOrId);
+        header.SetNextHeader(Ip6::kProtoIcmp6);
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->Append(icmpHeader));
+    }
+    else
+    {
+        Ip6::Udp::Header udpHeader;
+
+        udpHeader.SetSourcePort(aFlow.mPortOrId);
+        udpHeader.SetDestinationPort(kServerPort);
+        udpHeader.SetLength(sizeof(Ip6::Udp::Header) + kPayloadLength);
+        udpHeader.SetChecksum(0);
+        header.SetNextHeader(Ip6::kProtoUdp);
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->Append(udpHeader));
+    }
+
+    SuccessOrQuit(message->AppendBytes(payload, sizeof(payload)));
+
+    return message;
+}
+
+/* The reply of the server to a flow, to the given IPv4 address and port or ICMP ID */
+static Message *NewIp4Datagram(Instance &aInstance, const Flow &aFlow, const Ip4::Address &aIp4, uint16_t aPortOrId)
+{
+    Message    *message = aInstance.Get<Translator>().NewIp4Message(Message::Settings::GetDefault());
+    Ip4::Header header;
+    uint8_t     payload[kPayloadLength];
+
+    VerifyOrQuit(message != nullptr);
+    memset(payload, 0xa5, sizeof(payload));
+
+    header.Clear();
+    header.InitVersionIhl();
+    header.SetTotalLength(sizeof(Ip4::Header) + sizeof(Ip6::Udp::Header) + kPayloadLength);
+    header.SetTtl(64);
+    header.SetSource(sServer);
+    header.SetDestination(aIp4);
+
+    if (aFlow.mIsIcmp)
+    {
+        Ip4::Icmp::Header icmpHeader;
+
+        icmpHeader.Clear();
+        icmpHeader.SetType(Ip4::Icmp::Header::kTypeEchoReply);
+        icmpHeader.SetId(aPortOrId);
+        header.SetProtocol(Ip4::kProtoIcmp);
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->Append(icmpHeader));
+    }
+    else
+    {
+        Ip6::Udp::Header udpHeader;
+
+        udpHeader.SetSourcePort(kServerPort);
+        udpHeader.SetDestinationPort(aPortOrId);
+        udpHeader.SetLength(sizeof(Ip6::Udp::Header) + kPayloadLength);
+        udpHeader.SetChecksum(0);
+        header.SetProtocol(Ip4::kProtoUdp);
+        SuccessOrQuit(message->Append(header));
+        SuccessOrQuit(message->Append(udpHeader));
+    }
+
+    SuccessOrQuit(message->AppendBytes(payload, sizeof(payload)));
+
+    return message;
+}
+
+/* Sends a datagram of the flow to the server, returns the result and its IPv4 source */
+static Translator::Result SendFromFlow(Instance &aInstance, const Flow &aFlow, Ip4::Address &aIp4, uint16_t &aPortOrId)
+{
+    Message           *message = NewIp6Datagram(aInstance, aFlow);
+    Translator::Result result  = aInstance.Get<Translator>().TranslateFromIp6(*message);
+    Ip4::Headers       headers;
+
+    if (result == Translator::kForward)
+    {
+        SuccessOrQuit(headers.ParseFrom(*message));
+        VerifyOrQuit(headers.GetDestinationAddress() == sServer);
+        aIp4      = headers.GetSourceAddress();
+        aPortOrId = aFlow.mIsIcmp ? headers.GetIcmpHeader().GetId() : headers.GetSourcePort();
+    }
+
+    message->Free();
+
+    return result;
+}
+
+/* Sends the reply of the server to the flow, returns the result and checks where it goes */
+static Translator::Result ReplyToFlow(Instance &aInstance, const Flow &aFlow)
+{
+    Message           *message = NewIp4Datagram(aInstance, aFlow, aFlow.mIp4, aFlow.mTranslatedPortOrId);
+    Translator::Result result  = aInstance.Get<Translator>().TranslateToIp6(*message);
+    Ip6::Headers       headers;
+    Ip6::Address       server;
+
+    if (result == Translator::kForward)
+    {
+        server.SynthesizeFromIp4Address(sNat64Prefix, sServer);
+        SuccessOrQuit(headers.ParseFrom(*message));
+        VerifyOrQuit(headers.GetSourceAddress() == server);
+        VerifyOrQuit(headers.GetDestinationAddress() == aFlow.mIp6);
+
+        if (aFlow.mIsIcmp)
+        {
+            VerifyOrQuit(headers.GetIcmpHeader().GetType() == Ip6::Icmp::Header::kTypeEchoReply);
+            VerifyOrQuit(headers.GetIcmpHeader().GetId() == aFlow.mPortOrId);
+        }
+        else
+        {
+            VerifyOrQuit(headers.GetDestinationPort() == aFlow.mPortOrId);
+        }
+    }
+
+    message->Free();
+
+    return result;
+}
+
+static void OpenFlow(Instance &aInstance, Flow &aFlow)
+{
+    Ip4::Address ip4;
+    uint16_t     portOrId;
+
+    VerifyOrQuit(SendFromFlow(aInstance, aFlow, aFlow.mIp4, aFlow.mTranslatedPortOrId) == Translator::kForward);
+
+    // The next datagram of the flow uses the same mapping.
+    VerifyOrQuit(SendFromFlow(aInstance, aFlow, ip4, portOrId) == Translator::kForward);
+    VerifyOrQuit(ip4 == aFlow.mIp4);
+    VerifyOrQuit(portOrId == aFlow.mTranslatedPortOrId);
+}
+
+static uint16_t GetNumMappings(Instance &aInstance)
+{
+    Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping              mapping;
+    uint16_t                           numMappings = 0;
+
+    aInstance.Get<Translator>().InitAddressMappingIterator(iterator);
+
+    while (aInstance.Get<Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        numMappings++;
+    }
+
+    return numMappings;
+}
+
+static void TestSharedAddress(void)
+{
+    Instance                 *instance = InitTranslator("192.0.2.1/32");
+    Translator::ErrorCounters errorCounters;
+    Ip4::Address              ip4;
+    uint16_t                  portOrId;
+    Flow                      stranger;
+
+    InitFlows();
+
+    for (uint16_t i = 0; i < kNumFlows; i++)
+    {
+        OpenFlow(*instance, sFlows[i]);
+
+        // All flows share the address, each one has its own port or
+        // ICMP ID of the dynamic range with the parity of the original.
+        VerifyOrQuit(sFlows[i].mIp4 == sFlows[0].mIp4);
+        VerifyOrQuit(sFlows[i].mTranslatedPortOrId >= Translator::kTranslationPortRangeStart);
+        VerifyOrQuit(((sFlows[i].mTranslatedPortOrId ^ sFlows[i].mPortOrId) & 1) == 0);
+
+        for (uint16_t j = 0; j < i; j++)
+        {
+            VerifyOrQuit(sFlows[j].mTranslatedPortOrId != sFlows[i].mTranslatedPortOrId);
+        }
+    }
+
+    VerifyOrQuit(GetNumMappings(*instance) == kNumFlows);
+
+    for (uint16_t round = 0; round < 4; round++)
+    {
+        for (uint16_t i = 0; i < kNumFlows; i++)
+        {
+            VerifyOrQuit(ReplyToFlow(*instance, sFlows[i]) == Translator::kForward);
+        }
+    }
+
+    // The pool is full and no mapping has expired.
+    VerifyOrQuit(SendFromFlow(*instance, sFlows[kNumFlows], ip4, portOrId) == Translator::kDrop);
+    instance->Get<Translator>().GetErrorCounters(errorCounters);
+    VerifyOrQuit(errorCounters.mCount6To4[Translator::ErrorCounters::kNoMapping] == 1);
+
+    // A reply to a port without mapping.
+    stranger                     = sFlows[0];
+    stranger.mTranslatedPortOrId = static_cast<uint16_t>(Translator::kTranslationPortRangeStart - 1);
+    VerifyOrQuit(ReplyToFlow(*instance, stranger) == Translator::kDrop);
+    instance->Get<Translator>().GetErrorCounters(errorCounters);
+    VerifyOrQuit(errorCounters.mCount4To6[Translator::ErrorCounters::kNoMapping] == 1);
+
+    testFreeInstance(instance);
+    printf("TestSharedAddress passed\n");
+}
+
+static void TestExpiry(void)
+{
+    Instance *instance;
+    Flow     &newFlow = sFlows[kNumFlows];
+
+    // One address of the CIDR per mapping: a new flow with the pool
+    // empty releases the expired mappings.
+    instance = InitTranslator("192.0.2.0/24");
+    InitFlows();
+    testAdvanceTime(*instance, 1);
+
+    for (uint16_t i = 0; i < kNumFlows; i++)
+    {
+        OpenFlow(*instance, sFlows[i]);
+
+        for (uint16_t j = 0; j < i; j++)
+        {
+            VerifyOrQuit(sFlows[j].mIp4 != sFlows[i].mIp4);
+        }
+    }
+
+    VerifyOrQuit(SendFromFlow(*instance, newFlow, newFlow.mIp4, newFlow.mTranslatedPortOrId) == Translator::kDrop);
+
+    // A reply refreshes the mapping of the even flows.
+    testAdvanceTime(*instance, kIdleTimeout / 2);
+
+    for (uint16_t i = 0; i < kNumFlows; i += 2)
+    {
+        VerifyOrQuit(ReplyToFlow(*instance, sFlows[i]) == Translator::kForward);
+    }
+
+    testAdvanceTime(*instance, kIdleTimeout / 2 + 1);
+    VerifyOrQuit(GetNumMappings(*instance) == kNumFlows);
+
+    VerifyOrQuit(SendFromFlow(*instance, newFlow, newFlow.mIp4, newFlow.mTranslatedPortOrId) == Translator::kForward);
+    VerifyOrQuit(GetNumMappings(*instance) == kNumFlows / 2 + 1);
+
+    for (uint16_t i = 0; i < kNumFlows; i++)
+    {
+        Translator::Result expected = (i % 2 == 0) ? Translator::kForward : Translator::kDrop;
+
+        if ((i % 2 == 1) && (sFlows[i].mTranslatedPortOrId == newFlow.mTranslatedPortOrId))
+        {
+            // The port of a released mapping was given to the new flow.
+            continue;
+        }
+
+        VerifyOrQuit(ReplyToFlow(*instance, sFlows[i]) == expected);
+    }
+
+    VerifyOrQuit(ReplyToFlow(*instance, newFlow) == Translator::kForward);
+
+    // The timer releases the remaining mappings once they expire.
+    testAdvanceTime(*instance, 2 * kIdleTimeout);
+    VerifyOrQuit(GetNumMappings(*instance) == 0);
+
+    testFreeInstance(instance);
+    printf("TestExpiry passed\n");
+}
+
+/* The former lookup of an outgoing flow: a scan of all mappings, here through the iterator */
+static bool ScanForFlow(Instance &aInstance, const Flow &aFlow)
+{
+    Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping              mapping;
+    bool                               found = false;
+
+    aInstance.Get<Translator>().InitAddressMappingIterator(iterator);
+
+    while (!found && (aInstance.Get<Translator>().GetNextAddressMapping(iterator, mapping) == kErrorNone))
+    {
+        found = (AsCoreType(&mapping.mIp6) == aFlow.mIp6) && (mapping.mSrcPortOrId == aFlow.mPortOrId);
+    }
+
+    return found;
+}
+
+static void Benchmark(uint16_t aNumMappings)
+{
+    static const uint32_t kIterations = 20000;
+
+    Instance *instance = InitTranslator("192.0.2.1/32");
+    uint64_t  start;
+    uint64_t  buildNs;
+    uint64_t  outgoingNs;
+    uint64_t  incomingNs;
+    uint64_t  scanNs;
+    uint32_t  sink = 0;
+
+    InitFlows();
+
+    for (uint16_t i = 0; i < aNumMappings; i++)
+    {
+        OpenFlow(*instance, sFlows[i]);
+    }
+
+    start = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Message *message = NewIp6Datagram(*instance, sFlows[NextRandom() % aNumMappings]);
+
+        sink += message->GetLength();
+        message->Free();
+    }
+
+    buildNs = NowNs() - start;
+    start   = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Ip4::Address ip4;
+        uint16_t     portOrId;
+
+        VerifyOrQuit(SendFromFlow(*instance, sFlows[NextRandom() % aNumMappings], ip4, portOrId) ==
+                     Translator::kForward);
+        sink += portOrId;
+    }
+
+    outgoingNs = NowNs() - start;
+    start      = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(ReplyToFlow(*instance, sFlows[NextRandom() % aNumMappings]) == Translator::kForward);
+    }
+
+    incomingNs = NowNs() - start;
+    start      = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        VerifyOrQuit(ScanForFlow(*instance, sFlows[NextRandom() % aNumMappings]));
+    }
+
+    scanNs = NowNs() - start;
+
+    VerifyOrQuit(sink != 0);
+    printf("%3u mappings: outgoing %.0f ns, incoming %.0f ns per datagram (building it %.0f ns), scan of the "
+           "mappings %.0f ns\n",
+           aNumMappings, static_cast<double>(outgoingNs) / kIterations, static_cast<double>(incomingNs) / kIterations,
+           static_cast<double>(buildNs) / kIterations, static_cast<double>(scanNs) / kIterations);
+
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestSharedAddress();
+    TestExpiry();
+
+    Benchmark(16);
+    Benchmark(64);
+    Benchmark(kNumFlows);
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,619 @@
+/*
+ *  Host platform of the OpenThread core tests.
+ *
+ *  Alarms, radio, entropy and reset are simulated; the crypto primitives are
+ *  taken from the host OpenSSL library. Settings are kept in RAM by the
+ *  settings_ram.c of the OpenThread example platforms, or by the flash driver
+ *  of the core in a simulated flash when the configuration enables it.
+ */
+
+#include "test_platform.h"
+
+#include <string.h>
+
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/platform/alarm-micro.h>
+#include <openthread/platform/alarm-milli.h>
+#include <openthread/platform/crypto.h>
+#include <openthread/platform/flash.h>
+#include <openthread/platform/misc.h>
+#include <openthread/platform/time.h>
+
+#include "test_util.h"
+
+static uint64_t sNowUs;
+
+static bool     sMilliArmed;
+static uint32_t sMilliFireTime;
+static bool     sMicroArmed;
+static uint32_t sMicroFireTime;
+
+static otRadioFrame             sTxFrame;
+static uint8_t                  sTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame             sRxFrame;
+static uint8_t                  sRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static bool                     sTxPending;
+static uint32_t                 sTxCount;
+static testRadioTransmitHandler sTxHandler;
+static void                    *sTxContext;
+static bool                     sPromiscuous;
+
+static uint32_t sRandomState = 0x12345678;
+
+/* Time */
+
+uint32_t testGetNow(void) { return static_cast<uint32_t>(sNowUs / OT_US_PER_MS); }
+
+extern "C" uint32_t otPlatAlarmMilliGetNow(void) { return testGetNow(); }
+
+extern "C" void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    sMilliArmed    = true;
+    sMilliFireTime = aT0 + aDt;
+}
+
+extern "C" void otPlatAlarmMilliStop(otInstance *aInstance) { sMilliArmed = false; }
+
+extern "C" uint32_t otPlatAlarmMicroGetNow(void) { return static_cast<uint32_t>(sNowUs); }
+
+extern "C" void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    sMicroArmed    = true;
+    sMicroFireTime = aT0 + aDt;
+}
+
+extern "C" void otPlatAlarmMicroStop(otInstance *aInstance) { sMicroArmed = false; }
+
+extern "C" uint64_t otPlatTimeGet(void) { return sNowUs; }
+
+extern "C" uint16_t otPlatTimeGetXtalAccuracy(void) { return 0; }
+
+extern "C" void otTaskletsSignalPending(otInstance *aInstance) {}
+
+extern "C" void otPlatReset(otInstance *aInstance) {}
+
+void testProcess(ot::Instance &aInstance)
+{
+    while (true)
+    {
+        if (otTaskletsArePending(&aInstance))
+        {
+            otTaskletsProcess(&aInstance);
+        }
+        else if (sTxPending)
+        {
+            sTxPending = false;
+            otPlatRadioTxDone(&aInstance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+void testAdvanceTime(ot::Instance &aInstance, uint32_t aDuration)
+{
+    uint64_t end = sNowUs + static_cast<uint64_t>(aDuration) * OT_US_PER_MS;
+
+    testProcess(aInstance);
+
+    while (true)
+    {
+        uint64_t next = end;
+
+        /* Fire times are 32 bit, compared relative to the current time */
+        if (sMilliArmed)
+        {
+            uint32_t delta = sMilliFireTime - testGetNow();
+
+            if (static_cast<int32_t>(delta) < 0)
+            {
+                delta = 0;
+            }
+
+            next = (sNowUs / OT_US_PER_MS + delta) * OT_US_PER_MS;
+            next = (next < sNowUs) ? sNowUs : next;
+        }
+
+        if (sMicroArmed)
+        {
+            uint32_t delta = sMicroFireTime - static_cast<uint32_t>(sNowUs);
+            uint64_t fire  = sNowUs + ((static_cast<int32_t>(delta) < 0) ? 0 : delta);
+
+            next = (fire < next) ? fire : next;
+        }
+
+        if (next > end)
+        {
+            next = end;
+        }
+
+        sNowUs = next;
+
+        if (sMicroArmed && (static_cast<int32_t>(static_cast<uint32_t>(sNowUs) - sMicroFireTime) >= 0))
+        {
+            sMicroArmed = false;
+            otPlatAlarmMicroFired(&aInstance);
+        }
+        else if (sMilliArmed && (static_cast<int32_t>(testGetNow() - sMilliFireTime) >= 0))
+        {
+            sMilliArmed = false;
+            otPlatAlarmMilliFired(&aInstance);
+        }
+        else if (sNowUs >= end)
+        {
+            break;
+        }
+
+        testProcess(aInstance);
+    }
+}
+
+/* Radio */
+
+void testSetRadioTransmitHandler(testRadioTransmitHandler aHandler, void *aContext)
+{
+    sTxHandler = aHandler;
+    sTxContext = aContext;
+}
+
+uint32_t testGetRadioTxCount(void) { return sTxCount; }
+
+void testReceiveFrame(ot::Instance &aInstance, const uint8_t *aPsdu, uint16_t aLength, uint8_t aChannel)
+{
+    VerifyOrQuit(aLength <= sizeof(sRxPsdu));
+
+    memcpy(sRxPsdu, aPsdu, aLength);
+    memset(&sRxFrame, 0, sizeof(sRxFrame));
+    sRxFrame.mPsdu               = sRxPsdu;
+    sRxFrame.mLength             = aLength;
+    sRxFrame.mChannel            = aChannel;
+    sRxFrame.mInfo.mRxInfo.mRssi = -20;
+    sRxFrame.mInfo.mRxInfo.mLqi  = 255;
+
+    otPlatRadioReceiveDone(&aInstance, &sRxFrame, OT_ERROR_NONE);
+    testProcess(aInstance);
+}
+
+extern "C" otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    sTxFrame.mPsdu = sTxPsdu;
+    return &sTxFrame;
+}
+
+extern "C" otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    sTxCount++;
+    sTxPending = true;
+    otPlatRadioTxStarted(aInstance, aFrame);
+
+    if (sTxHandler != nullptr)
+    {
+        sTxHandler(*aFrame, sTxContext);
+    }
+
+    return OT_ERROR_NONE;
+}
+
+extern "C" otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_TRANSMIT_RETRIES | OT_RADIO_CAPS_CSMA_BACKOFF;
+}
+
+extern "C" void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    static const uint8_t kEui64[] = {0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+    memcpy(aIeeeEui64, kEui64, sizeof(kEui64));
+}
+
+extern "C" otError otPlatRadioEnable(otInstance *aInstance) { return OT_ERROR_NONE; }
+extern "C" otError otPlatRadioDisable(otInstance *aInstance) { return OT_ERROR_NONE; }
+extern "C" otError otPlatRadioSleep(otInstance *aInstance) { return OT_ERROR_NONE; }
+extern "C" otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel) { return OT_ERROR_NONE; }
+extern "C" bool    otPlatRadioGetPromiscuous(otInstance *aInstance) { return sPromiscuous; }
+extern "C" void    otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable) { sPromiscuous = aEnable; }
+extern "C" int8_t  otPlatRadioGetRssi(otInstance *aInstance) { return -100; }
+extern "C" int8_t  otPlatRadioGetReceiveSensitivity(otInstance *aInstance) { return -100; }
+extern "C" void    otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId) {}
+extern "C" void    otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress) {}
+extern "C" void    otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress) {}
+extern "C" void    otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable) {}
+extern "C" void    otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance) {}
+extern "C" void    otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance) {}
+extern "C" void    otPlatRadioUpdateCslSampleTime(otInstance *aInstance, uint32_t aCslSampleTime) {}
+
+extern "C" otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+extern "C" otError otPlatRadioEnableCsl(otInstance         *aInstance,
+                                        uint32_t            aCslPeriod,
+                                        otShortAddress      aShortAddr,
+                                        const otExtAddress *aExtAddr)
+{
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatRadioConfigureEnhAckProbing(otInstance         *aInstance,
+                                                     otLinkMetrics       aLinkMetrics,
+                                                     otShortAddress      aShortAddress,
+                                                     const otExtAddress *aExtAddress)
+{
+    return OT_ERROR_NONE;
+}
+
+/* Crypto: the OpenSSL objects are referenced from the OpenThread context */
+
+static uint32_t sHmacCount;
+
+template <typename Type> static Type *&ContextObject(otCryptoContext *aContext)
+{
+    return *reinterpret_cast<Type **>(aContext->mContext);
+}
+
+static otError HmacSha256(const uint8_t *aKey,
+                          size_t         aKeyLength,
+                          const uint8_t *aData,
+                          size_t         aDataLength,
+                          uint8_t       *aHash)
+{
+    return (EVP_Q_mac(nullptr, "HMAC", nullptr, "SHA256", nullptr, aKey, aKeyLength, aData, aDataLength, aHash,
+                      OT_CRYPTO_SHA256_HASH_SIZE, nullptr) != nullptr)
+               ? OT_ERROR_NONE
+               : OT_ERROR_FAILED;
+}
+
+extern "C" void otPlatCryptoInit(void) {}
+
+extern "C" otError otPlatCryptoAesInit(otCryptoContext *aContext)
+{
+    ContextObject<EVP_CIPHER_CTX>(aContext) = EVP_CIPHER_CTX_new();
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoAesSetKey(otCryptoContext *aContext, const otCryptoKey *aKey)
+{
+    EVP_CIPHER_CTX *ctx = ContextObject<EVP_CIPHER_CTX>(aContext);
+
+    VerifyOrQuit(aKey->mKey != nullptr && aKey->mKeyLength == 16);
+    EVP_EncryptInit_ex(ctx, EVP_aes_128_ecb(), nullptr, aKey->mKey, nullptr);
+    EVP_CIPHER_CTX_set_padding(ctx, 0);
+
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoAesEncrypt(otCryptoContext *aContext, const uint8_t *aInput, uint8_t *aOutput)
+{
+    int length;
+
+    EVP_EncryptUpdate(ContextObject<EVP_CIPHER_CTX>(aContext), aOutput, &length, aInput, 16);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoAesFree(otCryptoContext *aContext)
+{
+    EVP_CIPHER_CTX_free(ContextObject<EVP_CIPHER_CTX>(aContext));
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoHmacSha256Init(otCryptoContext *aContext)
+{
+    EVP_MAC *mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
+
+    ContextObject<EVP_MAC_CTX>(aContext) = EVP_MAC_CTX_new(mac);
+    EVP_MAC_free(mac);
+
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoHmacSha256Deinit(otCryptoContext *aContext)
+{
+    EVP_MAC_CTX_free(ContextObject<EVP_MAC_CTX>(aContext));
+    return OT_ERROR_NONE;
+}
+
+uint32_t testGetHmacCount(void) { return sHmacCount; }
+
+extern "C" otError otPlatCryptoHmacSha256Start(otCryptoContext *aContext, const otCryptoKey *aKey)
+{
+    char       digest[] = "SHA256";
+    OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0), OSSL_PARAM_END};
+
+    VerifyOrQuit(aKey->mKey != nullptr);
+    sHmacCount++;
+
+    return EVP_MAC_init(ContextObject<EVP_MAC_CTX>(aContext), aKey->mKey, aKey->mKeyLength, params) ? OT_ERROR_NONE
+                                                                                                     : OT_ERROR_FAILED;
+}
+
+extern "C" otError otPlatCryptoHmacSha256Update(otCryptoContext *aContext, const void *aBuf, uint16_t aBufLength)
+{
+    EVP_MAC_update(ContextObject<EVP_MAC_CTX>(aContext), static_cast<const uint8_t *>(aBuf), aBufLength);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoHmacSha256Finish(otCryptoContext *aContext, uint8_t *aBuf, size_t aBufLength)
+{
+    size_t length;
+
+    EVP_MAC_final(ContextObject<EVP_MAC_CTX>(aContext), aBuf, &length, aBufLength);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoSha256Init(otCryptoContext *aContext)
+{
+    ContextObject<EVP_MD_CTX>(aContext) = EVP_MD_CTX_new();
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoSha256Deinit(otCryptoContext *aContext)
+{
+    EVP_MD_CTX_free(ContextObject<EVP_MD_CTX>(aContext));
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoSha256Start(otCryptoContext *aContext)
+{
+    EVP_DigestInit_ex(ContextObject<EVP_MD_CTX>(aContext), EVP_sha256(), nullptr);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoSha256Update(otCryptoContext *aContext, const void *aBuf, uint16_t aBufLength)
+{
+    EVP_DigestUpdate(ContextObject<EVP_MD_CTX>(aContext), aBuf, aBufLength);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoSha256Finish(otCryptoContext *aContext, uint8_t *aHash, uint16_t aHashSize)
+{
+    EVP_DigestFinal_ex(ContextObject<EVP_MD_CTX>(aContext), aHash, nullptr);
+    return OT_ERROR_NONE;
+}
+
+/* HKDF (RFC 5869): the context holds the pseudorandom key */
+
+extern "C" otError otPlatCryptoHkdfInit(otCryptoContext *aContext)
+{
+    memset(aContext->mContext, 0, aContext->mContextSize);
+    return OT_ERROR_NONE;
+}
+
+extern "C" otError otPlatCryptoHkdfDeinit(otCryptoContext *aContext) { return OT_ERROR_NONE; }
+
+extern "C" otError otPlatCryptoHkdfExtract(otCryptoContext   *aContext,
+                                           const uint8_t     *aSalt,
+                                           uint16_t           aSaltLength,
+                                           const otCryptoKey *aInputKey)
+{
+    VerifyOrQuit(aInputKey->mKey != nullptr);
+
+    return HmacSha256(aSalt, aSaltLength, aInputKey->mKey, aInputKey->mKeyLength,
+                      static_cast<uint8_t *>(aContext->mContext));
+}
+
+extern "C" otError otPlatCryptoHkdfExpand(otCryptoContext *aContext,
+                                          const uint8_t   *aInfo,
+                                          uint16_t         aInfoLength,
+                                          uint8_t         *aOutputKey,
+                                          uint16_t         aOutputKeyLength)
+{
+    const uint8_t *prk = static_cast<const uint8_t *>(aContext->mContext);
+    uint8_t        block[OT_CRYPTO_SHA256_HASH_SIZE];
+    uint8_t        input[OT_CRYPTO_SHA256_HASH_SIZE + 256 + 1];
+    size_t         previous = 0;
+    uint8_t        counter  = 0;
+
+    VerifyOrQuit(aInfoLength <= 256);
+
+    while (aOutputKeyLength > 0)
+    {
+        size_t length = 0;
+        size_t count;
+
+        memcpy(input, block, previous);
+        length += previous;
+        memcpy(input + length, aInfo, aInfoLength);
+        length += aInfoLength;
+        input[length++] = ++counter;
+
+        SuccessOrQuit(HmacSha256(prk, OT_CRYPTO_SHA256_HASH_SIZE, input, length, block));
+        previous = sizeof(block);
+
+        count = (aOutputKeyLength < sizeof(block)) ? aOutputKeyLength : sizeof(block);
+        memcpy(aOutputKey, block, count);
+        aOutputKey += count;
+        aOutputKeyLength -= count;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+/* PBKDF2 with AES-CMAC-PRF-128 (RFC 4615) as used for the PSKc */
+
+static void AesCmac(const uint8_t *aKey, const uint8_t *aData, size_t aDataLength, uint8_t *aMac)
+{
+    char       cipher[] = "AES-128-CBC";
+    OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_CIPHER, cipher, 0), OSSL_PARAM_END};
+
+    VerifyOrQuit(EVP_Q_mac(nullptr, "CMAC", nullptr, nullptr, params, aKey, 16, aData, aDataLength, aMac, 16,
+                           nullptr) != nullptr);
+}
+
+extern "C" otError otPlatCryptoPbkdf2GenerateKey(const uint8_t *aPassword,
+                                                 uint16_t       aPasswordLen,
+                                                 const uint8_t *aSalt,
+                                                 uint16_t       aSaltLen,
+                                                 uint32_t       aIterationCounter,
+                                                 uint16_t       aKeyLen,
+                                                 uint8_t       *aKey)
+{
+    static const uint8_t kZeroKey[16] = {0};
+    uint8_t              prfKey[16];
+    uint8_t              input[256 + 4];
+    uint8_t              u[16];
+    uint8_t              t[16];
+    uint32_t             block = 0;
+
+    VerifyOrQuit(aSaltLen <= 256);
+
+    if (aPasswordLen == sizeof(prfKey))
+    {
+        memcpy(prfKey, aPassword, sizeof(prfKey));
+    }
+    else
+    {
+        AesCmac(kZeroKey, aPassword, aPasswordLen, prfKey);
+    }
+
+    while (aKeyLen > 0)
+    {
+        uint16_t count = (aKeyLen < sizeof(t)) ? aKeyLen : sizeof(t);
+
+        block++;
+        memcpy(input, aSalt, aSaltLen);
+        input[aSaltLen + 0] = static_cast<uint8_t>(block >> 24);
+        input[aSaltLen + 1] = static_cast<uint8_t>(block >> 16);
+        input[aSaltLen + 2] = static_cast<uint8_t>(block >> 8);
+        input[aSaltLen + 3] = static_cast<uint8_t>(block);
+
+        AesCmac(prfKey, input, aSaltLen + 4u, u);
+        memcpy(t, u, sizeof(t));
+
+        for (uint32_t i = 1; i < aIterationCounter; i++)
+        {
+            AesCmac(prfKey, u, sizeof(u), u);
+
+            for (size_t j = 0; j < sizeof(t); j++)
+            {
+                t[j] ^= u[j];
+            }
+        }
+
+        memcpy(aKey, t, count);
+        aKey += count;
+        aKeyLen -= count;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+/* Entropy: a fixed sequence keeps the runs reproducible */
+
+extern "C" void otPlatCryptoRandomInit(void) {}
+
+extern "C" void otPlatCryptoRandomDeinit(void) {}
+
+extern "C" otError otPlatCryptoRandomGet(uint8_t *aBuffer, uint16_t aSize)
+{
+    for (uint16_t i = 0; i < aSize; i++)
+    {
+        sRandomState ^= sRandomState << 13;
+        sRandomState ^= sRandomState >> 17;
+        sRandomState ^= sRandomState << 5;
+        aBuffer[i] = static_cast<uint8_t>(sRandomState);
+    }
+
+    return OT_ERROR_NONE;
+}
+
+extern "C" void mbedtls_debug_set_threshold(int aThreshold) {}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+
+/* Flash: two swap areas in RAM, a write can only clear bits like on the target */
+
+static const uint32_t kFlashSwapSize = 4096;
+
+static uint8_t  sFlash[2][kFlashSwapSize];
+static uint32_t sFlashReadCount;
+
+uint32_t testGetFlashReadCount(void) { return sFlashReadCount; }
+
+extern "C" void otPlatFlashInit(otInstance *aInstance) {}
+
+extern "C" uint32_t otPlatFlashGetSwapSize(otInstance *aInstance) { return kFlashSwapSize; }
+
+extern "C" void otPlatFlashErase(otInstance *aInstance, uint8_t aSwapIndex)
+{
+    VerifyOrQuit(aSwapIndex < 2);
+    memset(sFlash[aSwapIndex], 0xff, kFlashSwapSize);
+}
+
+extern "C" void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize)
+{
+    VerifyOrQuit((aSwapIndex < 2) && (aOffset + aSize <= kFlashSwapSize));
+    memcpy(aData, &sFlash[aSwapIndex][aOffset], aSize);
+    sFlashReadCount++;
+}
+
+extern "C" void otPlatFlashWrite(otInstance *aInstance,
+                                 uint8_t     aSwapIndex,
+                                 uint32_t    aOffset,
+                                 const void *aData,
+                                 uint32_t    aSize)
+{
+    VerifyOrQuit((aSwapIndex < 2) && (aOffset + aSize <= kFlashSwapSize));
+
+    for (uint32_t i = 0; i < aSize; i++)
+    {
+        sFlash[aSwapIndex][aOffset + i] &= static_cast<const uint8_t *>(aData)[i];
+    }
+}
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+
+/* Instance */
+
+ot::Instance *testInitInstance(void)
+{
+    otInstance *instance = otInstanceInitSingle();
+
+    VerifyOrQuit(instance != nullptr);
+    return static_cast<ot::Instance *>(instance);
+}
+
+void testFreeInstance(ot::Instance *aInstance)
+{
+    testProcess(*aInstance);
+    otInstanceFinalize(aInstance);
+    sMilliArmed = false;
+    sMicroArmed = false;
+    sTxPending  = false;
+}
+
+void testStartLeader(ot::Instance &aInstance)
+{
+    SuccessOrQuit(otIp6SetEnabled(&aInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(&aInstance, true));
+    SuccessOrQuit(otThreadBecomeLeader(&aInstance));
+    testAdvanceTime(aInstance, 1000);
+    VerifyOrQuit(otThreadGetDeviceRole(&aInstance) == OT_DEVICE_ROLE_LEADER);
+}
@@ -0,0 +1,48 @@
+/*
+ *  Host platform of the OpenThread core tests.
+ *
+ *  Time only moves when a test calls testAdvanceTime(). The radio hands each
+ *  transmitted frame to the handler set by the test, then reports the transmit
+ *  as done (acknowledged) from the next testProcess().
+ */
+
+#ifndef TEST_PLATFORM_H_
+#define TEST_PLATFORM_H_
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/radio.h>
+
+#include "instance/instance.hpp"
+
+typedef void (*testRadioTransmitHandler)(const otRadioFrame &aFrame, void *aContext);
+
+ot::Instance *testInitInstance(void);
+void          testFreeInstance(ot::Instance *aInstance);
+
+/* Runs the pending tasklets and transmit completions until idle */
+void testProcess(ot::Instance &aInstance);
+
+/* Moves the clock forward, firing the timers which expire on the way */
+void     testAdvanceTime(ot::Instance &aInstance, uint32_t aDuration);
+uint32_t testGetNow(void);
+
+void     testSetRadioTransmitHandler(testRadioTransmitHandler aHandler, void *aContext);
+uint32_t testGetRadioTxCount(void);
+
+/* Delivers a PSDU (FCS included in aLength) to the MAC as a received frame */
+void testReceiveFrame(ot::Instance &aInstance, const uint8_t *aPsdu, uint16_t aLength, uint8_t aChannel);
+
+/* Number of HMAC-SHA256 computations started through the platform crypto */
+uint32_t testGetHmacCount(void);
+
+/* Brings the instance up as the leader of a fresh network */
+void testStartLeader(ot::Instance &aInstance);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+/* Number of otPlatFlashRead() calls of the flash driver */
+uint32_t testGetFlashReadCount(void);
+#endif
+
+#endif // TEST_PLATFORM_H_
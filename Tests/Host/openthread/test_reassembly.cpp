@@ -0,0 +1,728 @@
+/*
+ *  Test of the 6LoWPAN reassembly of MeshForwarder: interleaved fragment
+ *  streams from several neighbors, sharing datagram tags, shall all be
+ *  reassembled. Beyond the limits on datagrams, datagrams per source and
+ *  buffers the oldest datagrams are evicted, a repeated first fragment does
+ *  not restart a datagram, incomplete datagrams time out, and random
+ *  fragments shall give all buffers back. The evictions and timeouts are
+ *  checked against the reassembly counters. Also benchmarks a fragment with
+ *  one and with the maximum number of datagrams under reassembly.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include <openthread/udp.h>
+
+#include "common/frame_builder.hpp"
+#include "common/message.hpp"
+#include "mac/mac.hpp"
+#include "net/checksum.hpp"
+#include "net/ip6.hpp"
+#include "net/ip6_filter.hpp"
+#include "net/udp6.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint16_t kUdpPort          = 1234;
+static const uint8_t  kMacHeaderSize    = 21; // Data frame, PAN ID compression, extended addresses
+static const uint8_t  kMaxPayload       = OT_RADIO_FRAME_MAX_SIZE - kMacHeaderSize - sizeof(uint16_t);
+static const uint16_t kMaxPayloadLength = Ip6::kMaxDatagramLength - sizeof(Ip6::Header) - sizeof(Ip6::Udp::Header);
+static const uint8_t  kMaxFrames        = 20;
+static const uint8_t  kMaxSources       = 16;
+static const uint16_t kMaxSequences     = 256;
+static const uint8_t  kMaxDatagrams     = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS;
+static const uint8_t  kMaxPerSource     = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_DATAGRAMS_PER_SOURCE;
+static const uint16_t kMaxBuffers       = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_BUFFERS;
+static const uint32_t kReassemblyTimeMs = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT * 1000;
+static const uint32_t kTimeStep         = 10; // Between first fragments, which sets the age of the datagrams
+
+struct Frame
+{
+    uint8_t  mPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint16_t mLength;
+};
+
+/* The fragments of a datagram, sent in order */
+struct Stream
+{
+    Frame   mFrames[kMaxFrames];
+    uint8_t mNumFrames;
+    uint8_t mNextFrame;
+};
+
+static uint8_t  sNumReceived[kMaxSources][kMaxSequences];
+static uint32_t sTotalReceived;
+static bool     sFuzzing;
+static uint8_t  sMacSequence;
+static uint32_t sRandomState = 0x31415926;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/* The payload of a datagram starts with its source and sequence, the rest follows from them */
+static uint8_t PayloadByte(uint8_t aSource, uint16_t aSequence, uint16_t aIndex)
+{
+    return static_cast<uint8_t>(aSource * 31 + aSequence * 7 + aIndex * 13);
+}
+
+static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    const Message &message = AsCoreType(aMessage);
+    uint16_t       offset  = message.GetOffset();
+    uint16_t       length  = message.GetLength() - offset;
+    uint8_t        header[3];
+    uint16_t       sequence;
+
+    sTotalReceived++;
+    VerifyOrExit(!sFuzzing);
+
+    VerifyOrQuit(length >= sizeof(header));
+    SuccessOrQuit(message.Read(offset, header));
+    sequence = BigEndian::ReadUint16(&header[1]);
+    VerifyOrQuit(header[0] < kMaxSources && sequence < kMaxSequences);
+
+    for (uint16_t i = sizeof(header); i < length; i++)
+    {
+        uint8_t byte;
+
+        SuccessOrQuit(message.Read(offset + i, byte));
+        VerifyOrQuit(byte == PayloadByte(header[0], sequence, i));
+    }
+
+    sNumReceived[header[0]][sequence]++;
+
+exit:
+    return;
+}
+
+static void GetMacAddresses(Instance &aInstance, uint8_t aSource, Mac::Addresses &aMacAddrs)
+{
+    Mac::ExtAddress sender;
+
+    memset(sender.m8, 0x5a, sizeof(sender.m8));
+    sender.m8[sizeof(sender.m8) - 1] = aSource;
+    aMacAddrs.mSource.SetExtended(sender);
+    aMacAddrs.mDestination.SetExtended(aInstance.Get<Mac::Mac>().GetExtAddress());
+}
+
+/* Unsecured data frame from `aMacAddrs`, `aPayload` is the 6LoWPAN payload */
+static void BuildFrame(const Mac::Addresses &aMacAddrs,
+                       Mac::PanId            aPanId,
+                       const uint8_t        *aPayload,
+                       uint16_t              aLength,
+                       Frame                &aFrame)
+{
+    uint8_t *cur = aFrame.mPsdu;
+
+    VerifyOrQuit(aLength <= kMaxPayload);
+
+    // Frame Control: data, PAN ID compression, 2006, extended addresses
+    *cur++ = 0x41;
+    *cur++ = 0xdc;
+    *cur++ = sMacSequence++;
+    LittleEndian::WriteUint16(aPanId, cur);
+    cur += sizeof(uint16_t);
+
+    for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i++)
+    {
+        *cur++ = aMacAddrs.mDestination.GetExtended().m8[sizeof(Mac::ExtAddress) - 1 - i];
+    }
+
+    for (uint8_t i = 0; i < sizeof(Mac::ExtAddress); i++)
+    {
+        *cur++ = aMacAddrs.mSource.GetExtended().m8[sizeof(Mac::ExtAddress) - 1 - i];
+    }
+
+    memcpy(cur, aPayload, aLength);
+    cur += aLength;
+
+    // FCS, not checked by the MAC
+    *cur++ = 0;
+    *cur++ = 0;
+
+    aFrame.mLength = static_cast<uint16_t>(cur - aFrame.mPsdu);
+}
+
+/*
+ * Builds the fragments of a link-local UDP datagram from `aSource` with
+ * `aPayloadLength` bytes of payload and `aTag` as datagram tag.
+ */
+static void BuildStream(Instance &aInstance,
+                        uint8_t   aSource,
+                        uint16_t  aSequence,
+                        uint16_t  aTag,
+                        uint16_t  aPayloadLength,
+                        Stream   &aStream)
+{
+    Message                          *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+    Mac::Addresses                    macAddrs;
+    Ip6::Header                       ip6Header;
+    Ip6::Udp::Header                  udpHeader;
+    FrameBuilder                      frameBuilder;
+    Lowpan::FragmentHeader::FirstFrag firstFrag;
+    uint8_t                           payload[kMaxPayload];
+    uint16_t                          offset;
+    uint16_t                          length;
+
+    VerifyOrQuit(message != nullptr);
+    VerifyOrQuit(aPayloadLength >= 3);
+    GetMacAddresses(aInstance, aSource, macAddrs);
+
+    ip6Header.InitVersionTrafficClassFlow();
+    ip6Header.SetPayloadLength(sizeof(udpHeader) + aPayloadLength);
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(255);
+    ip6Header.GetSource().SetToLinkLocalAddress(macAddrs.mSource.GetExtended());
+    ip6Header.GetDestination().SetToLinkLocalAddress(macAddrs.mDestination.GetExtended());
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(kUdpPort);
+    udpHeader.SetDestinationPort(kUdpPort);
+    udpHeader.SetLength(sizeof(udpHeader) + aPayloadLength);
+
+    SuccessOrQuit(message->Append(ip6Header));
+    SuccessOrQuit(message->Append(udpHeader));
+    SuccessOrQuit(message->Append(aSource));
+    SuccessOrQuit(message->Append(BigEndian::HostSwap16(aSequence)));
+
+    for (uint16_t i = 3; i < aPayloadLength; i++)
+    {
+        SuccessOrQuit(message->Append(PayloadByte(aSource, aSequence, i)));
+    }
+
+    message->SetOffset(sizeof(ip6Header));
+    Checksum::UpdateMessageChecksum(*message, ip6Header.GetSource(), ip6Header.GetDestination(), Ip6::kProtoUdp);
+    message->SetOffset(0);
+
+    // The payload of a fragment but the last ends on an 8 byte boundary
+    // of the uncompressed datagram.
+    frameBuilder.Init(payload, sizeof(payload));
+    firstFrag.Init(message->GetLength(), aTag);
+    SuccessOrQuit(frameBuilder.Append(firstFrag));
+    SuccessOrQuit(aInstance.Get<Lowpan::Lowpan>().Compress(*message, macAddrs, frameBuilder));
+
+    offset = message->GetOffset();
+    length = ((offset + kMaxPayload - frameBuilder.GetLength()) & ~7) - offset;
+    length = (offset + length < message->GetLength()) ? length : message->GetLength() - offset;
+    SuccessOrQuit(frameBuilder.AppendBytesFromMessage(*message, offset, length));
+
+    aStream.mNumFrames = 0;
+    aStream.mNextFrame = 0;
+    BuildFrame(macAddrs, aInstance.Get<Mac::Mac>().GetPanId(), payload, frameBuilder.GetLength(),
+               aStream.mFrames[aStream.mNumFrames++]);
+
+    for (offset += length; offset < message->GetLength(); offset += length)
+    {
+        Lowpan::FragmentHeader::NextFrag nextFrag;
+
+        length = (kMaxPayload - sizeof(nextFrag)) & ~7;
+        length = (offset + length < message->GetLength()) ? length : message->GetLength() - offset;
+
+        frameBuilder.Init(payload, sizeof(payload));
+        nextFrag.Init(message->GetLength(), aTag, offset);
+        SuccessOrQuit(frameBuilder.Append(nextFrag));
+        SuccessOrQuit(frameBuilder.AppendBytesFromMessage(*message, offset, length));
+
+        VerifyOrQuit(aStream.mNumFrames < kMaxFrames);
+        BuildFrame(macAddrs, aInstance.Get<Mac::Mac>().GetPanId(), payload, frameBuilder.GetLength(),
+                   aStream.mFrames[aStream.mNumFrames++]);
+    }
+
+    message->Free();
+}
+
+static void SendFrame(Instance &aInstance, const Frame &aFrame)
+{
+    testReceiveFrame(aInstance, aFrame.mPsdu, aFrame.mLength, 11);
+}
+
+static void SendNextFrame(Instance &aInstance, Stream &aStream)
+{
+    SendFrame(aInstance, aStream.mFrames[aStream.mNextFrame++]);
+}
+
+static void SendRemainingFrames(Instance &aInstance, Stream &aStream)
+{
+    while (aStream.mNextFrame < aStream.mNumFrames)
+    {
+        SendNextFrame(aInstance, aStream);
+    }
+}
+
+/* Number of message buffers of a reassembled datagram with `aPayloadLength` bytes of UDP payload */
+static uint16_t GetDatagramBufferCount(Instance &aInstance, uint16_t aPayloadLength)
+{
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+    uint16_t count;
+
+    VerifyOrQuit(message != nullptr);
+    SuccessOrQuit(message->SetLength(sizeof(Ip6::Header) + sizeof(Ip6::Udp::Header) + aPayloadLength));
+    count = message->GetBufferCount();
+    message->Free();
+
+    return count;
+}
+
+static otUdpSocket sSocket;
+
+static Instance *InitReceiver(void)
+{
+    Instance  *instance = testInitInstance();
+    otSockAddr sockName;
+
+    testStartLeader(*instance);
+    SuccessOrQuit(instance->Get<Ip6::Filter>().AddUnsecurePort(kUdpPort));
+
+    memset(&sockName, 0, sizeof(sockName));
+    sockName.mPort = kUdpPort;
+    SuccessOrQuit(otUdpOpen(instance, &sSocket, HandleUdpReceive, nullptr));
+    SuccessOrQuit(otUdpBind(instance, &sSocket, &sockName, OT_NETIF_THREAD_INTERNAL));
+
+    testProcess(*instance);
+    memset(sNumReceived, 0, sizeof(sNumReceived));
+    sTotalReceived = 0;
+    instance->Get<MeshForwarder>().ResetReassemblyCounters();
+
+    return instance;
+}
+
+static void FreeReceiver(Instance *aInstance)
+{
+    SuccessOrQuit(otUdpClose(aInstance, &sSocket));
+    testFreeInstance(aInstance);
+}
+
+static const MeshForwarder::ReassemblyCounters &GetCounters(Instance &aInstance)
+{
+    return aInstance.Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+static void TestInterleavedStreams(void)
+{
+    static const uint8_t  kNumSources   = kMaxDatagrams / 2;
+    static const uint8_t  kNumSlots     = kNumSources * 2;
+    static const uint16_t kNumDatagrams = 60; // Per slot
+
+    Instance *instance         = InitReceiver();
+    uint16_t  freeBuffers      = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *streams          = new Stream[kNumSlots];
+    uint16_t  sequences[kNumSlots];
+    uint16_t  maxPayloadLength = 100;
+    uint8_t   numActive        = kNumSlots;
+
+    // Two datagrams per source at a time, of a size which lets all the
+    // slots fit in the reassembly buffers.
+    while ((maxPayloadLength + 8 <= kMaxPayloadLength) &&
+           (GetDatagramBufferCount(*instance, maxPayloadLength + 8) <= kMaxBuffers / kNumSlots))
+    {
+        maxPayloadLength += 8;
+    }
+
+    VerifyOrQuit(kNumSources * 2 <= kMaxDatagrams && 2 <= kMaxPerSource);
+
+    // A slot sends the sequences of its source with the same parity.
+    // Sequences, and so tags, are shared among sources.
+    for (uint8_t slot = 0; slot < kNumSlots; slot++)
+    {
+        sequences[slot] = slot / kNumSources;
+        BuildStream(*instance, slot % kNumSources, sequences[slot], sequences[slot],
+                    100 + NextRandom() % (maxPayloadLength - 100 + 1), streams[slot]);
+    }
+
+    while (numActive > 0)
+    {
+        uint8_t slot = NextRandom() % kNumSlots;
+
+        if (streams[slot].mNextFrame == streams[slot].mNumFrames)
+        {
+            continue;
+        }
+
+        SendNextFrame(*instance, streams[slot]);
+
+        if (streams[slot].mNextFrame < streams[slot].mNumFrames)
+        {
+            continue;
+        }
+
+        VerifyOrQuit(sNumReceived[slot % kNumSources][sequences[slot]] == 1);
+        sequences[slot] += 2;
+
+        if (sequences[slot] < 2 * kNumDatagrams)
+        {
+            BuildStream(*instance, slot % kNumSources, sequences[slot], sequences[slot],
+                        100 + NextRandom() % (maxPayloadLength - 100 + 1), streams[slot]);
+        }
+        else
+        {
+            numActive--;
+        }
+    }
+
+    VerifyOrQuit(sTotalReceived == kNumSlots * kNumDatagrams);
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == 0);
+    VerifyOrQuit(GetCounters(*instance).mNumTimeouts == 0);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete[] streams;
+    FreeReceiver(instance);
+    printf("TestInterleavedStreams passed\n");
+}
+
+static void TestDatagramLimit(void)
+{
+    static const uint8_t kNumSources = kMaxDatagrams + 4;
+
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *streams     = new Stream[kNumSources];
+
+    // One small datagram per source: the first fragments of the last
+    // sources evict the oldest datagrams.
+    for (uint8_t source = 0; source < kNumSources; source++)
+    {
+        BuildStream(*instance, source, 0, 7, 150, streams[source]);
+        SendNextFrame(*instance, streams[source]);
+        testAdvanceTime(*instance, kTimeStep);
+    }
+
+    for (uint8_t source = 0; source < kNumSources; source++)
+    {
+        SendRemainingFrames(*instance, streams[source]);
+        VerifyOrQuit(sNumReceived[source][0] == ((source < kNumSources - kMaxDatagrams) ? 0 : 1));
+    }
+
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == kNumSources - kMaxDatagrams);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete[] streams;
+    FreeReceiver(instance);
+    printf("TestDatagramLimit passed\n");
+}
+
+static void TestPerSourceLimit(void)
+{
+    static const uint8_t kNumDatagrams = kMaxPerSource + 2;
+
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *streams     = new Stream[kNumDatagrams + 1];
+
+    // A neighbor starting more datagrams than it may have in progress
+    // evicts its own oldest ones, not the datagram of another neighbor.
+    BuildStream(*instance, 1, 0, 0, 150, streams[kNumDatagrams]);
+    SendNextFrame(*instance, streams[kNumDatagrams]);
+    testAdvanceTime(*instance, kTimeStep);
+
+    for (uint8_t sequence = 0; sequence < kNumDatagrams; sequence++)
+    {
+        BuildStream(*instance, 0, sequence, sequence, 150, streams[sequence]);
+        SendNextFrame(*instance, streams[sequence]);
+        testAdvanceTime(*instance, kTimeStep);
+    }
+
+    for (uint8_t sequence = 0; sequence <= kNumDatagrams; sequence++)
+    {
+        SendRemainingFrames(*instance, streams[sequence]);
+    }
+
+    for (uint8_t sequence = 0; sequence < kNumDatagrams; sequence++)
+    {
+        VerifyOrQuit(sNumReceived[0][sequence] == ((sequence < kNumDatagrams - kMaxPerSource) ? 0 : 1));
+    }
+
+    VerifyOrQuit(sNumReceived[1][0] == 1);
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == kNumDatagrams - kMaxPerSource);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete[] streams;
+    FreeReceiver(instance);
+    printf("TestPerSourceLimit passed\n");
+}
+
+static void TestBufferLimit(void)
+{
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    uint16_t  perDatagram = GetDatagramBufferCount(*instance, kMaxPayloadLength);
+    uint8_t   numKept     = static_cast<uint8_t>(kMaxBuffers / perDatagram);
+    Stream   *streams     = new Stream[kMaxDatagrams];
+
+    // Datagrams of the largest size from all sources: the buffers of the
+    // datagrams under reassembly stay within the limit, which is reached
+    // before the limit on datagrams.
+    VerifyOrQuit(numKept < kMaxDatagrams);
+
+    for (uint8_t source = 0; source < kMaxDatagrams; source++)
+    {
+        BuildStream(*instance, source, 0, 0, kMaxPayloadLength, streams[source]);
+        SendNextFrame(*instance, streams[source]);
+        testAdvanceTime(*instance, kTimeStep);
+        VerifyOrQuit(freeBuffers - instance->Get<MessagePool>().GetFreeBufferCount() <= kMaxBuffers);
+    }
+
+    for (uint8_t source = 0; source < kMaxDatagrams; source++)
+    {
+        SendRemainingFrames(*instance, streams[source]);
+        VerifyOrQuit(sNumReceived[source][0] == ((source < kMaxDatagrams - numKept) ? 0 : 1));
+    }
+
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == static_cast<uint32_t>(kMaxDatagrams - numKept));
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete[] streams;
+    FreeReceiver(instance);
+    printf("TestBufferLimit passed\n");
+}
+
+static void TestRepeatedFirstFragment(void)
+{
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *stream      = new Stream;
+
+    // A retransmitted first fragment, after some next fragments, does
+    // not restart the datagram in progress.
+    BuildStream(*instance, 0, 0, 0x1234, 600, *stream);
+    SendNextFrame(*instance, *stream);
+    SendNextFrame(*instance, *stream);
+    SendFrame(*instance, stream->mFrames[0]);
+    SendRemainingFrames(*instance, *stream);
+
+    VerifyOrQuit(sNumReceived[0][0] == 1);
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == 0);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete stream;
+    FreeReceiver(instance);
+    printf("TestRepeatedFirstFragment passed\n");
+}
+
+static void TestTimeout(void)
+{
+    static const uint8_t kNumSources = 3;
+
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *streams     = new Stream[kNumSources];
+
+    for (uint8_t source = 0; source < kNumSources; source++)
+    {
+        BuildStream(*instance, source, 0, 0, 400, streams[source]);
+        SendNextFrame(*instance, streams[source]);
+    }
+
+    // A next fragment refreshes the datagram of the last source. The
+    // timeouts are checked once a second.
+    testAdvanceTime(*instance, kReassemblyTimeMs - 500);
+    SendNextFrame(*instance, streams[kNumSources - 1]);
+    testAdvanceTime(*instance, 1500);
+
+    VerifyOrQuit(GetCounters(*instance).mNumTimeouts == kNumSources - 1);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() != freeBuffers);
+
+    testAdvanceTime(*instance, kReassemblyTimeMs);
+    VerifyOrQuit(GetCounters(*instance).mNumTimeouts == kNumSources);
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == 0);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    // The late fragments are dropped.
+    for (uint8_t source = 0; source < kNumSources; source++)
+    {
+        SendRemainingFrames(*instance, streams[source]);
+    }
+
+    VerifyOrQuit(sTotalReceived == 0);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    delete[] streams;
+    FreeReceiver(instance);
+    printf("TestTimeout passed\n");
+}
+
+/*
+ * Random fragments from a few sources: first fragments of real datagrams
+ * announcing random sizes and tags, next fragments with random headers and
+ * content, and truncated frames.
+ */
+static void TestRandomFragments(void)
+{
+    static const uint32_t kNumFrames  = 20000;
+    static const uint8_t  kNumSources = 3;
+
+    Instance *instance    = InitReceiver();
+    uint16_t  freeBuffers = instance->Get<MessagePool>().GetFreeBufferCount();
+    Stream   *stream      = new Stream;
+
+    sFuzzing = true;
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        uint8_t        source = NextRandom() % kNumSources;
+        uint16_t       size   = 50 + NextRandom() % 1300;
+        uint16_t       tag    = NextRandom() % 4;
+        Mac::Addresses macAddrs;
+        Frame          frame;
+        uint8_t        payload[kMaxPayload];
+        uint8_t        length;
+
+        GetMacAddresses(*instance, source, macAddrs);
+
+        switch (NextRandom() % 3)
+        {
+        case 0:
+            BuildStream(*instance, source, 0, tag, 3 + NextRandom() % (kMaxPayloadLength - 2), *stream);
+            memcpy(payload, &stream->mFrames[0].mPsdu[kMacHeaderSize],
+                   stream->mFrames[0].mLength - kMacHeaderSize - sizeof(uint16_t));
+            length = static_cast<uint8_t>(stream->mFrames[0].mLength - kMacHeaderSize - sizeof(uint16_t));
+            reinterpret_cast<Lowpan::FragmentHeader::FirstFrag *>(payload)->Init(size, tag);
+            break;
+
+        case 1:
+        {
+            Lowpan::FragmentHeader::NextFrag nextFrag;
+
+            nextFrag.Init(size, tag, (NextRandom() % (size + 16)) & ~7);
+            memcpy(payload, &nextFrag, sizeof(nextFrag));
+            length = sizeof(nextFrag) + NextRandom() % (kMaxPayload - sizeof(nextFrag) + 1);
+
+            for (uint8_t j = sizeof(nextFrag); j < length; j++)
+            {
+                payload[j] = static_cast<uint8_t>(NextRandom());
+            }
+
+            break;
+        }
+
+        default:
+            length = NextRandom() % 8;
+
+            for (uint8_t j = 0; j < length; j++)
+            {
+                payload[j] = static_cast<uint8_t>(NextRandom());
+            }
+
+            payload[0] = (NextRandom() % 2) ? 0xc0 : 0xe0;
+            break;
+        }
+
+        BuildFrame(macAddrs, instance->Get<Mac::Mac>().GetPanId(), payload, length, frame);
+        SendFrame(*instance, frame);
+
+        if (i % 1000 == 0)
+        {
+            testAdvanceTime(*instance, 1000);
+        }
+    }
+
+    testAdvanceTime(*instance, kReassemblyTimeMs + 1000);
+    VerifyOrQuit(instance->Get<MessagePool>().GetFreeBufferCount() == freeBuffers);
+
+    sFuzzing = false;
+
+    printf("%lu random frames: %lu datagrams received, %lu evictions, %lu timeouts\n",
+           static_cast<unsigned long>(kNumFrames), static_cast<unsigned long>(sTotalReceived),
+           static_cast<unsigned long>(GetCounters(*instance).mNumEvictions),
+           static_cast<unsigned long>(GetCounters(*instance).mNumTimeouts));
+
+    delete stream;
+    FreeReceiver(instance);
+    printf("TestRandomFragments passed\n");
+}
+
+/* Time per fragment of 1280 byte datagrams, `aNumSources` of them under reassembly at a time */
+static double MeasureFragmentNs(Instance &aInstance, uint8_t aNumSources, Stream *aStreams)
+{
+    static const uint16_t kRounds = 500;
+
+    uint64_t elapsed   = 0;
+    uint32_t numFrames = 0;
+
+    for (uint16_t round = 0; round < kRounds; round++)
+    {
+        uint64_t start;
+
+        for (uint8_t source = 0; source < aNumSources; source++)
+        {
+            aStreams[source].mNextFrame = 0;
+        }
+
+        start = NowNs();
+
+        for (uint8_t frame = 0; frame < aStreams[0].mNumFrames; frame++)
+        {
+            for (uint8_t source = 0; source < aNumSources; source++)
+            {
+                SendNextFrame(aInstance, aStreams[source]);
+                numFrames++;
+            }
+        }
+
+        elapsed += NowNs() - start;
+    }
+
+    return static_cast<double>(elapsed) / numFrames;
+}
+
+static void Benchmark(void)
+{
+    static const uint16_t kPayloadLength = kMaxPayloadLength;
+
+    Instance *instance   = InitReceiver();
+    uint8_t   numSources = static_cast<uint8_t>(kMaxBuffers / GetDatagramBufferCount(*instance, kPayloadLength));
+    Stream   *streams    = new Stream[kMaxDatagrams];
+    double    oneNs;
+    double    manyNs;
+
+    numSources = (numSources < kMaxDatagrams) ? numSources : kMaxDatagrams;
+
+    for (uint8_t source = 0; source < kMaxDatagrams; source++)
+    {
+        BuildStream(*instance, source, 0, 0x100 + source, kPayloadLength, streams[source]);
+    }
+
+    oneNs  = MeasureFragmentNs(*instance, 1, streams);
+    manyNs = MeasureFragmentNs(*instance, numSources, streams);
+
+    VerifyOrQuit(GetCounters(*instance).mNumEvictions == 0);
+    printf("1280 byte datagrams: %.0f ns per fragment with 1 under reassembly, %.0f ns with %u\n", oneNs, manyNs,
+           numSources);
+
+    delete[] streams;
+    FreeReceiver(instance);
+}
+
+int main(void)
+{
+    TestInterleavedStreams();
+    TestDatagramLimit();
+    TestPerSourceLimit();
+    TestBufferLimit();
+    TestRepeatedFirstFragment();
+    TestTimeout();
+    TestRandomFragments();
+    Benchmark();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,427 @@
+/*
+ *  Test of the route lookup cache of the Network Data leader: the flows of a
+ *  set are replaced in least recently used order, as many flows as the cache
+ *  holds do not evict each other, the entries expire and an RLOC16 change
+ *  drops them. Also checks RouteLookup() against hand built Network Data and
+ *  benchmarks a cached lookup against a full one.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "common/hash.hpp"
+#include "common/message.hpp"
+#include "thread/network_data_leader.hpp"
+#include "thread/network_data_tlvs.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+namespace ot {
+
+static const uint16_t kNumSets       = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_SETS;
+static const uint8_t  kNumWays       = OPENTHREAD_CONFIG_NETDATA_ROUTE_CACHE_WAYS;
+static const uint32_t kEntryLifetime = 5 * 1000;
+static const uint16_t kOwnRloc16     = 0x0400;
+static const uint8_t  kNumRoutes     = 8;
+
+// Default route and on-mesh flags of a Border Router entry.
+static const uint16_t kBorderRouterFlags = (1 << 9) | (1 << 8);
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+class UnitTester
+{
+public:
+    typedef NetworkData::Leader::RouteCache RouteCache;
+
+    static void GetFlow(uint16_t aIndex, Ip6::Address &aSource, Ip6::Address &aDestination)
+    {
+        SuccessOrQuit(aSource.FromString("fd00:1::1"));
+        SuccessOrQuit(aDestination.FromString("2001:db8::1"));
+        aDestination.mFields.m8[7] = static_cast<uint8_t>(aIndex % kNumRoutes);
+        BigEndian::WriteUint16(aIndex, &aDestination.mFields.m8[14]);
+    }
+
+    static uint16_t GetSetIndex(uint16_t aIndex)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+
+        GetFlow(aIndex, source, destination);
+        return static_cast<uint16_t>(HashObject(source, HashObject(destination)) % kNumSets);
+    }
+
+    // Returns the indexes of `aCount` flows of the set `aSetIndex`.
+    static void GetFlowsInSet(uint16_t aSetIndex, uint16_t *aFlows, uint16_t aCount)
+    {
+        uint16_t index = 0;
+
+        for (uint16_t i = 0; i < aCount; index++)
+        {
+            if (GetSetIndex(index) == aSetIndex)
+            {
+                aFlows[i++] = index;
+            }
+        }
+    }
+
+    static void Add(RouteCache &aCache, uint16_t aIndex, uint16_t aOwnRloc16 = kOwnRloc16)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+
+        GetFlow(aIndex, source, destination);
+        aCache.Add(source, destination, aOwnRloc16, aIndex);
+    }
+
+    static bool IsCached(RouteCache &aCache, uint16_t aIndex, uint16_t aOwnRloc16 = kOwnRloc16)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+        uint16_t     rloc16 = 0xfffe;
+        bool         cached;
+
+        GetFlow(aIndex, source, destination);
+        cached = (aCache.Find(source, destination, aOwnRloc16, rloc16) == kErrorNone);
+        VerifyOrQuit(!cached || (rloc16 == aIndex));
+
+        return cached;
+    }
+
+    static void TestSetLru(void)
+    {
+        Instance  *instance = testInitInstance();
+        RouteCache cache;
+        uint16_t   flows[kNumWays + 2];
+
+        cache.Clear();
+        GetFlowsInSet(0, flows, kNumWays + 2);
+
+        for (uint8_t i = 0; i < kNumWays; i++)
+        {
+            Add(cache, flows[i]);
+        }
+
+        for (uint8_t i = 0; i < kNumWays; i++)
+        {
+            VerifyOrQuit(IsCached(cache, flows[i]));
+        }
+
+        // flows[0] is now the least recently used, a hit on it makes
+        // flows[1] the one to be replaced.
+        VerifyOrQuit(IsCached(cache, flows[0]));
+        Add(cache, flows[kNumWays]);
+        VerifyOrQuit(IsCached(cache, flows[kNumWays]));
+        VerifyOrQuit(IsCached(cache, flows[0]));
+        VerifyOrQuit(!IsCached(cache, flows[1]) || (kNumWays == 1));
+
+        // A flow of another set does not replace any of them.
+        for (uint16_t index = 0; kNumSets > 1; index++)
+        {
+            if (GetSetIndex(index) != 0)
+            {
+                Add(cache, index);
+                break;
+            }
+        }
+
+        VerifyOrQuit(IsCached(cache, flows[kNumWays]));
+
+        testFreeInstance(instance);
+        printf("TestSetLru passed\n");
+    }
+
+    static void TestNoThrash(void)
+    {
+        Instance  *instance = testInitInstance();
+        RouteCache cache;
+        uint16_t   flows[kNumSets][kNumWays];
+
+        cache.Clear();
+
+        for (uint16_t set = 0; set < kNumSets; set++)
+        {
+            GetFlowsInSet(set, flows[set], kNumWays);
+        }
+
+        for (uint16_t set = 0; set < kNumSets; set++)
+        {
+            for (uint8_t way = 0; way < kNumWays; way++)
+            {
+                Add(cache, flows[set][way]);
+            }
+        }
+
+        // The flows are looked up in turn, as the packets of parallel
+        // flows interleave; all of them stay cached.
+        for (uint8_t round = 0; round < 3; round++)
+        {
+            for (uint8_t way = 0; way < kNumWays; way++)
+            {
+                for (uint16_t set = 0; set < kNumSets; set++)
+                {
+                    VerifyOrQuit(IsCached(cache, flows[set][way]));
+                }
+            }
+        }
+
+        testFreeInstance(instance);
+        printf("TestNoThrash passed\n");
+    }
+
+    static void TestExpiry(void)
+    {
+        Instance  *instance = testInitInstance();
+        RouteCache cache;
+        uint16_t   flows[kNumWays + 1];
+
+        cache.Clear();
+        GetFlowsInSet(0, flows, kNumWays + 1);
+
+        Add(cache, flows[0]);
+        testAdvanceTime(*instance, kEntryLifetime / 2);
+
+        for (uint8_t i = 1; i < kNumWays; i++)
+        {
+            Add(cache, flows[i]);
+        }
+
+        VerifyOrQuit(IsCached(cache, flows[0]));
+
+        // flows[0] is the most recently used but has expired, a new
+        // flow replaces it rather than the least recently used one.
+        testAdvanceTime(*instance, kEntryLifetime / 2);
+        VerifyOrQuit(!IsCached(cache, flows[0]));
+
+        Add(cache, flows[kNumWays]);
+        VerifyOrQuit(IsCached(cache, flows[kNumWays]));
+
+        for (uint8_t i = 1; i < kNumWays; i++)
+        {
+            VerifyOrQuit(IsCached(cache, flows[i]));
+        }
+
+        testAdvanceTime(*instance, kEntryLifetime);
+
+        for (uint8_t i = 1; i <= kNumWays; i++)
+        {
+            VerifyOrQuit(!IsCached(cache, flows[i]));
+        }
+
+        testFreeInstance(instance);
+        printf("TestExpiry passed\n");
+    }
+
+    static void TestRloc16Change(void)
+    {
+        Instance  *instance = testInitInstance();
+        RouteCache cache;
+
+        cache.Clear();
+
+        Add(cache, 1);
+        Add(cache, 2);
+        VerifyOrQuit(IsCached(cache, 1));
+        VerifyOrQuit(!IsCached(cache, 1, kOwnRloc16 + 1));
+
+        // Adding a flow with a new RLOC16 drops all the others.
+        Add(cache, 3, kOwnRloc16 + 1);
+        VerifyOrQuit(IsCached(cache, 3, kOwnRloc16 + 1));
+        VerifyOrQuit(!IsCached(cache, 2, kOwnRloc16 + 1));
+        VerifyOrQuit(!IsCached(cache, 2));
+
+        testFreeInstance(instance);
+        printf("TestRloc16Change passed\n");
+    }
+
+    static uint8_t AppendPrefixTlv(uint8_t *aBuffer, const char *aPrefix, bool aIsOnMesh, uint16_t aRloc16)
+    {
+        NetworkData::PrefixTlv      *prefixTlv = reinterpret_cast<NetworkData::PrefixTlv *>(aBuffer);
+        NetworkData::NetworkDataTlv *subTlv;
+        Ip6::Prefix                  prefix;
+
+        SuccessOrQuit(prefix.FromString(aPrefix));
+        prefixTlv->Init(0, prefix);
+        subTlv = prefixTlv->GetSubTlvs();
+
+        if (aIsOnMesh)
+        {
+            NetworkData::BorderRouterTlv *borderRouterTlv = static_cast<NetworkData::BorderRouterTlv *>(subTlv);
+
+            borderRouterTlv->Init();
+            borderRouterTlv->SetLength(sizeof(NetworkData::BorderRouterEntry));
+            borderRouterTlv->GetFirstEntry()->Init();
+            borderRouterTlv->GetFirstEntry()->SetRloc(aRloc16);
+            borderRouterTlv->GetFirstEntry()->SetFlags(kBorderRouterFlags);
+        }
+        else
+        {
+            NetworkData::HasRouteTlv *hasRouteTlv = static_cast<NetworkData::HasRouteTlv *>(subTlv);
+
+            hasRouteTlv->Init();
+            hasRouteTlv->SetLength(sizeof(NetworkData::HasRouteEntry));
+            hasRouteTlv->GetFirstEntry()->Init();
+            hasRouteTlv->GetFirstEntry()->SetRloc(aRloc16);
+        }
+
+        prefixTlv->SetSubTlvsLength(subTlv->GetSize());
+
+        return prefixTlv->GetSize();
+    }
+
+    // The on-mesh prefix fd00:1::/64 has a default route through
+    // 0x0400, and 2001:db8:0:<n>::/64 has an external route through
+    // 0x0800 + n.
+    static void SetNetworkData(Instance &aInstance)
+    {
+        uint8_t     buffer[NetworkData::NetworkData::kMaxSize];
+        uint8_t     length = 0;
+        Message    *message;
+        OffsetRange offsetRange;
+
+        length += AppendPrefixTlv(&buffer[length], "fd00:1::/64", true, kOwnRloc16);
+
+        for (uint8_t i = 0; i < kNumRoutes; i++)
+        {
+            char prefix[sizeof("2001:db8:0:ff::/64")];
+
+            snprintf(prefix, sizeof(prefix), "2001:db8:0:%x::/64", i);
+            length += AppendPrefixTlv(&buffer[length], prefix, false, 0x0800 + i);
+        }
+
+        message = aInstance.Get<MessagePool>().Allocate(Message::kTypeOther);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytes(buffer, length));
+        offsetRange.InitFromMessageFullLength(*message);
+        SuccessOrQuit(
+            aInstance.Get<NetworkData::Leader>().SetNetworkData(1, 1, NetworkData::kFullSet, *message, offsetRange));
+        message->Free();
+    }
+
+    static void LookUp(Instance &aInstance, uint16_t aIndex, const char *aDestination, uint16_t aExpectedRloc16)
+    {
+        Ip6::Address source;
+        Ip6::Address destination;
+        uint16_t     rloc16;
+
+        SuccessOrQuit(source.FromString("fd00:1::1"));
+        SuccessOrQuit(destination.FromString(aDestination));
+        destination.mFields.m16[7] = BigEndian::HostSwap16(aIndex);
+
+        SuccessOrQuit(aInstance.Get<NetworkData::Leader>().RouteLookup(source, destination, rloc16));
+        VerifyOrQuit(rloc16 == aExpectedRloc16);
+    }
+
+    static void TestRouteLookup(void)
+    {
+        Instance            *instance = testInitInstance();
+        NetworkData::Leader &leader   = instance->Get<NetworkData::Leader>();
+        Ip6::Address         source;
+        Ip6::Address         destination;
+        uint16_t             rloc16;
+
+        SetNetworkData(*instance);
+
+        // The results are the same from the Network Data and from the
+        // cache.
+        for (uint8_t round = 0; round < 2; round++)
+        {
+            LookUp(*instance, 1, "2001:db8:0:3::", 0x0803);
+            LookUp(*instance, 2, "2001:db8:0:7::", 0x0807);
+            LookUp(*instance, 3, "2001:db9::", kOwnRloc16);
+        }
+
+        SuccessOrQuit(source.FromString("fd00:1::1"));
+        SuccessOrQuit(destination.FromString("2001:db8:0:3::1"));
+        SuccessOrQuit(leader.mRouteCache.Find(source, destination, leader.Get<Mle::Mle>().GetRloc16(), rloc16));
+        VerifyOrQuit(rloc16 == 0x0803);
+
+        // New Network Data drops the cached results.
+        SetNetworkData(*instance);
+        VerifyOrQuit(leader.mRouteCache.Find(source, destination, leader.Get<Mle::Mle>().GetRloc16(), rloc16) ==
+                     kErrorNotFound);
+
+        testFreeInstance(instance);
+        printf("TestRouteLookup passed\n");
+    }
+
+    static void Benchmark(void)
+    {
+        static const uint16_t kNumFlows   = kNumSets * kNumWays;
+        static const uint32_t kIterations = 20000;
+
+        Instance            *instance = testInitInstance();
+        NetworkData::Leader &leader   = instance->Get<NetworkData::Leader>();
+        Ip6::Address         source;
+        Ip6::Address         destinations[kNumFlows];
+        uint16_t             flows[kNumSets][kNumWays];
+        uint64_t             start;
+        uint64_t             cachedNs;
+        uint64_t             fullNs;
+        uint32_t             sink = 0;
+
+        SetNetworkData(*instance);
+
+        for (uint16_t set = 0; set < kNumSets; set++)
+        {
+            GetFlowsInSet(set, flows[set], kNumWays);
+
+            for (uint8_t way = 0; way < kNumWays; way++)
+            {
+                GetFlow(flows[set][way], source, destinations[set * kNumWays + way]);
+            }
+        }
+
+        start = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            uint16_t rloc16;
+
+            SuccessOrQuit(leader.RouteLookup(source, destinations[i % kNumFlows], rloc16));
+            sink += rloc16;
+        }
+
+        cachedNs = NowNs() - start;
+        start    = NowNs();
+
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            uint16_t rloc16;
+
+            leader.mRouteCache.Clear();
+            SuccessOrQuit(leader.RouteLookup(source, destinations[i % kNumFlows], rloc16));
+            sink += rloc16;
+        }
+
+        fullNs = NowNs() - start;
+
+        VerifyOrQuit(sink != 0);
+        printf("route lookup of %u flows over %u routes: cached %.1f ns, full %.1f ns\n", kNumFlows, kNumRoutes,
+               static_cast<double>(cachedNs) / kIterations, static_cast<double>(fullNs) / kIterations);
+
+        testFreeInstance(instance);
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::UnitTester::TestSetLru();
+    ot::UnitTester::TestNoThrash();
+    ot::UnitTester::TestExpiry();
+    ot::UnitTester::TestRloc16Change();
+    ot::UnitTester::TestRouteLookup();
+    ot::UnitTester::Benchmark();
+
+    printf("All tests passed\n");
+    return 0;
+}
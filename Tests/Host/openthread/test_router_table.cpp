@@ -0,0 +1,309 @@
+/*
+ *  Multi-router simulation of RouterTable::UpdateRoutes(): a leader with a
+ *  few neighbors in a 32-router network receives their Route TLVs while the
+ *  link qualities change. After each change the neighbors advertise twice
+ *  and the path costs of the leader shall be the shortest path costs of the
+ *  network. Also reports the number of routes evaluated per update and the
+ *  cost of an update against the former snapshot of all Router IDs.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "thread/mle.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/router_table.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint8_t kNumRouters   = 32; // The leader is router 0 of the simulation
+static const uint8_t kNumNeighbors = 6;  // Routers 1 to 6 may have a link to the leader
+static const uint8_t kNoLink       = Mle::kMaxRouteCost;
+
+static uint8_t  sRouterIds[kNumRouters];
+static uint8_t  sLinkCost[kNumRouters][kNumRouters];
+static uint8_t  sPathCost[kNumRouters][kNumRouters];
+static uint32_t sRandomState = 0x2c1b3c6d;
+static uint64_t sUpdateNs;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static LinkQuality LinkQualityForCost(uint8_t aCost)
+{
+    LinkQuality linkQuality;
+
+    switch (aCost)
+    {
+    case kCostForLinkQuality3:
+        linkQuality = kLinkQuality3;
+        break;
+    case kCostForLinkQuality2:
+        linkQuality = kLinkQuality2;
+        break;
+    case kCostForLinkQuality1:
+        linkQuality = kLinkQuality1;
+        break;
+    default:
+        linkQuality = kLinkQuality0;
+        break;
+    }
+
+    return linkQuality;
+}
+
+static uint8_t RandomLinkCost(void)
+{
+    static const uint8_t kCosts[] = {kCostForLinkQuality3, kCostForLinkQuality2, kCostForLinkQuality1, kNoLink};
+
+    return kCosts[NextRandom() % GetArrayLength(kCosts)];
+}
+
+static void SetLinkCost(uint8_t aFirst, uint8_t aSecond, uint8_t aCost)
+{
+    sLinkCost[aFirst][aSecond] = aCost;
+    sLinkCost[aSecond][aFirst] = aCost;
+}
+
+/* Floyd-Warshall over the whole network, the reference for the leader */
+static void ComputePathCosts(void)
+{
+    memcpy(sPathCost, sLinkCost, sizeof(sPathCost));
+
+    for (uint8_t i = 0; i < kNumRouters; i++)
+    {
+        sPathCost[i][i] = 0;
+    }
+
+    for (uint8_t k = 0; k < kNumRouters; k++)
+    {
+        for (uint8_t i = 0; i < kNumRouters; i++)
+        {
+            for (uint8_t j = 0; j < kNumRouters; j++)
+            {
+                if (sPathCost[i][k] + sPathCost[k][j] < sPathCost[i][j])
+                {
+                    sPathCost[i][j] = static_cast<uint8_t>(sPathCost[i][k] + sPathCost[k][j]);
+                }
+            }
+        }
+    }
+}
+
+/* Route TLV of router `aSender`, with the entries in Router ID order */
+static void FillRouteTlv(Instance &aInstance, uint8_t aSender, Mle::RouteTlv &aRouteTlv)
+{
+    Mle::RouterIdSet routerIdSet;
+    uint8_t          index = 0;
+
+    routerIdSet.Clear();
+    aRouteTlv.Init();
+    aRouteTlv.SetRouterIdSequence(aInstance.Get<RouterTable>().GetRouterIdSequence());
+
+    for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+    {
+        for (uint8_t i = 0; i < kNumRouters; i++)
+        {
+            LinkQuality linkQuality = LinkQualityForCost(sLinkCost[aSender][i]);
+            uint8_t     cost        = sPathCost[aSender][i];
+
+            if (sRouterIds[i] != routerId)
+            {
+                continue;
+            }
+
+            routerIdSet.Add(routerId);
+
+            if (i == aSender)
+            {
+                aRouteTlv.SetRouteData(index, kLinkQuality0, kLinkQuality0, 1);
+            }
+            else
+            {
+                aRouteTlv.SetRouteData(index, linkQuality, linkQuality, (cost < Mle::kMaxRouteCost) ? cost : 0);
+            }
+
+            index++;
+        }
+    }
+
+    aRouteTlv.SetRouterIdMask(routerIdSet);
+    aRouteTlv.SetRouteDataLength(index);
+}
+
+static void Advertise(Instance &aInstance, uint8_t aSender)
+{
+    Mle::RouteTlv routeTlv;
+    uint64_t      start;
+
+    FillRouteTlv(aInstance, aSender, routeTlv);
+
+    start = NowNs();
+    aInstance.Get<RouterTable>().UpdateRoutes(routeTlv, sRouterIds[aSender]);
+    sUpdateNs += NowNs() - start;
+}
+
+static void VerifyPathCosts(Instance &aInstance)
+{
+    for (uint8_t i = 1; i < kNumRouters; i++)
+    {
+        uint8_t expected = (sPathCost[0][i] < Mle::kMaxRouteCost) ? sPathCost[0][i] : Mle::kMaxRouteCost;
+
+        VerifyOrQuit(aInstance.Get<RouterTable>().GetPathCost(Mle::Rloc16FromRouterId(sRouterIds[i])) == expected);
+    }
+}
+
+static void SetUpNetwork(Instance &aInstance)
+{
+    uint8_t leaderId = Mle::RouterIdFromRloc16(aInstance.Get<Mle::Mle>().GetRloc16());
+    uint8_t routerId = 0;
+
+    sRouterIds[0] = leaderId;
+
+    for (uint8_t i = 1; i < kNumRouters; i++, routerId += 2)
+    {
+        Router *router;
+
+        routerId += (routerId == leaderId) ? 1 : 0;
+        sRouterIds[i] = routerId;
+
+        router = aInstance.Get<RouterTable>().Allocate(routerId);
+        VerifyOrQuit(router != nullptr);
+
+        if (i <= kNumNeighbors)
+        {
+            // The leader hears all its neighbors well, the link cost
+            // is set by the link quality they report.
+            router->GetLinkInfo().AddRss(-30);
+            router->SetState(Neighbor::kStateValid);
+        }
+    }
+
+    // A chain through all routers, each one linked to a few others.
+    memset(sLinkCost, kNoLink, sizeof(sLinkCost));
+
+    for (uint8_t i = 1; i < kNumRouters; i++)
+    {
+        SetLinkCost(i, (i + 1 < kNumRouters) ? i + 1 : 1, kCostForLinkQuality3);
+        SetLinkCost(i, 1 + NextRandom() % (kNumRouters - 1), RandomLinkCost());
+    }
+
+    for (uint8_t i = 1; i <= kNumNeighbors; i++)
+    {
+        SetLinkCost(0, i, RandomLinkCost());
+    }
+
+    for (uint8_t i = 0; i < kNumRouters; i++)
+    {
+        sLinkCost[i][i] = kNoLink;
+    }
+}
+
+static void Converge(Instance &aInstance)
+{
+    ComputePathCosts();
+
+    // Two rounds: a neighbor advertising a worse route after the best
+    // one in the first round is corrected in the second.
+    for (uint8_t round = 0; round < 2; round++)
+    {
+        for (uint8_t i = 1; i <= kNumNeighbors; i++)
+        {
+            Advertise(aInstance, i);
+        }
+    }
+}
+
+static void TestRouteStream(void)
+{
+    static const uint16_t kNumChanges = 2000;
+
+    Instance                               *instance = testInitInstance();
+    const RouterTable::RouteUpdateCounters &counters = instance->Get<RouterTable>().GetRouteUpdateCounters();
+    uint64_t                                start;
+    uint64_t                                snapshotNs;
+    uint32_t                                sink = 0;
+
+    testStartLeader(*instance);
+    SetUpNetwork(*instance);
+
+    Converge(*instance);
+    VerifyPathCosts(*instance);
+
+    instance->Get<RouterTable>().ResetRouteUpdateCounters();
+    sUpdateNs = 0;
+
+    // Each change is one link getting better, worse, or broken. A link
+    // of the leader changes the link cost to a neighbor, any other one
+    // the route costs the neighbors advertise.
+    for (uint16_t change = 0; change < kNumChanges; change++)
+    {
+        uint8_t first  = static_cast<uint8_t>(NextRandom() % kNumRouters);
+        uint8_t second = static_cast<uint8_t>(1 + NextRandom() % (kNumRouters - 1));
+
+        if ((first == 0) && (second > kNumNeighbors))
+        {
+            second = static_cast<uint8_t>(1 + second % kNumNeighbors);
+        }
+
+        if (first != second)
+        {
+            SetLinkCost(first, second, RandomLinkCost());
+        }
+
+        Converge(*instance);
+        VerifyPathCosts(*instance);
+    }
+
+    // The update used to snapshot the path cost of every Router ID
+    // before and after processing the Route TLV.
+    start = NowNs();
+
+    for (uint32_t i = 0; i < counters.mNumUpdates; i++)
+    {
+        for (uint8_t routerId = 0; routerId <= Mle::kMaxRouterId; routerId++)
+        {
+            sink += instance->Get<RouterTable>().GetPathCost(Mle::Rloc16FromRouterId(routerId));
+        }
+    }
+
+    snapshotNs = 2 * (NowNs() - start);
+
+    VerifyOrQuit(sink != 0);
+    VerifyOrQuit(counters.mNumUpdates == 2u * kNumNeighbors * kNumChanges);
+    VerifyOrQuit(counters.mNumRoutesEvaluated <= counters.mNumUpdates * (kNumRouters - 2u));
+
+    printf("%u routers: %.1f routes evaluated and %.2f changed per update, update %.0f ns, former snapshot of all "
+           "Router IDs %.0f ns more\n",
+           kNumRouters, static_cast<double>(counters.mNumRoutesEvaluated) / counters.mNumUpdates,
+           static_cast<double>(counters.mNumRoutesChanged) / counters.mNumUpdates,
+           static_cast<double>(sUpdateNs) / counters.mNumUpdates, static_cast<double>(snapshotNs) / counters.mNumUpdates);
+
+    testFreeInstance(instance);
+    printf("TestRouteStream passed\n");
+}
+
+int main(void)
+{
+    TestRouteStream();
+
+    printf("All tests passed\n");
+    return 0;
+}
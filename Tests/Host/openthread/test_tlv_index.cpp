@@ -0,0 +1,394 @@
+/*
+ *  Test of TlvIndex: the lookups through an index of random TLV messages
+ *  (extended TLVs, repeated types, more types than the index records, a
+ *  malformed TLV) shall return what the lookups on the message return. Also
+ *  benchmarks the lookups of an MLE Child ID Request handler and of a network
+ *  diagnostic answer with and without an index.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "common/message.hpp"
+#include "common/tlvs.hpp"
+#include "thread/mle_tlvs.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+using namespace ot;
+
+static const uint8_t kNumTypes = 24;
+
+static uint32_t sRandomState = 0x6d2b79f5;
+
+static uint32_t NextRandom(void)
+{
+    sRandomState ^= sRandomState << 13;
+    sRandomState ^= sRandomState >> 17;
+    sRandomState ^= sRandomState << 5;
+
+    return sRandomState;
+}
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void AppendTlv(Message &aMessage, uint8_t aType, uint16_t aLength)
+{
+    uint8_t value[300];
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        value[i] = static_cast<uint8_t>(NextRandom());
+    }
+
+    if (aLength < 255)
+    {
+        Tlv tlv;
+
+        tlv.SetType(aType);
+        tlv.SetLength(static_cast<uint8_t>(aLength));
+        SuccessOrQuit(aMessage.Append(tlv));
+    }
+    else
+    {
+        ExtendedTlv tlv;
+
+        tlv.SetType(aType);
+        tlv.SetLength(aLength);
+        SuccessOrQuit(aMessage.Append(tlv));
+    }
+
+    SuccessOrQuit(aMessage.AppendBytes(value, aLength));
+}
+
+template <typename UintType> static void VerifyUintLookup(const Message &aMessage, const TlvIndex &aIndex)
+{
+    typedef UintTlvInfo<3, UintType> UintTlv;
+
+    UintType value      = 0;
+    UintType indexValue = 0;
+    Error    error      = Tlv::Find<UintTlv>(aMessage, value);
+
+    VerifyOrQuit(Tlv::Find<UintTlv>(aIndex, indexValue) == error);
+    VerifyOrQuit(value == indexValue);
+}
+
+static void VerifyLookups(const Message &aMessage)
+{
+    typedef SimpleTlvInfo<5, Mac::ExtAddress> SimpleTlv;
+    typedef StringTlvInfo<7, 16>              StringTlv;
+
+    TlvIndex index(aMessage);
+
+    for (uint16_t type = 0; type <= kNumTypes + 1; type++)
+    {
+        OffsetRange offsetRange;
+        OffsetRange indexOffsetRange;
+        Error       error;
+        uint8_t     buffer[40];
+        uint8_t     indexBuffer[40];
+        uint16_t    maxSize = static_cast<uint16_t>(sizeof(Tlv) + NextRandom() % (sizeof(buffer) - sizeof(Tlv)));
+
+        offsetRange.Clear();
+        indexOffsetRange.Clear();
+        error = Tlv::FindTlvValueOffsetRange(aMessage, static_cast<uint8_t>(type), offsetRange);
+        VerifyOrQuit(Tlv::FindTlvValueOffsetRange(index, static_cast<uint8_t>(type), indexOffsetRange) == error);
+        VerifyOrQuit(offsetRange.GetOffset() == indexOffsetRange.GetOffset());
+        VerifyOrQuit(offsetRange.GetLength() == indexOffsetRange.GetLength());
+
+        memset(buffer, 0, sizeof(buffer));
+        memset(indexBuffer, 0, sizeof(indexBuffer));
+        error = Tlv::FindTlv(aMessage, static_cast<uint8_t>(type), maxSize, *reinterpret_cast<Tlv *>(buffer));
+        VerifyOrQuit(Tlv::FindTlv(index, static_cast<uint8_t>(type), maxSize, *reinterpret_cast<Tlv *>(indexBuffer)) ==
+                     error);
+        VerifyOrQuit(memcmp(buffer, indexBuffer, sizeof(buffer)) == 0);
+    }
+
+    VerifyUintLookup<uint8_t>(aMessage, index);
+    VerifyUintLookup<uint16_t>(aMessage, index);
+    VerifyUintLookup<uint32_t>(aMessage, index);
+
+    {
+        Mac::ExtAddress value;
+        Mac::ExtAddress indexValue;
+        Error           error;
+
+        value.Clear();
+        indexValue.Clear();
+        error = Tlv::Find<SimpleTlv>(aMessage, value);
+        VerifyOrQuit(Tlv::Find<SimpleTlv>(index, indexValue) == error);
+        VerifyOrQuit(value == indexValue);
+    }
+
+    {
+        StringTlv::StringType value;
+        StringTlv::StringType indexValue;
+        Error                 error;
+
+        memset(value, 0, sizeof(value));
+        memset(indexValue, 0, sizeof(indexValue));
+        error = Tlv::Find<StringTlv>(aMessage, value);
+        VerifyOrQuit(Tlv::Find<StringTlv>(index, indexValue) == error);
+        VerifyOrQuit(memcmp(value, indexValue, sizeof(value)) == 0);
+    }
+}
+
+static void TestRandomMessages(void)
+{
+    static const uint16_t kRounds = 2000;
+
+    Instance *instance = testInitInstance();
+
+    for (uint16_t round = 0; round < kRounds; round++)
+    {
+        Message *message  = instance->Get<MessagePool>().Allocate(Message::kTypeOther);
+        uint16_t offset   = NextRandom() % 100;
+        uint8_t  numTlvs  = NextRandom() % 30;
+        uint8_t  numTypes = (round % 2) ? kNumTypes : TlvIndex::kMaxEntries;
+        uint8_t  header[100];
+
+        VerifyOrQuit(message != nullptr);
+        memset(header, 0x03, sizeof(header));
+        SuccessOrQuit(message->AppendBytes(header, offset));
+
+        for (uint8_t i = 0; i < numTlvs; i++)
+        {
+            uint8_t  type   = NextRandom() % numTypes;
+            uint16_t length = (NextRandom() % 8 == 0) ? 255 + NextRandom() % 40 : NextRandom() % 20;
+
+            AppendTlv(*message, type, length);
+        }
+
+        switch (NextRandom() % 4)
+        {
+        case 0:
+        {
+            // A TLV running past the end of the message.
+            Tlv tlv;
+
+            tlv.SetType(NextRandom() % numTypes);
+            tlv.SetLength(200);
+            SuccessOrQuit(message->Append(tlv));
+            AppendTlv(*message, 3, 4);
+            break;
+        }
+
+        case 1:
+            // A truncated TLV header.
+            SuccessOrQuit(message->Append<uint8_t>(NextRandom() % numTypes));
+            break;
+
+        default:
+            break;
+        }
+
+        message->SetOffset(offset);
+        VerifyLookups(*message);
+        message->Free();
+    }
+
+    testFreeInstance(instance);
+    printf("TestRandomMessages passed\n");
+}
+
+/* TLVs of a Child ID Request, as sent by an FTD child */
+static Message *NewChildIdRequest(Instance &aInstance)
+{
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeOther);
+    uint8_t  header[60];
+
+    VerifyOrQuit(message != nullptr);
+    memset(header, 0, sizeof(header));
+    SuccessOrQuit(message->AppendBytes(header, sizeof(header)));
+    message->SetOffset(sizeof(header));
+
+    AppendTlv(*message, Mle::Tlv::kResponse, 8);
+    AppendTlv(*message, Mle::Tlv::kLinkFrameCounter, sizeof(uint32_t));
+    AppendTlv(*message, Mle::Tlv::kMleFrameCounter, sizeof(uint32_t));
+    AppendTlv(*message, Mle::Tlv::kMode, sizeof(uint8_t));
+    AppendTlv(*message, Mle::Tlv::kTimeout, sizeof(uint32_t));
+    AppendTlv(*message, Mle::Tlv::kVersion, sizeof(uint16_t));
+    AppendTlv(*message, Mle::Tlv::kAddressRegistration, 3 * 9);
+    AppendTlv(*message, Mle::Tlv::kTlvRequest, 3);
+    AppendTlv(*message, Mle::Tlv::kActiveTimestamp, 8);
+    AppendTlv(*message, Mle::Tlv::kSupervisionInterval, sizeof(uint16_t));
+
+    return message;
+}
+
+/* TLVs of a network diagnostic answer with most of the diagnostic types */
+static Message *NewDiagnosticAnswer(Instance &aInstance)
+{
+    static const uint8_t kLengths[] = {8, 2, 1, 4, 10, 40, 30, 8, 48, 0, 0, 0, 0, 0, 3, 30, 20, 4, 2, 28};
+
+    Message *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeOther);
+    uint8_t  header[48];
+
+    VerifyOrQuit(message != nullptr);
+    memset(header, 0, sizeof(header));
+    SuccessOrQuit(message->AppendBytes(header, sizeof(header)));
+    message->SetOffset(sizeof(header));
+
+    for (uint8_t type = 0; type < GetArrayLength(kLengths); type++)
+    {
+        if ((type < 9) || (type > 13))
+        {
+            AppendTlv(*message, type, kLengths[type]);
+        }
+    }
+
+    return message;
+}
+
+static uint32_t LookUpChildIdRequest(const Message &aMessage)
+{
+    OffsetRange offsetRange;
+    uint32_t    sum = 0;
+    uint32_t    value32;
+    uint16_t    value16;
+    uint8_t     value8;
+
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aMessage, Mle::Tlv::kResponse, offsetRange));
+    SuccessOrQuit(Tlv::Find<Mle::LinkFrameCounterTlv>(aMessage, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::MleFrameCounterTlv>(aMessage, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::ModeTlv>(aMessage, value8));
+    sum += value8;
+    SuccessOrQuit(Tlv::Find<Mle::TimeoutTlv>(aMessage, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::VersionTlv>(aMessage, value16));
+    sum += value16;
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aMessage, Mle::Tlv::kAddressRegistration, offsetRange));
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aMessage, Mle::Tlv::kTlvRequest, offsetRange));
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aMessage, Mle::Tlv::kActiveTimestamp, offsetRange));
+    VerifyOrQuit(Tlv::FindTlvValueOffsetRange(aMessage, Mle::Tlv::kPendingTimestamp, offsetRange) == kErrorNotFound);
+    SuccessOrQuit(Tlv::Find<Mle::SupervisionIntervalTlv>(aMessage, value16));
+    sum += value16;
+
+    return sum;
+}
+
+static uint32_t LookUpChildIdRequest(const TlvIndex &aIndex)
+{
+    OffsetRange offsetRange;
+    uint32_t    sum = 0;
+    uint32_t    value32;
+    uint16_t    value16;
+    uint8_t     value8;
+
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aIndex, Mle::Tlv::kResponse, offsetRange));
+    SuccessOrQuit(Tlv::Find<Mle::LinkFrameCounterTlv>(aIndex, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::MleFrameCounterTlv>(aIndex, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::ModeTlv>(aIndex, value8));
+    sum += value8;
+    SuccessOrQuit(Tlv::Find<Mle::TimeoutTlv>(aIndex, value32));
+    sum += value32;
+    SuccessOrQuit(Tlv::Find<Mle::VersionTlv>(aIndex, value16));
+    sum += value16;
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aIndex, Mle::Tlv::kAddressRegistration, offsetRange));
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aIndex, Mle::Tlv::kTlvRequest, offsetRange));
+    SuccessOrQuit(Tlv::FindTlvValueOffsetRange(aIndex, Mle::Tlv::kActiveTimestamp, offsetRange));
+    VerifyOrQuit(Tlv::FindTlvValueOffsetRange(aIndex, Mle::Tlv::kPendingTimestamp, offsetRange) == kErrorNotFound);
+    SuccessOrQuit(Tlv::Find<Mle::SupervisionIntervalTlv>(aIndex, value16));
+    sum += value16;
+
+    return sum;
+}
+
+template <typename Source> static uint32_t LookUpDiagnosticAnswer(const Source &aSource)
+{
+    OffsetRange offsetRange;
+    uint32_t    sum = 0;
+
+    for (uint8_t type = 0; type < 20; type++)
+    {
+        if (Tlv::FindTlvValueOffsetRange(aSource, type, offsetRange) == kErrorNone)
+        {
+            sum += offsetRange.GetLength();
+        }
+    }
+
+    return sum;
+}
+
+static void Benchmark(void)
+{
+    static const uint32_t kIterations = 20000;
+
+    Instance *instance = testInitInstance();
+    Message  *messages[2];
+    uint64_t  messageNs[2];
+    uint64_t  indexNs[2];
+    uint64_t  start;
+
+    messages[0] = NewChildIdRequest(*instance);
+    messages[1] = NewDiagnosticAnswer(*instance);
+
+    VerifyOrQuit(LookUpChildIdRequest(*messages[0]) == LookUpChildIdRequest(TlvIndex(*messages[0])));
+    VerifyOrQuit(LookUpDiagnosticAnswer(*messages[1]) == LookUpDiagnosticAnswer(TlvIndex(*messages[1])));
+
+    start = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        LookUpChildIdRequest(*messages[0]);
+    }
+
+    messageNs[0] = NowNs() - start;
+    start        = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        TlvIndex index(*messages[0]);
+
+        LookUpChildIdRequest(index);
+    }
+
+    indexNs[0] = NowNs() - start;
+    start      = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        LookUpDiagnosticAnswer(*messages[1]);
+    }
+
+    messageNs[1] = NowNs() - start;
+    start        = NowNs();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        TlvIndex index(*messages[1]);
+
+        LookUpDiagnosticAnswer(index);
+    }
+
+    indexNs[1] = NowNs() - start;
+
+    printf("Child ID Request (11 lookups): message %.0f ns, index %.0f ns\n",
+           static_cast<double>(messageNs[0]) / kIterations, static_cast<double>(indexNs[0]) / kIterations);
+    printf("diagnostic answer (20 lookups): message %.0f ns, index %.0f ns\n",
+           static_cast<double>(messageNs[1]) / kIterations, static_cast<double>(indexNs[1]) / kIterations);
+
+    messages[0]->Free();
+    messages[1]->Free();
+    testFreeInstance(instance);
+}
+
+int main(void)
+{
+    TestRandomMessages();
+    Benchmark();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,34 @@
+/*
+ *  Assertion helpers of the OpenThread core host tests.
+ */
+
+#ifndef TEST_UTIL_H_
+#define TEST_UTIL_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openthread/error.h>
+
+#define VerifyOrQuit(aStatement)                                                  \
+    do                                                                            \
+    {                                                                             \
+        if (!(aStatement))                                                        \
+        {                                                                         \
+            fprintf(stderr, "%s:%d: FAIL %s\n", __FILE__, __LINE__, #aStatement); \
+            exit(1);                                                              \
+        }                                                                         \
+    } while (false)
+
+#define SuccessOrQuit(aError)                                                                                    \
+    do                                                                                                           \
+    {                                                                                                            \
+        otError error_ = static_cast<otError>(aError);                                                           \
+        if (error_ != OT_ERROR_NONE)                                                                             \
+        {                                                                                                        \
+            fprintf(stderr, "%s:%d: FAIL %s -> %s\n", __FILE__, __LINE__, #aError, otThreadErrorToString(error_)); \
+            exit(1);                                                                                             \
+        }                                                                                                        \
+    } while (false)
+
+#endif // TEST_UTIL_H_
@@ -0,0 +1,24 @@
+/**
+  ******************************************************************************
+  * @file    FreeRTOS.h
+  * @brief   Host stub of the FreeRTOS kernel header for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef long          BaseType_t;
+typedef uint32_t      TickType_t;
+
+#define pdFALSE                                 ( ( BaseType_t ) 0 )
+#define pdTRUE                                  ( ( BaseType_t ) 1 )
+
+/* One tick per millisecond, as configTICK_RATE_HZ of the product */
+#define pdMS_TO_TICKS( xTimeInMs )              ( ( TickType_t ) ( xTimeInMs ) )
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,16 @@
+/**
+  ******************************************************************************
+  * @file    RTDebug.h
+  * @brief   Host stub of the real time debug signals for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef RTDEBUG_H
+#define RTDEBUG_H
+
+/* There is no debug GPIO on the host */
+#define SYSTEM_DEBUG_SIGNAL_SET( signal )
+#define SYSTEM_DEBUG_SIGNAL_RESET( signal )
+
+#endif /* RTDEBUG_H */
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @file    app_common.h
+  * @brief   Host stub of the application common header for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef APP_COMMON_H
+#define APP_COMMON_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "app_conf.h"
+
+#undef FALSE
+#define FALSE                   0
+
+#undef TRUE
+#define TRUE                    (!0)
+
+#ifndef UNUSED
+#define UNUSED( X )   (void)X
+#endif /* UNUSED */
+
+#define __WEAK        __attribute__((weak))
+
+#endif /* APP_COMMON_H */
@@ -0,0 +1,13 @@
+/* Host stub of the application configuration for the host tests */
+
+#ifndef APP_CONF_H
+#define APP_CONF_H
+
+/* As on the target, brings the utilities configuration and the CMSIS intrinsics */
+#include "utilities_conf.h"
+
+/* RNG pool, as Core/Inc/app_conf.h */
+#define CFG_HW_RNG_POOL_SIZE                (32)
+#define CFG_HW_RNG_POOL_THRESHOLD           (16)
+
+#endif /* APP_CONF_H */
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_compiler.h
+  * @brief   Host stub of the CMSIS compiler header for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#define __PACKED_STRUCT   struct __attribute__((packed))
+
+/* The tests are single threaded, there is no interrupt to mask */
+static inline uint32_t __get_PRIMASK (void)
+{
+  return 0U;
+}
+
+static inline void __set_PRIMASK (uint32_t priMask)
+{
+  (void)priMask;
+}
+
+static inline void __disable_irq (void)
+{
+}
+
+/* Bit manipulation instructions, as defined by cmsis_gcc.h */
+static inline uint32_t __REV (uint32_t value)
+{
+  return __builtin_bswap32 (value);
+}
+
+static inline uint32_t __RBIT (uint32_t value)
+{
+  uint32_t result = 0U;
+
+  for (uint32_t bitIdx = 0U; bitIdx < 32U; bitIdx++)
+  {
+    result = (result << 1U) | ((value >> bitIdx) & 1U);
+  }
+
+  return result;
+}
+
+static inline uint8_t __CLZ (uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint8_t)__builtin_clz (value);
+}
+
+/* Memory barrier and exclusive accesses, as defined by cmsis_gcc.h. The tests
+   are single threaded: the exclusive monitor is a flag, which the interrupts a
+   test runs clear as the exception return does on the target. A test can define
+   CMSIS_TEST_BARRIER_HOOK() and CMSIS_TEST_EXCLUSIVE_HOOK() to run an interrupt
+   like action at a barrier or right after an exclusive load */
+#ifndef CMSIS_TEST_BARRIER_HOOK
+#define CMSIS_TEST_BARRIER_HOOK( )
+#endif /* CMSIS_TEST_BARRIER_HOOK */
+
+#ifndef CMSIS_TEST_EXCLUSIVE_HOOK
+#define CMSIS_TEST_EXCLUSIVE_HOOK( )
+#endif /* CMSIS_TEST_EXCLUSIVE_HOOK */
+
+static inline volatile uint8_t * __exclusive_monitor (void)
+{
+  static volatile uint8_t monitor;
+
+  return &monitor;
+}
+
+static inline void __DMB (void)
+{
+  CMSIS_TEST_BARRIER_HOOK ();
+}
+
+static inline void __CLREX (void)
+{
+  *__exclusive_monitor () = 0U;
+}
+
+static inline uint32_t __LDREXW (volatile uint32_t *addr)
+{
+  uint32_t result = *addr;
+
+  *__exclusive_monitor () = 1U;
+  CMSIS_TEST_EXCLUSIVE_HOOK ();
+
+  return result;
+}
+
+static inline uint32_t __STREXW (uint32_t value, volatile uint32_t *addr)
+{
+  if (*__exclusive_monitor () == 0U)
+  {
+    return 1U;
+  }
+
+  *addr = value;
+  *__exclusive_monitor () = 0U;
+
+  return 0U;
+}
+
+#endif /* CMSIS_COMPILER_H */
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    cmsis_os2.h
+  * @brief   Host stub of the CMSIS-RTOS2 API for the host tests
+  ******************************************************************************
+  * The CMSIS-RTOS2 types and functions used by the application and the
+  * drivers. The functions are implemented by the test.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef CMSIS_OS2_H
+#define CMSIS_OS2_H
+
+#include <stdint.h>
+
+typedef enum
+{
+  osOK             =  0,
+  osError          = -1,
+  osErrorTimeout   = -2,
+  osErrorResource  = -3,
+  osErrorParameter = -4
+} osStatus_t;
+
+typedef enum
+{
+  osPriorityLow     =  8,
+  osPriorityNormal  = 24,
+  osPriorityNormal3 = 24 + 3
+} osPriority_t;
+
+typedef void * osThreadId_t;
+typedef void * osMessageQueueId_t;
+typedef void ( *osThreadFunc_t ) ( void *argument );
+
+typedef struct
+{
+  const char   *name;
+  uint32_t      attr_bits;
+  void         *cb_mem;
+  uint32_t      cb_size;
+  void         *stack_mem;
+  uint32_t      stack_size;
+  osPriority_t  priority;
+  uint32_t      tz_module;
+  uint32_t      reserved;
+} osThreadAttr_t;
+
+typedef struct
+{
+  const char   *name;
+} osMessageQueueAttr_t;
+
+#define osWaitForever                           0xFFFFFFFFU
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osStatus_t osThreadSuspend (osThreadId_t thread_id);
+osStatus_t osThreadResume (osThreadId_t thread_id);
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr);
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout);
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+
+#endif /* CMSIS_OS2_H */
@@ -0,0 +1,19 @@
+/**
+  ******************************************************************************
+  * @file    log_module.h
+  * @brief   Host stub of the log module for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef LOG_MODULE_H
+#define LOG_MODULE_H
+
+/* The tests check the behaviour, not the traces */
+#define LOG_ERROR_APP( ... )
+#define LOG_INFO_APP( ... )
+#define LOG_DEBUG_APP( ... )
+
+#define APP_DBG                 LOG_INFO_APP
+
+#endif /* LOG_MODULE_H */
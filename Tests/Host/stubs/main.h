@@ -0,0 +1,20 @@
+/**
+  ******************************************************************************
+  * @file    main.h
+  * @brief   Host stub of the application main header for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef MAIN_H
+#define MAIN_H
+
+#include <stdint.h>
+
+#include "stm32wbaxx_hal.h"
+#include "app_common.h"
+
+/* Implemented by the test, on its simulated clock */
+uint32_t HAL_GetTick (void);
+
+#endif /* MAIN_H */
@@ -0,0 +1,15 @@
+/**
+  ******************************************************************************
+  * @file    ot_app.h
+  * @brief   Host stub of the OpenThread application header for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef OT_APP_H
+#define OT_APP_H
+
+/* The traces of the drivers are not printed by the tests */
+#define OTAPP_PRINTF( ... )
+
+#endif /* OT_APP_H */
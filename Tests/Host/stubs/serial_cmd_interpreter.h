@@ -0,0 +1,12 @@
+/**
+  ******************************************************************************
+  * @file    serial_cmd_interpreter.h
+  * @brief   Host stub of the serial command interpreter for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef SERIAL_CMD_INTERPRETER_H
+#define SERIAL_CMD_INTERPRETER_H
+
+#endif /* SERIAL_CMD_INTERPRETER_H */
@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file    stm32_rtos.h
+  * @brief   Host stub of the RTOS include file for the host tests
+  ******************************************************************************
+  * The task configuration of the application, as Core/Inc/stm32_rtos.h, on
+  * top of the CMSIS-RTOS2 stub.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32_RTOS_H
+#define STM32_RTOS_H
+
+#include "cmsis_os2.h"
+
+/* As Core/Inc/stm32_rtos.h */
+#define TASK_PRIO_BUTTON_Bx                     osPriorityNormal3
+#define TASK_STACK_SIZE_BUTTON_Bx               ( 1024u )
+
+#define TASK_DEFAULT_ATTR_BITS                  ( 0u )
+#define TASK_DEFAULT_CB_MEM                     ( 0u )
+#define TASK_DEFAULT_CB_SIZE                    ( 0u )
+#define TASK_DEFAULT_STACK_MEM                  ( 0u )
+
+#endif /* STM32_RTOS_H */
@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx.h
+  * @brief   Host stub of the device header for the host tests
+  ******************************************************************************
+  * The register definitions of the peripherals with a host model, as in
+  * stm32wba65xx.h, the device of the product. The register blocks are
+  * instantiated by the test.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_H
+#define STM32WBAXX_H
+
+#include <stdint.h>
+
+#include "cmsis_compiler.h"
+
+#define __IO                volatile
+#define __weak              __attribute__((weak))
+
+#define SET_BIT(REG, BIT)     ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)   ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)    ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)   ((REG) = (VAL))
+#define READ_REG(REG)         ((REG))
+
+typedef enum
+{
+  RNG_IRQn                  = 59
+} IRQn_Type;
+
+/* The interrupts of a model are raised by the test */
+static inline void NVIC_SetPriority (IRQn_Type IRQn, uint32_t priority)
+{
+  (void)IRQn;
+  (void)priority;
+}
+
+static inline void NVIC_EnableIRQ (IRQn_Type IRQn)
+{
+  (void)IRQn;
+}
+
+typedef struct
+{
+  __IO uint32_t CR;
+  __IO uint32_t SR;
+  __IO uint32_t DR;
+  uint32_t RESERVED;
+  __IO uint32_t HTCR;
+} RNG_TypeDef;
+
+extern RNG_TypeDef RngRegisters;
+
+#define RNG                                 (&RngRegisters)
+
+#define RCC_AHB2ENR_RNGEN                   (0x1UL << 18U)
+
+#define RNG_CR_RNGEN                        (0x1UL << 2U)
+#define RNG_CR_IE                           (0x1UL << 3U)
+#define RNG_CR_CED                          (0x1UL << 5U)
+#define RNG_CR_CONDRST                      (0x1UL << 30U)
+#define RNG_SR_DRDY                         (0x1UL << 0U)
+#define RNG_SR_CECS                         (0x1UL << 1U)
+#define RNG_SR_SECS                         (0x1UL << 2U)
+#define RNG_SR_CEIS                         (0x1UL << 5U)
+#define RNG_SR_SEIS                         (0x1UL << 6U)
+
+#define RNG_CR_NIST_VALUE                   (0x00200F00U)
+#define RNG_HTCR_NIST_VALUE                 (0xA2B0U)
+
+/* As stm32wbaxx_hal_rng.h, that the target gets through the HAL configuration */
+#define RNG_CED_DISABLE                     RNG_CR_CED
+
+#endif /* STM32WBAXX_H */
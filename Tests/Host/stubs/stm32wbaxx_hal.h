@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_hal.h
+  * @brief   Host stub of the HAL for the host tests
+  ******************************************************************************
+  * The UART and DMA handles used by the drivers, as declared by
+  * stm32wbaxx_hal_uart.h and stm32wbaxx_hal_dma.h. The UART functions are
+  * implemented by the test, on its simulated UART.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_HAL_H
+#define STM32WBAXX_HAL_H
+
+#include "stm32wbaxx.h"
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  HAL_UART_STATE_RESET      = 0x00U,
+  HAL_UART_STATE_READY      = 0x20U,
+  HAL_UART_STATE_BUSY       = 0x24U,
+  HAL_UART_STATE_BUSY_TX    = 0x21U,
+  HAL_UART_STATE_BUSY_RX    = 0x22U,
+  HAL_UART_STATE_BUSY_TX_RX = 0x23U,
+  HAL_UART_STATE_TIMEOUT    = 0xA0U,
+  HAL_UART_STATE_ERROR      = 0xE0U
+} HAL_UART_StateTypeDef;
+
+typedef struct
+{
+  uint32_t ITEnabled;
+} DMA_HandleTypeDef;
+
+#define DMA_IT_HT                           (0x1UL << 9U)
+
+#define __HAL_DMA_DISABLE_IT( __HANDLE__, __INTERRUPT__ )  ((__HANDLE__)->ITEnabled &= ~(__INTERRUPT__))
+
+typedef struct __UART_HandleTypeDef
+{
+  DMA_HandleTypeDef                  *hdmatx;
+  DMA_HandleTypeDef                  *hdmarx;
+  __IO HAL_UART_StateTypeDef         gState;
+  __IO HAL_UART_StateTypeDef         RxState;
+  __IO uint32_t                      ErrorCode;
+  void ( *TxCpltCallback ) ( struct __UART_HandleTypeDef *huart );
+  void ( *ErrorCallback ) ( struct __UART_HandleTypeDef *huart );
+  void ( *RxEventCallback ) ( struct __UART_HandleTypeDef *huart, uint16_t Pos );
+} UART_HandleTypeDef;
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA (UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA (UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+
+#endif /* STM32WBAXX_HAL_H */
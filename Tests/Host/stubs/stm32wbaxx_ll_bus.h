@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_ll_bus.h
+  * @brief   Host stub of the LL bus and RCC drivers for the host tests
+  ******************************************************************************
+  * The peripheral clocks are always running on the host: the RCC functions,
+  * which the drivers get from stm32wbaxx_ll_rcc.h through the application
+  * headers on the target, do nothing.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_LL_BUS_H
+#define STM32WBAXX_LL_BUS_H
+
+#include "stm32wbaxx.h"
+
+#define LL_AHB2_GRP1_PERIPH_RNG                 RCC_AHB2ENR_RNGEN
+#define LL_RCC_RNG_CLKSOURCE_HSI                ( 0x2UL << 12U )
+
+static inline void LL_AHB2_GRP1_EnableClock (uint32_t Periphs)
+{
+  (void)Periphs;
+}
+
+static inline void LL_AHB2_GRP1_DisableClock (uint32_t Periphs)
+{
+  (void)Periphs;
+}
+
+static inline void LL_RCC_HSI_Enable (void)
+{
+}
+
+static inline uint32_t LL_RCC_HSI_IsReady (void)
+{
+  return 1UL;
+}
+
+static inline void LL_RCC_SetRNGClockSource (uint32_t RNGxSource)
+{
+  (void)RNGxSource;
+}
+
+#endif /* STM32WBAXX_LL_BUS_H */
@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_ll_rng.h
+  * @brief   Host stub of the LL RNG driver for the host tests
+  ******************************************************************************
+  * The functions access the registers of the RNG model as the LL driver does,
+  * except the read of the data register, which pops a word from the model: it
+  * is implemented by the test.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_LL_RNG_H
+#define STM32WBAXX_LL_RNG_H
+
+#include "stm32wbaxx.h"
+
+static inline void LL_RNG_Enable (RNG_TypeDef *RNGx)
+{
+  SET_BIT (RNGx->CR, RNG_CR_RNGEN);
+}
+
+static inline void LL_RNG_Disable (RNG_TypeDef *RNGx)
+{
+  CLEAR_BIT (RNGx->CR, RNG_CR_RNGEN);
+}
+
+static inline uint32_t LL_RNG_IsEnabled (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->CR, RNG_CR_RNGEN) == RNG_CR_RNGEN) ? 1UL : 0UL);
+}
+
+static inline void LL_RNG_DisableCondReset (RNG_TypeDef *RNGx)
+{
+  CLEAR_BIT (RNGx->CR, RNG_CR_CONDRST);
+}
+
+static inline uint32_t LL_RNG_IsEnabledCondReset (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->CR, RNG_CR_CONDRST) == RNG_CR_CONDRST) ? 1UL : 0UL);
+}
+
+static inline void LL_RNG_DisableClkErrorDetect (RNG_TypeDef *RNGx)
+{
+  SET_BIT (RNGx->CR, RNG_CR_CED);
+}
+
+static inline void LL_RNG_EnableIT (RNG_TypeDef *RNGx)
+{
+  SET_BIT (RNGx->CR, RNG_CR_IE);
+}
+
+static inline void LL_RNG_DisableIT (RNG_TypeDef *RNGx)
+{
+  CLEAR_BIT (RNGx->CR, RNG_CR_IE);
+}
+
+static inline uint32_t LL_RNG_IsEnabledIT (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->CR, RNG_CR_IE) == RNG_CR_IE) ? 1UL : 0UL);
+}
+
+static inline uint32_t LL_RNG_IsActiveFlag_DRDY (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->SR, RNG_SR_DRDY) == RNG_SR_DRDY) ? 1UL : 0UL);
+}
+
+static inline uint32_t LL_RNG_IsActiveFlag_CECS (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->SR, RNG_SR_CECS) == RNG_SR_CECS) ? 1UL : 0UL);
+}
+
+static inline uint32_t LL_RNG_IsActiveFlag_SEIS (const RNG_TypeDef *RNGx)
+{
+  return ((READ_BIT (RNGx->SR, RNG_SR_SEIS) == RNG_SR_SEIS) ? 1UL : 0UL);
+}
+
+static inline void LL_RNG_ClearFlag_CEIS (RNG_TypeDef *RNGx)
+{
+  CLEAR_BIT (RNGx->SR, RNG_SR_CEIS);
+}
+
+static inline void LL_RNG_ClearFlag_SEIS (RNG_TypeDef *RNGx)
+{
+  CLEAR_BIT (RNGx->SR, RNG_SR_SEIS);
+}
+
+static inline void LL_RNG_SetHealthConfig (RNG_TypeDef *RNGx, uint32_t Config)
+{
+  WRITE_REG (RNGx->HTCR, Config);
+}
+
+uint32_t LL_RNG_ReadRandData32 (RNG_TypeDef *RNGx);
+
+#endif /* STM32WBAXX_LL_RNG_H */
@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    stm32wbaxx_nucleo.h
+  * @brief   Host stub of the Nucleo board support for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef STM32WBAXX_NUCLEO_H
+#define STM32WBAXX_NUCLEO_H
+
+#include <stdint.h>
+
+typedef enum
+{
+  LED_BLUE  = 0,
+  LED_GREEN = 1,
+  LED_RED   = 2,
+  LEDn
+} Led_TypeDef;
+
+typedef enum
+{
+  B1 = 0,
+  B2 = 1,
+  B3 = 2,
+  BUTTONn
+} Button_TypeDef;
+
+typedef enum
+{
+  BUTTON_MODE_GPIO = 0,
+  BUTTON_MODE_EXTI = 1
+} ButtonMode_TypeDef;
+
+/* Implemented by the test, on its simulated buttons */
+int32_t BSP_LED_Init (Led_TypeDef Led);
+int32_t BSP_PB_Init (Button_TypeDef Button, ButtonMode_TypeDef ButtonMode);
+int32_t BSP_PB_GetState (Button_TypeDef Button);
+
+#endif /* STM32WBAXX_NUCLEO_H */
@@ -0,0 +1,25 @@
+/**
+  ******************************************************************************
+  * @file    timers.h
+  * @brief   Host stub of the FreeRTOS software timers for the host tests
+  ******************************************************************************
+  * The software timer functions used by the drivers. They are implemented by
+  * the test.
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TIMERS_H
+#define TIMERS_H
+
+#include "FreeRTOS.h"
+
+typedef void * TimerHandle_t;
+typedef void ( *TimerCallbackFunction_t ) ( TimerHandle_t xTimer );
+
+TimerHandle_t xTimerCreate (const char * const pcTimerName, const TickType_t xTimerPeriodInTicks,
+                            const BaseType_t xAutoReload, void * const pvTimerID,
+                            TimerCallbackFunction_t pxCallbackFunction);
+BaseType_t xTimerReset (TimerHandle_t xTimer, TickType_t xTicksToWait);
+
+#endif /* TIMERS_H */
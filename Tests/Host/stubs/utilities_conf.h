@@ -0,0 +1,34 @@
+/**
+  ******************************************************************************
+  * @file    utilities_conf.h
+  * @brief   Host stub of the utilities configuration for the host tests
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTILITIES_CONF_H
+#define UTILITIES_CONF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cmsis_compiler.h"
+
+#define UTIL_PLACE_IN_SECTION( __x__ )
+
+/* The tests are single threaded, the critical sections are empty. A test can define
+   UTIL_TEST_CRITICAL_SECTION_HOOK() to run an interrupt like action right before one is entered */
+#ifndef UTIL_TEST_CRITICAL_SECTION_HOOK
+#define UTIL_TEST_CRITICAL_SECTION_HOOK( )
+#endif /* UTIL_TEST_CRITICAL_SECTION_HOOK */
+
+#define UTILS_INIT_CRITICAL_SECTION( )
+#define UTILS_ENTER_CRITICAL_SECTION( )      UTIL_TEST_CRITICAL_SECTION_HOOK (); \
+                                             uint32_t primask_bit = 0U; (void)primask_bit
+#define UTILS_EXIT_CRITICAL_SECTION( )
+
+#define UTIL_SEQ_INIT_CRITICAL_SECTION( )    UTILS_INIT_CRITICAL_SECTION( )
+#define UTIL_SEQ_ENTER_CRITICAL_SECTION( )   UTILS_ENTER_CRITICAL_SECTION( )
+#define UTIL_SEQ_EXIT_CRITICAL_SECTION( )    UTILS_EXIT_CRITICAL_SECTION( )
+
+#endif /* UTILITIES_CONF_H */
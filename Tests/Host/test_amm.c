@@ -0,0 +1,391 @@
+/**
+  ******************************************************************************
+  * @file    test_amm.c
+  * @brief   Host test of the advanced memory manager slab cache and retry
+  ******************************************************************************
+  * The advanced memory manager runs on top of the stm32_mm allocator, through
+  * a Basic Memory Manager wrapper that counts the live allocations and can be
+  * made to fail. Checked:
+  *  - allocations up to the cache object size are served by the slab cache
+  *    without changing the occupation, and fall back to the pool once the
+  *    cache is empty,
+  *  - a pending callback is only invoked once a release makes its request fit,
+  *  - a request waiting on an empty cache is woken by a release to the cache,
+  *    also when the release interrupts the request between its cache lookup
+  *    and its registration,
+  *  - a failing cache creation gives back everything taken at initialization.
+  *
+  * The module is included so that its private state can be checked.
+  ******************************************************************************
+  */
+
+static void criticalSectionHook (void);
+
+#define UTIL_TEST_CRITICAL_SECTION_HOOK( )  criticalSectionHook ()
+
+#include "advanced_memory_manager.c"
+
+#include "stm32_mm.h"
+
+#include <stdio.h>
+
+#define POOL_SIZE       1024U
+
+#define VM_CACHED_ID    1U
+#define VM_PLAIN_ID     2U
+#define VM_SECOND_ID    3U
+
+#define CACHE_OBJECT_SIZE     4U
+#define CACHE_OBJECT_NUMBER   8U
+#define CACHED_VM_SIZE        200U
+
+static uint32_t Pool[POOL_SIZE];
+
+/* Basic Memory Manager wrapper state */
+static uint32_t BmmLiveNumber;
+static uint32_t BmmAllocateNumber;
+static uint32_t BmmFailingAllocate;
+
+static uint32_t ProcessRequestNumber;
+
+/* Release done as from an interrupt before the given critical section entry */
+static uint32_t HookEntryNumber;
+static uint32_t * p_HookRelease;
+
+static uint32_t failures;
+
+static void check (const uint8_t Condition, const char * const p_Text)
+{
+  if (Condition == FALSE)
+  {
+    printf ("%s\n", p_Text);
+    failures++;
+  }
+}
+
+static void bmmInit (uint32_t * const p_PoolAddr, const uint32_t PoolSize)
+{
+  BmmLiveNumber = 0U;
+  BmmAllocateNumber = 0U;
+
+  UTIL_MM_Init ((uint8_t *)p_PoolAddr, ((size_t)PoolSize * sizeof (uint32_t)));
+}
+
+static uint32_t * bmmAllocate (const uint32_t BufferSize)
+{
+  uint32_t * p_Buffer = NULL;
+
+  BmmAllocateNumber++;
+
+  if (BmmAllocateNumber != BmmFailingAllocate)
+  {
+    p_Buffer = UTIL_MM_GetBuffer ((size_t)BufferSize * sizeof (uint32_t));
+  }
+
+  if (p_Buffer != NULL)
+  {
+    BmmLiveNumber++;
+  }
+
+  return p_Buffer;
+}
+
+static void bmmFree (uint32_t * const p_BufferAddr)
+{
+  BmmLiveNumber--;
+
+  UTIL_MM_ReleaseBuffer (p_BufferAddr);
+}
+
+void AMM_RegisterBasicMemoryManager (AMM_BasicMemoryManagerFunctions_t * const p_BasicMemoryManagerFunctions)
+{
+  p_BasicMemoryManagerFunctions->Init = bmmInit;
+  p_BasicMemoryManagerFunctions->Allocate = bmmAllocate;
+  p_BasicMemoryManagerFunctions->Free = bmmFree;
+}
+
+static void criticalSectionHook (void)
+{
+  if ((HookEntryNumber != 0U) && (--HookEntryNumber == 0U))
+  {
+    check (AMM_Free (p_HookRelease) == AMM_ERROR_OK, "interrupting release failed");
+  }
+}
+
+void AMM_ProcessRequest (void)
+{
+  ProcessRequestNumber++;
+}
+
+/* Retry callbacks */
+static uint32_t SharedRetryNumber;
+static uint32_t CachedRetryNumber;
+static AMM_Function_Error_t CachedRetryError;
+static uint32_t * p_CachedRetryBuffer;
+
+static void sharedRetry (void)
+{
+  SharedRetryNumber++;
+}
+
+static void cachedRetry (void)
+{
+  CachedRetryNumber++;
+  CachedRetryError = AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE - 1U, &p_CachedRetryBuffer, NULL);
+}
+
+static AMM_VirtualMemoryCallbackFunction_t SharedRetryCallback = { .Callback = sharedRetry };
+static AMM_VirtualMemoryCallbackFunction_t CachedRetryCallback = { .Callback = cachedRetry };
+
+static uint8_t isInCache (const uint32_t * const p_Buffer)
+{
+  VirtualMemoryInfo_t * p_VirtualMemory = getVirtualMemory (VM_CACHED_ID);
+
+  return ((p_Buffer - VIRTUAL_MEMORY_HEADER_SIZE) >= p_VirtualMemory->p_CacheStart)
+         && ((p_Buffer - VIRTUAL_MEMORY_HEADER_SIZE) < p_VirtualMemory->p_CacheEnd);
+}
+
+static uint32_t sharedAvailable (void)
+{
+  return AmmPoolSize - AmmOccupiedSharedPoolSize - AmmRequiredVirtualMemorySize;
+}
+
+static void testCache (void)
+{
+  uint32_t * p_Object[CACHE_OBJECT_NUMBER];
+  uint32_t * p_Buffer = NULL;
+  uint32_t * p_Again = NULL;
+  uint32_t occupation = GetCurrentOccupation (VM_CACHED_ID);
+
+  check (occupation == (CACHE_OBJECT_NUMBER * (CACHE_OBJECT_SIZE + VIRTUAL_MEMORY_HEADER_SIZE)),
+         "cache not accounted in the virtual memory occupation");
+
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE - (objIdx % 2U), &p_Object[objIdx], NULL) == AMM_ERROR_OK,
+           "cache sized allocation failed");
+    check (isInCache (p_Object[objIdx]), "cache sized allocation not served by the cache");
+  }
+
+  check (GetCurrentOccupation (VM_CACHED_ID) == occupation, "cache allocation changed the occupation");
+
+  /* The cache is empty, the next one comes from the pool */
+  check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE, &p_Buffer, NULL) == AMM_ERROR_OK,
+         "allocation on an empty cache failed");
+  check (isInCache (p_Buffer) == FALSE, "allocation on an empty cache not served by the pool");
+  check (GetCurrentOccupation (VM_CACHED_ID) == (occupation + CACHE_OBJECT_SIZE + VIRTUAL_MEMORY_HEADER_SIZE),
+         "pool fallback not accounted");
+
+  /* Larger than the objects, it never goes to the cache */
+  check (AMM_Free (p_Buffer) == AMM_ERROR_OK, "pool fallback release failed");
+  check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE + 1U, &p_Buffer, NULL) == AMM_ERROR_OK,
+         "larger allocation failed");
+  check (isInCache (p_Buffer) == FALSE, "larger allocation served by the cache");
+  check (AMM_Free (p_Buffer) == AMM_ERROR_OK, "larger allocation release failed");
+
+  /* A released object is the next one served */
+  check (AMM_Free (p_Object[3]) == AMM_ERROR_OK, "cache object release failed");
+  check (AMM_Alloc (VM_CACHED_ID, 1U, &p_Again, NULL) == AMM_ERROR_OK, "cache reallocation failed");
+  check (p_Again == p_Object[3], "released cache object not reused");
+  p_Object[3] = p_Again;
+
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Free (p_Object[objIdx]) == AMM_ERROR_OK, "cache object release failed");
+  }
+
+  check (GetCurrentOccupation (VM_CACHED_ID) == occupation, "cache release changed the occupation");
+}
+
+static void testSharedRetry (void)
+{
+  uint32_t * p_Large = NULL;
+  uint32_t * p_Small = NULL;
+  uint32_t * p_Other = NULL;
+  uint32_t * p_Medium = NULL;
+  uint32_t * p_Buffer = NULL;
+  uint32_t occupation = AmmOccupiedSharedPoolSize;
+  uint32_t requestSize;
+
+  /* Leave 11 words of the shared pool available */
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, sharedAvailable () - 30U, &p_Large, NULL) == AMM_ERROR_OK,
+         "large shared allocation failed");
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, 3U, &p_Small, NULL) == AMM_ERROR_OK, "small shared allocation failed");
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, 3U, &p_Other, NULL) == AMM_ERROR_OK, "small shared allocation failed");
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, 9U, &p_Medium, NULL) == AMM_ERROR_OK, "medium shared allocation failed");
+
+  requestSize = sharedAvailable () + 4U;
+
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, requestSize, &p_Buffer, &SharedRetryCallback) == AMM_ERROR_BAD_ALLOCATION_SIZE,
+         "oversized shared allocation not refused");
+  check ((SharedRetryCallback.VirtualMemoryId == AMM_NO_VIRTUAL_ID) && (SharedRetryCallback.BufferSize == requestSize),
+         "refused request not recorded in the callback");
+
+  /* Releasing 4 words is not enough for the request */
+  check (AMM_Free (p_Small) == AMM_ERROR_OK, "small shared release failed");
+  AMM_BackgroundProcess ();
+  check (SharedRetryNumber == 0U, "callback invoked while its request still does not fit");
+  check (LST_is_empty (&AmmPendingCallback) == FALSE, "callback no longer pending");
+
+  /* Releasing 10 more words is */
+  check (AMM_Free (p_Medium) == AMM_ERROR_OK, "medium shared release failed");
+  AMM_BackgroundProcess ();
+  check (SharedRetryNumber == 1U, "callback not invoked once its request fits");
+  check (LST_is_empty (&AmmPendingCallback) != FALSE, "callback still pending");
+
+  check (AMM_Free (p_Other) == AMM_ERROR_OK, "small shared release failed");
+  check (AMM_Free (p_Large) == AMM_ERROR_OK, "large shared release failed");
+  AMM_BackgroundProcess ();
+  check (SharedRetryNumber == 1U, "callback invoked more than once");
+
+  check (AmmOccupiedSharedPoolSize == occupation, "shared occupation not restored");
+}
+
+static void testCacheRetry (void)
+{
+  uint32_t * p_Object[CACHE_OBJECT_NUMBER];
+  uint32_t * p_Plain = NULL;
+  uint32_t * p_Budget = NULL;
+  uint32_t * p_Shared = NULL;
+  uint32_t * p_Buffer = NULL;
+  uint32_t processRequestNumber;
+
+  /* Taken from the reservation of the other virtual memory */
+  check (AMM_Alloc (VM_PLAIN_ID, 9U, &p_Plain, NULL) == AMM_ERROR_OK, "plain virtual memory allocation failed");
+
+  /* Empty the cache, then consume the whole virtual memory and the shared pool */
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE, &p_Object[objIdx], NULL) == AMM_ERROR_OK,
+           "cache sized allocation failed");
+  }
+
+  check (AMM_Alloc (VM_CACHED_ID,
+                    CACHED_VM_SIZE - GetCurrentOccupation (VM_CACHED_ID) - VIRTUAL_MEMORY_HEADER_SIZE,
+                    &p_Budget, NULL) == AMM_ERROR_OK,
+         "virtual memory budget allocation failed");
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, sharedAvailable () - 2U, &p_Shared, NULL) == AMM_ERROR_OK,
+         "shared pool allocation failed");
+
+  check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE - 1U, &p_Buffer, &CachedRetryCallback) == AMM_ERROR_BAD_ALLOCATION_SIZE,
+         "allocation without memory left not refused");
+
+  /* A release within the reservation of another virtual memory does not make it fit */
+  check (AMM_Free (p_Plain) == AMM_ERROR_OK, "plain virtual memory release failed");
+  AMM_BackgroundProcess ();
+  check (CachedRetryNumber == 0U, "callback invoked without memory left");
+
+  /* A release to the empty cache wakes the request up, the retry gets the object */
+  processRequestNumber = ProcessRequestNumber;
+  check (AMM_Free (p_Object[5]) == AMM_ERROR_OK, "cache object release failed");
+  check (ProcessRequestNumber == (processRequestNumber + 1U), "cache release did not request a background process");
+  AMM_BackgroundProcess ();
+  check (CachedRetryNumber == 1U, "callback not invoked by the cache release");
+  check ((CachedRetryError == AMM_ERROR_OK) && (p_CachedRetryBuffer == p_Object[5]),
+         "retry not served by the released cache object");
+  p_Object[5] = p_CachedRetryBuffer;
+
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Free (p_Object[objIdx]) == AMM_ERROR_OK, "cache object release failed");
+  }
+
+  check (AMM_Free (p_Budget) == AMM_ERROR_OK, "virtual memory budget release failed");
+  check (AMM_Free (p_Shared) == AMM_ERROR_OK, "shared pool release failed");
+  AMM_BackgroundProcess ();
+  check (CachedRetryNumber == 1U, "callback invoked more than once");
+}
+
+static void testCacheReleaseRace (void)
+{
+  uint32_t * p_Object[CACHE_OBJECT_NUMBER];
+  uint32_t * p_Budget = NULL;
+  uint32_t * p_Shared = NULL;
+  uint32_t * p_Buffer = NULL;
+  uint32_t cachedRetryNumber = CachedRetryNumber;
+
+  /* Empty the cache, then consume the whole virtual memory and the shared pool */
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE, &p_Object[objIdx], NULL) == AMM_ERROR_OK,
+           "cache sized allocation failed");
+  }
+
+  check (AMM_Alloc (VM_CACHED_ID,
+                    CACHED_VM_SIZE - GetCurrentOccupation (VM_CACHED_ID) - VIRTUAL_MEMORY_HEADER_SIZE,
+                    &p_Budget, NULL) == AMM_ERROR_OK,
+         "virtual memory budget allocation failed");
+  check (AMM_Alloc (AMM_NO_VIRTUAL_ID, sharedAvailable () - 2U, &p_Shared, NULL) == AMM_ERROR_OK,
+         "shared pool allocation failed");
+
+  /* A cache object is released once the request found the cache empty, right before the critical section
+     registering it: the request either gets the object or is woken up */
+  HookEntryNumber = 2U;
+  p_HookRelease = p_Object[2];
+
+  if (AMM_Alloc (VM_CACHED_ID, CACHE_OBJECT_SIZE, &p_Buffer, &CachedRetryCallback) == AMM_ERROR_OK)
+  {
+    check (p_Buffer == p_Object[2], "request not served by the object released meanwhile");
+  }
+  else
+  {
+    AMM_BackgroundProcess ();
+    check (CachedRetryNumber == (cachedRetryNumber + 1U), "request not woken by the release done meanwhile");
+    check (CachedRetryError == AMM_ERROR_OK, "retry not served by the object released meanwhile");
+    p_Buffer = p_CachedRetryBuffer;
+  }
+
+  check (HookEntryNumber == 0U, "interrupting release not done");
+  check (LST_is_empty (&AmmPendingCallback) != FALSE, "request left pending");
+  p_Object[2] = p_Buffer;
+
+  for (uint32_t objIdx = 0U; objIdx < CACHE_OBJECT_NUMBER; objIdx++)
+  {
+    check (AMM_Free (p_Object[objIdx]) == AMM_ERROR_OK, "cache object release failed");
+  }
+
+  check (AMM_Free (p_Budget) == AMM_ERROR_OK, "virtual memory budget release failed");
+  check (AMM_Free (p_Shared) == AMM_ERROR_OK, "shared pool release failed");
+}
+
+int main (void)
+{
+  AMM_VirtualMemoryConfig_t config[] =
+  {
+    { VM_CACHED_ID, CACHED_VM_SIZE, CACHE_OBJECT_SIZE, CACHE_OBJECT_NUMBER },
+    { VM_PLAIN_ID, 300U, 0U, 0U },
+  };
+  AMM_VirtualMemoryConfig_t failingConfig[] =
+  {
+    { VM_CACHED_ID, CACHED_VM_SIZE, CACHE_OBJECT_SIZE, CACHE_OBJECT_NUMBER },
+    { VM_SECOND_ID, 100U, 2U, 10U },
+  };
+  AMM_InitParameters_t initParams = { Pool, POOL_SIZE, 2U, config };
+
+  check (AMM_Init (&initParams) == AMM_ERROR_OK, "init failed");
+
+  testCache ();
+  testSharedRetry ();
+  testCacheRetry ();
+  testCacheReleaseRace ();
+
+  check (BmmLiveNumber == 2U, "allocations left after the releases");
+  check (AMM_DeInit () == AMM_ERROR_OK, "deinit failed");
+  check (BmmLiveNumber == 0U, "allocations left after deinit");
+
+  /* The second cache creation fails: the list and the first cache are given back */
+  initParams.p_VirtualMemoryConfigList = failingConfig;
+  BmmFailingAllocate = 3U;
+  check (AMM_Init (&initParams) == AMM_ERROR_BAD_BMM_ALLOCATION, "failing cache creation not reported");
+  check (BmmLiveNumber == 0U, "allocations left after a failing init");
+  check ((p_AmmVirtualMemoryList == NULL) && (AmmVirtualMemoryNumber == 0U), "virtual memories left after a failing init");
+
+  BmmFailingAllocate = 0U;
+  check (AMM_Init (&initParams) == AMM_ERROR_OK, "init after a failing init failed");
+  check (BmmLiveNumber == 3U, "init did not create both caches");
+  check (AMM_DeInit () == AMM_ERROR_OK, "deinit failed");
+
+  printf ("test_amm: %s (%u failures)\n", (failures == 0U) ? "PASS" : "FAIL", failures);
+
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,398 @@
+/**
+  ******************************************************************************
+  * @file    test_app_bsp.c
+  * @brief   Host test of the button debouncing and of the BSP input dispatch
+  ******************************************************************************
+  * The buttons of the Nucleo board on FreeRTOS are pressed on a simulated clock,
+  * with contact bounces raising several EXTI falling edges at the press and at
+  * the release. Checked:
+  *  - each press posts exactly one event of its button to the input queue,
+  *    flagged 'long' when held past the threshold,
+  *  - the event of a short press is posted within a sampling period of the
+  *    release, the one of a long press at the threshold,
+  *  - the bounces of the release do not post a second event,
+  *  - one task and one queue serve all the buttons, and the handlers can be
+  *    replaced at run time.
+  *
+  * The module is included so that its private state can be checked.
+  ******************************************************************************
+  */
+
+#include "app_bsp.c"
+
+#include <stdio.h>
+
+#define MAX_TIMERS          4U
+#define MAX_BOUNCES         5U
+#define BOUNCE_SPAN_MS      10U   /* Bounces settle within this time after an edge. */
+#define RANDOM_PRESS_NUMBER 2000U
+
+/* Simulated clock, buttons and timers */
+static uint32_t Now;
+static uint32_t ButtonPressedUntil[BUTTONn];
+static uint32_t ButtonPressedFrom[BUTTONn];
+static UTIL_TIMER_Object_t * p_Timers[MAX_TIMERS];
+static uint32_t TimerNumber;
+
+/* Simulated RTOS */
+static BspInputEvent_t QueueEvents[BSP_INPUT_QUEUE_SIZE];
+static uint32_t QueueEventNumber;
+static uint32_t QueueCapacity;
+static uint32_t QueueMessageSize;
+static uint32_t QueueNumber;
+static uint32_t ThreadNumber;
+static uint32_t ThreadStackSize;
+
+static uint32_t CustomActionNumber;
+static uint32_t RandomState = 0x2545F491U;
+
+static uint32_t failures;
+
+static void check (const uint8_t Condition, const char * const p_Text)
+{
+  if (Condition == 0U)
+  {
+    printf ("%s\n", p_Text);
+    failures++;
+  }
+}
+
+static uint32_t nextRandom (void)
+{
+  RandomState ^= RandomState << 13;
+  RandomState ^= RandomState >> 17;
+  RandomState ^= RandomState << 5;
+
+  return RandomState;
+}
+
+uint32_t HAL_GetTick (void)
+{
+  return Now;
+}
+
+int32_t BSP_LED_Init (Led_TypeDef Led)
+{
+  UNUSED (Led);
+  return 0;
+}
+
+int32_t BSP_PB_Init (Button_TypeDef Button, ButtonMode_TypeDef ButtonMode)
+{
+  UNUSED (Button);
+  UNUSED (ButtonMode);
+  return 0;
+}
+
+int32_t BSP_PB_GetState (Button_TypeDef Button)
+{
+  return ((Now >= ButtonPressedFrom[Button]) && (Now < ButtonPressedUntil[Button])) ? 1 : 0;
+}
+
+UTIL_TIMER_Status_t UTIL_TIMER_Create (UTIL_TIMER_Object_t *TimerObject, uint32_t PeriodValue, UTIL_TIMER_Mode_t Mode,
+                                       void ( *Callback )( void *), void *Argument)
+{
+  memset (TimerObject, 0, sizeof (*TimerObject));
+  TimerObject->ReloadValue = PeriodValue;
+  TimerObject->Mode = Mode;
+  TimerObject->Callback = Callback;
+  TimerObject->argument = Argument;
+
+  if (TimerNumber < MAX_TIMERS)
+  {
+    p_Timers[TimerNumber++] = TimerObject;
+  }
+
+  return UTIL_TIMER_OK;
+}
+
+UTIL_TIMER_Status_t UTIL_TIMER_StartWithPeriod (UTIL_TIMER_Object_t *TimerObject, uint32_t PeriodValue)
+{
+  TimerObject->ReloadValue = PeriodValue;
+  TimerObject->Timestamp = Now + PeriodValue;
+  TimerObject->IsRunning = 1U;
+
+  return UTIL_TIMER_OK;
+}
+
+UTIL_TIMER_Status_t UTIL_TIMER_Stop (UTIL_TIMER_Object_t *TimerObject)
+{
+  TimerObject->IsRunning = 0U;
+
+  return UTIL_TIMER_OK;
+}
+
+uint32_t UTIL_TIMER_IsRunning (UTIL_TIMER_Object_t *TimerObject)
+{
+  return TimerObject->IsRunning;
+}
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  UNUSED (func);
+  UNUSED (argument);
+
+  ThreadNumber++;
+  ThreadStackSize += attr->stack_size;
+
+  return &ThreadNumber;
+}
+
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+{
+  UNUSED (attr);
+
+  QueueNumber++;
+  QueueCapacity = msg_count;
+  QueueMessageSize = msg_size;
+
+  return QueueEvents;
+}
+
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+  osStatus_t status = osErrorResource;
+
+  UNUSED (mq_id);
+  UNUSED (msg_prio);
+
+  /* Posted from EXTI or timer context, the post never waits */
+  check (timeout == 0U, "blocking post to the input queue");
+
+  if (QueueEventNumber < QueueCapacity)
+  {
+    memcpy (&QueueEvents[QueueEventNumber++], msg_ptr, sizeof (BspInputEvent_t));
+    status = osOK;
+  }
+
+  return status;
+}
+
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+  osStatus_t status = osErrorResource;
+
+  UNUSED (mq_id);
+  UNUSED (msg_prio);
+  UNUSED (timeout);
+
+  if (QueueEventNumber != 0U)
+  {
+    memcpy (msg_ptr, &QueueEvents[0], sizeof (BspInputEvent_t));
+    memmove (&QueueEvents[0], &QueueEvents[1], (QueueEventNumber - 1U) * sizeof (BspInputEvent_t));
+    QueueEventNumber--;
+    status = osOK;
+  }
+
+  return status;
+}
+
+static void customAction (void)
+{
+  CustomActionNumber++;
+}
+
+/* Runs the clock up to the given tick, expiring the timers on the way */
+static void advanceTo (const uint32_t Tick)
+{
+  while (Now < Tick)
+  {
+    Now++;
+
+    for (uint32_t timerIdx = 0U; timerIdx < TimerNumber; timerIdx++)
+    {
+      UTIL_TIMER_Object_t * p_Timer = p_Timers[timerIdx];
+
+      if ((p_Timer->IsRunning != 0U) && (p_Timer->Timestamp == Now))
+      {
+        p_Timer->Timestamp += p_Timer->ReloadValue;
+        p_Timer->Callback (p_Timer->argument);
+      }
+    }
+  }
+}
+
+/*
+ * Presses a button for the given duration. Each contact bounce of the press
+ * and of the release raises an EXTI falling edge, the contact being closed
+ * again for an instant.
+ */
+static void press (const Button_TypeDef Button, const uint32_t Duration, const uint32_t BounceNumber)
+{
+  uint32_t pressTick = Now;
+  uint32_t releaseTick = Now + Duration;
+
+  ButtonPressedFrom[Button] = pressTick;
+  ButtonPressedUntil[Button] = releaseTick;
+  BSP_PB_Callback (Button);
+
+  for (uint32_t bounceIdx = 0U; bounceIdx < BounceNumber; bounceIdx++)
+  {
+    advanceTo (pressTick + 1U + ((bounceIdx * BOUNCE_SPAN_MS) / MAX_BOUNCES));
+    BSP_PB_Callback (Button);
+  }
+
+  advanceTo (releaseTick);
+
+  for (uint32_t bounceIdx = 0U; bounceIdx < BounceNumber; bounceIdx++)
+  {
+    advanceTo (releaseTick + 1U + ((bounceIdx * BOUNCE_SPAN_MS) / MAX_BOUNCES));
+    BSP_PB_Callback (Button);
+  }
+}
+
+/* Checks that the press posted one event of its button, and returns its latency */
+static uint32_t checkOneEvent (const Button_TypeDef Button, const uint32_t PressTick, const uint8_t IsLong)
+{
+  BspInputEvent_t event;
+  uint32_t latency = 0U;
+
+  check (QueueEventNumber == 1U, "not one event per press");
+
+  if (osMessageQueueGet (BspInputQueue, &event, NULL, osWaitForever) == osOK)
+  {
+    check (event.inputId == (uint8_t)(APP_BSP_INPUT_B1 + Button), "event of another input");
+    latency = event.timestamp - PressTick;
+  }
+
+  check (APP_BSP_ButtonIsLongPressed (Button) == IsLong, "wrong long press status");
+  QueueEventNumber = 0U;
+
+  return latency;
+}
+
+static void testFootprint (void)
+{
+  check (ThreadNumber == 1U, "not one task for all the inputs");
+  check (ThreadStackSize == TASK_STACK_SIZE_BSP_INPUT, "wrong stack size of the input task");
+  check ((QueueNumber == 1U) && (QueueCapacity == BSP_INPUT_QUEUE_SIZE), "not one input queue");
+  check (QueueMessageSize == sizeof (BspInputEvent_t), "wrong event size");
+  check (TimerNumber == BUTTON_NB_MAX, "not one sampling timer per button");
+
+  printf ("RAM of the inputs: %u task, %u bytes of stack, %u bytes of queue, %u bytes of button descriptors "
+          "(%u bytes of stack with a task per button)\n",
+          (unsigned)ThreadNumber, (unsigned)ThreadStackSize, (unsigned)(QueueCapacity * QueueMessageSize),
+          (unsigned)sizeof (buttonDesc), (unsigned)(BUTTON_NB_MAX * TASK_STACK_SIZE_BUTTON_Bx));
+}
+
+static void testShortAndLongPress (void)
+{
+  static const uint32_t durationList[] = { 20U, 60U, 120U, 400U, 490U };
+  uint32_t pressTick;
+  uint32_t latency;
+
+  for (uint32_t durationIdx = 0U; durationIdx < (sizeof (durationList) / sizeof (durationList[0])); durationIdx++)
+  {
+    pressTick = Now;
+    press (B1, durationList[durationIdx], MAX_BOUNCES);
+    advanceTo (Now + 200U);
+
+    /* A short press is posted at the first sample after the release */
+    latency = checkOneEvent (B1, pressTick, 0U);
+    check (latency >= durationList[durationIdx], "short press posted before the release");
+    check (latency <= (durationList[durationIdx] + BOUNCE_SPAN_MS + BUTTON_LONG_PRESS_SAMPLE_MS),
+           "short press posted late");
+  }
+
+  /* A long press is posted at the threshold, the release posts nothing */
+  pressTick = Now;
+  press (B2, 2000U, MAX_BOUNCES);
+  advanceTo (Now + 200U);
+  latency = checkOneEvent (B2, pressTick, 1U);
+  check (latency == BUTTON_LONG_PRESS_THRESHOLD_MS, "long press not posted at the threshold");
+}
+
+static void testRandomPresses (void)
+{
+  uint32_t pressNumber[BUTTONn] = { 0U };
+  uint32_t maxShortLatency = 0U;
+  uint32_t maxLongLatency = 0U;
+
+  for (uint32_t pressIdx = 0U; pressIdx < RANDOM_PRESS_NUMBER; pressIdx++)
+  {
+    Button_TypeDef button = (Button_TypeDef)(nextRandom () % BUTTON_NB_MAX);
+    uint32_t duration = 20U + (nextRandom () % 1500U);
+    uint32_t pressTick;
+    uint32_t latency;
+    uint8_t isLong;
+
+    /* Out of the sample of the threshold, where both outcomes are right */
+    if ((duration >= (BUTTON_LONG_PRESS_THRESHOLD_MS - BOUNCE_SPAN_MS)) &&
+        (duration <= (BUTTON_LONG_PRESS_THRESHOLD_MS + BOUNCE_SPAN_MS)))
+    {
+      duration += 2U * BOUNCE_SPAN_MS;
+    }
+
+    isLong = (duration > BUTTON_LONG_PRESS_THRESHOLD_MS) ? 1U : 0U;
+    pressTick = Now;
+    press (button, duration, nextRandom () % (MAX_BOUNCES + 1U));
+
+    /* Idle until the next press, past the release sampling and the debounce time */
+    advanceTo (Now + BUTTON_LONG_PRESS_SAMPLE_MS + BUTTON_DEBOUNCE_MS + (nextRandom () % 500U));
+
+    latency = checkOneEvent (button, pressTick, isLong);
+    pressNumber[button]++;
+
+    if (isLong != 0U)
+    {
+      maxLongLatency = (latency > maxLongLatency) ? latency : maxLongLatency;
+    }
+    else
+    {
+      latency -= duration;
+      maxShortLatency = (latency > maxShortLatency) ? latency : maxShortLatency;
+    }
+  }
+
+  check (maxLongLatency == BUTTON_LONG_PRESS_THRESHOLD_MS, "long press not posted at the threshold");
+  check (maxShortLatency <= (BOUNCE_SPAN_MS + BUTTON_LONG_PRESS_SAMPLE_MS), "short press posted late");
+
+  printf ("%u random presses (B1 %u, B2 %u, B3 %u): short press posted at most %u ms after the release, "
+          "long press %u ms after the press\n",
+          (unsigned)RANDOM_PRESS_NUMBER, (unsigned)pressNumber[B1], (unsigned)pressNumber[B2],
+          (unsigned)pressNumber[B3], (unsigned)maxShortLatency, (unsigned)maxLongLatency);
+}
+
+static void testHandlers (void)
+{
+  BspInputEvent_t event;
+
+  check (BspInputHandlerTable[APP_BSP_INPUT_B1] == APP_BSP_Button1Action, "default handler of B1 not registered");
+  check (BspInputHandlerTable[APP_BSP_INPUT_B3] == APP_BSP_Button3Action, "default handler of B3 not registered");
+
+  APP_BSP_InputRegisterHandler (APP_BSP_INPUT_B2, customAction);
+  APP_BSP_InputRegisterHandler (APP_BSP_INPUT_NB, NULL);
+  check (BspInputHandlerTable[APP_BSP_INPUT_B2] == customAction, "handler of B2 not replaced");
+
+  /* The serial command posts the press of a button, as the button does */
+  check (APP_BSP_SerialCmdExecute ((uint8_t *)"B2L", 3U) == 1U, "serial command refused");
+  check (osMessageQueueGet (BspInputQueue, &event, NULL, osWaitForever) == osOK, "serial command not posted");
+  check (event.inputId == APP_BSP_INPUT_B2, "serial command posted another input");
+  BspInputHandlerTable[event.inputId] ();
+  check (CustomActionNumber == 1U, "replaced handler not called");
+  check (APP_BSP_ButtonIsLongPressed (B2) == 1U, "serial long press not flagged");
+
+  /* A full queue drops the events, the posting context never waits */
+  for (uint32_t eventIdx = 0U; eventIdx <= BSP_INPUT_QUEUE_SIZE; eventIdx++)
+  {
+    BspInput_Post (APP_BSP_INPUT_B1);
+  }
+
+  check (QueueEventNumber == BSP_INPUT_QUEUE_SIZE, "full queue not bounded");
+  QueueEventNumber = 0U;
+}
+
+int main (void)
+{
+  Now = 1000U;
+  APP_BSP_Init ();
+
+  testFootprint ();
+  testShortAndLongPress ();
+  testRandomPresses ();
+  testHandlers ();
+
+  printf ("test_app_bsp: %s (%u failures)\n", (failures == 0U) ? "PASS" : "FAIL", failures);
+
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,492 @@
+/**
+  ******************************************************************************
+  * @file    test_cli_uart.c
+  * @brief   Host test of the OpenThread CLI UART on a simulated UART
+  ******************************************************************************
+  * The UART sends a DMA transfer when the test completes it, from an interrupt,
+  * and receives the characters typed by the test in chunks ended by an idle
+  * line. The task blocked on the TX semaphore lets the UART run, unless it is
+  * stalled. Checked:
+  *  - the CLI outputs are sent whole and in order, "> " prompts excepted, the
+  *    TX segments chained from the TX complete interrupt, with the task only
+  *    waiting when the TX ring is full,
+  *  - a stalled UART, or no scheduler to wait on, drops the output that does
+  *    not fit and counts it, and the output resumes afterwards,
+  *  - a busy UART is retried from the task, an aborted segment is dropped,
+  *  - the commands typed in any chunking are given to OpenThread after their
+  *    echo, a command typed while the previous one is pending or too long is
+  *    dropped, and the next command is still read.
+  *
+  * The module is linked as built for the target, with its weak scheduling
+  * hook replaced by the one of the test.
+  ******************************************************************************
+  */
+
+#include "main.h"
+#include "platform_wba.h"
+#include "uart.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* As uart.c */
+#define CLI_TX_BUFFER_SIZE      2048U
+#define CLI_FORMAT_BUFFER_SIZE  1536U
+#define CLI_LINE_SIZE           256U
+
+#define OUTPUT_NUMBER       3000U
+#define SINK_SIZE           (4U * 1024U * 1024U)
+#define MAX_LINES           64U
+
+UART_HandleTypeDef huart1;
+os_mutex_id g_ll_lock;
+
+extern bool otUART_TX_Schdl;
+
+/* Simulated UART: the bytes sent, and the DMA transfer in flight */
+static DMA_HandleTypeDef UartDmaRx;
+static uint8_t * p_Sink;
+static uint32_t SinkSize;
+static const uint8_t * p_TxData;
+static uint16_t TxSize;
+static uint8_t UartStalled;
+static uint8_t UartOwnedElsewhere;
+static uint32_t TransmitCallNumber;
+static uint8_t * p_RxBuffer;
+static uint16_t RxBufferSize;
+
+/* Simulated RTOS */
+static uint8_t RtosUsed;
+static int32_t SemaphoreCount;
+static uint32_t SemaphoreWaitNumber;
+static uint32_t ScheduleNumber;
+
+/* Expected output, and the commands given to OpenThread */
+static uint8_t * p_Expected;
+static uint32_t ExpectedSize;
+static char Lines[MAX_LINES][CLI_LINE_SIZE + 1U];
+static uint32_t LineNumber;
+static uint8_t EchoSentFirst;
+
+static uint32_t RandomState = 0x6A09E667U;
+
+static uint32_t failures;
+
+static void check (const uint8_t Condition, const char * const p_Text)
+{
+  if (Condition == 0U)
+  {
+    printf ("%s\n", p_Text);
+    failures++;
+  }
+}
+
+static uint32_t nextRandom (void)
+{
+  RandomState ^= RandomState << 13;
+  RandomState ^= RandomState >> 17;
+  RandomState ^= RandomState << 5;
+
+  return RandomState;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA (UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size)
+{
+  TransmitCallNumber++;
+
+  if ((huart->gState != HAL_UART_STATE_READY) || (UartOwnedElsewhere != 0U))
+  {
+    return HAL_BUSY;
+  }
+
+  check ((Size != 0U) && (Size <= CLI_TX_BUFFER_SIZE), "transfer larger than the TX ring");
+
+  p_TxData = pData;
+  TxSize = Size;
+  huart->gState = HAL_UART_STATE_BUSY_TX;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA (UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  p_RxBuffer = pData;
+  RxBufferSize = Size;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  huart->hdmarx->ITEnabled |= DMA_IT_HT;
+
+  return HAL_OK;
+}
+
+/* The DMA transfer in flight ends: TX complete interrupt */
+static uint8_t uartComplete (void)
+{
+  if ((TxSize == 0U) || (UartStalled != 0U))
+  {
+    return FALSE;
+  }
+
+  check ((SinkSize + TxSize) <= SINK_SIZE, "sink full");
+  memcpy (&p_Sink[SinkSize], p_TxData, TxSize);
+  SinkSize += TxSize;
+  TxSize = 0U;
+  huart1.gState = HAL_UART_STATE_READY;
+  huart1.TxCpltCallback (&huart1);
+
+  return TRUE;
+}
+
+/* The characters are received in chunks, each ended by an idle line */
+static void uartType (const char * const p_Text)
+{
+  uint32_t size = (uint32_t)strlen (p_Text);
+
+  for (uint32_t index = 0U; index < size; )
+  {
+    uint32_t chunk = 1U + (nextRandom () % RxBufferSize);
+
+    if (chunk > (size - index))
+    {
+      chunk = size - index;
+    }
+
+    check (huart1.RxState == HAL_UART_STATE_BUSY_RX, "reception not running");
+    memcpy (p_RxBuffer, &p_Text[index], chunk);
+    index += chunk;
+    huart1.RxState = HAL_UART_STATE_READY;
+    huart1.RxEventCallback (&huart1, (uint16_t)chunk);
+  }
+}
+
+int32_t os_rcrsv_mutex_wait (os_mutex_id mutex_id, uint32_t millisec)
+{
+  UNUSED (mutex_id);
+  UNUSED (millisec);
+  return 0;
+}
+
+int32_t os_rcrsv_mutex_release (os_mutex_id mutex_id)
+{
+  UNUSED (mutex_id);
+  return 0;
+}
+
+uint8_t os_wrapper_is_rtos_used (void)
+{
+  return RtosUsed;
+}
+
+os_semaphore_id os_semaphore_create (int32_t max_count, int32_t initial_count)
+{
+  UNUSED (max_count);
+
+  SemaphoreCount = initial_count;
+  return &SemaphoreCount;
+}
+
+/* The task blocks: the UART runs until the semaphore is released, or the timeout */
+int32_t os_semaphore_wait (os_semaphore_id semaphore_id, uint32_t millisec)
+{
+  UNUSED (millisec);
+
+  check (semaphore_id == &SemaphoreCount, "wait on another semaphore");
+  SemaphoreWaitNumber++;
+
+  while ((SemaphoreCount == 0) && (uartComplete () != FALSE));
+
+  if (SemaphoreCount == 0)
+  {
+    return -1;
+  }
+
+  SemaphoreCount--;
+  return 0;
+}
+
+int32_t os_semaphore_release_isr (os_semaphore_id semaphore_id)
+{
+  UNUSED (semaphore_id);
+
+  SemaphoreCount = 1;
+  return 0;
+}
+
+void APP_THREAD_ScheduleUART (void)
+{
+  ScheduleNumber++;
+}
+
+void otPlatUartReceived (const uint8_t *aBuf, uint16_t aBufLength)
+{
+  /* The echo has been sent before the command is executed */
+  EchoSentFirst &= ((SinkSize >= aBufLength) && (memcmp (&p_Sink[SinkSize - aBufLength], aBuf, aBufLength) == 0));
+
+  if (LineNumber < MAX_LINES)
+  {
+    memcpy (Lines[LineNumber], aBuf, aBufLength);
+    Lines[LineNumber][aBufLength] = '\0';
+  }
+
+  LineNumber++;
+}
+
+static int cliOutput (const char * const p_Format, ...)
+{
+  va_list arguments;
+  int ret;
+
+  va_start (arguments, p_Format);
+  ret = CliUartOutput (NULL, p_Format, arguments);
+  va_end (arguments);
+
+  return ret;
+}
+
+static void expect (const char * const p_Text, const uint32_t Size)
+{
+  memcpy (&p_Expected[ExpectedSize], p_Text, Size);
+  ExpectedSize += Size;
+}
+
+/* The task scheduled by the driver */
+static void runTask (void)
+{
+  while (ScheduleNumber != 0U)
+  {
+    ScheduleNumber = 0U;
+    arcUartProcess ();
+  }
+}
+
+static void enable (const uint8_t Rtos)
+{
+  RtosUsed = Rtos;
+  SinkSize = 0U;
+  ExpectedSize = 0U;
+  TxSize = 0U;
+  UartStalled = FALSE;
+  UartOwnedElsewhere = FALSE;
+  LineNumber = 0U;
+  huart1.gState = HAL_UART_STATE_READY;
+  huart1.RxState = HAL_UART_STATE_READY;
+  huart1.hdmarx = &UartDmaRx;
+
+  check (otPlatUartEnable () == OT_ERROR_NONE, "enable failed");
+  check ((huart1.RxState == HAL_UART_STATE_BUSY_RX) && ((UartDmaRx.ITEnabled & DMA_IT_HT) == 0U),
+         "reception not started without the half transfer interrupt");
+}
+
+static void flush (void)
+{
+  check (otPlatUartFlush () == OT_ERROR_NONE, "flush failed");
+  /* Without scheduler, the flush does not wait: the UART sends the rest */
+  check ((TxSize == 0U) || (RtosUsed == FALSE), "TX ring not sent by the flush");
+
+  while (uartComplete () != FALSE);
+}
+
+static void testOutput (void)
+{
+  static char text[CLI_FORMAT_BUFFER_SIZE];
+  CliUartStats_t stats;
+  uint32_t waitNumber;
+
+  enable (TRUE);
+
+  for (uint32_t i = 0U; i < OUTPUT_NUMBER; i++)
+  {
+    uint32_t size = 1U + (nextRandom () % (CLI_FORMAT_BUFFER_SIZE - 1U));
+    uint32_t completions = nextRandom () % 4U;
+
+    for (uint32_t j = 0U; j < size; j++)
+    {
+      text[j] = (char)('a' + (nextRandom () % 26U));
+    }
+
+    text[size] = '\0';
+
+    if ((i % 50U) == 0U)
+    {
+      /* The prompt is not printed */
+      check (cliOutput ("> ") == 2, "prompt not accepted");
+    }
+
+    check (cliOutput ("%s", text) == (int)size, "output not accepted whole");
+    expect (text, size);
+
+    for (; completions != 0U; completions--)
+    {
+      (void)uartComplete ();
+    }
+
+    runTask ();
+  }
+
+  waitNumber = SemaphoreWaitNumber;
+  flush ();
+  CliUartGetStats (&stats);
+
+  check ((SinkSize == ExpectedSize) && (memcmp (p_Sink, p_Expected, SinkSize) == 0), "output not sent whole and in order");
+  check ((stats.tx_bytes == ExpectedSize) && (stats.tx_dropped_bytes == 0U), "TX counters wrong");
+  check (stats.tx_backpressure_count != 0U, "output never waited for the UART");
+  check (SemaphoreWaitNumber >= stats.tx_backpressure_count, "backpressure without a wait");
+
+  printf ("%u outputs of %u bytes: %u DMA transfers of %u bytes on average, %u outputs waited for the UART "
+          "(%u waits), %u bytes dropped\n", OUTPUT_NUMBER, ExpectedSize, stats.tx_dma_count,
+          ExpectedSize / stats.tx_dma_count, stats.tx_backpressure_count, waitNumber, stats.tx_dropped_bytes);
+}
+
+static void testStalledUart (const uint8_t Rtos)
+{
+  static char text[1000U];
+  CliUartStats_t stats;
+  uint32_t accepted = 0U;
+  uint32_t requested = 0U;
+  uint32_t waitNumber;
+
+  enable (Rtos);
+  memset (text, 'x', sizeof (text) - 1U);
+  UartStalled = TRUE;
+  waitNumber = SemaphoreWaitNumber;
+
+  /* The UART does not complete: the TX ring fills up, then the output is dropped */
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    int ret = cliOutput ("%s", text);
+
+    check ((ret >= 0) && (ret <= (int)(sizeof (text) - 1U)), "output accepted beyond the request");
+    accepted += (uint32_t)ret;
+    requested += sizeof (text) - 1U;
+  }
+
+  CliUartGetStats (&stats);
+  check (accepted == CLI_TX_BUFFER_SIZE, "TX ring not filled");
+  check (stats.tx_dropped_bytes == (requested - accepted), "dropped bytes not counted");
+  check ((SemaphoreWaitNumber != waitNumber) == (Rtos != FALSE), "wait without a scheduler, or no wait with one");
+
+  /* The UART resumes: the accepted output is sent, and the next one whole */
+  UartStalled = FALSE;
+  memset (&p_Expected[ExpectedSize], 'x', accepted);
+  ExpectedSize += accepted;
+  (void)uartComplete ();
+  check (cliOutput ("end\n") == 4, "output not accepted after the UART resumed");
+  expect ("end\n", 4U);
+  flush ();
+
+  check ((SinkSize == ExpectedSize) && (memcmp (p_Sink, p_Expected, SinkSize) == 0),
+         "output not sent after the UART resumed");
+}
+
+static void testBusyAndError (void)
+{
+  CliUartStats_t stats;
+  uint32_t callNumber;
+
+  enable (TRUE);
+
+  /* The UART is busy: the task retries once per scheduling, without spinning */
+  UartOwnedElsewhere = TRUE;
+  check (cliOutput ("busy\n") == 5, "output not accepted on a busy UART");
+  check ((ScheduleNumber != 0U) && (otUART_TX_Schdl != FALSE), "retry not scheduled");
+
+  callNumber = TransmitCallNumber;
+  ScheduleNumber = 0U;
+  arcUartProcess ();
+  check (TransmitCallNumber == (callNumber + 1U), "busy UART retried more than once");
+  check (ScheduleNumber == 1U, "retry not scheduled again");
+
+  UartOwnedElsewhere = FALSE;
+  runTask ();
+  check (TxSize == 5U, "transfer not started once the UART is free");
+
+  /* The transfer is aborted: the segment is dropped, the next one is sent */
+  check (cliOutput ("next\n") == 5, "output not accepted during a transfer");
+  TxSize = 0U;
+  huart1.gState = HAL_UART_STATE_READY;
+  huart1.ErrorCallback (&huart1);
+  expect ("next\n", 5U);
+  flush ();
+
+  CliUartGetStats (&stats);
+  check ((SinkSize == ExpectedSize) && (memcmp (p_Sink, p_Expected, SinkSize) == 0), "next segment not sent after an error");
+  check (stats.tx_dropped_bytes == 5U, "aborted segment not counted");
+  check (huart1.RxState == HAL_UART_STATE_BUSY_RX, "reception not running after an error");
+}
+
+static void testReceive (void)
+{
+  char command[CLI_LINE_SIZE + 32U];
+  CliUartStats_t stats;
+  uint32_t dropped;
+
+  enable (TRUE);
+
+  /* Commands in any chunking, each processed before the next is typed */
+  for (uint32_t i = 0U; i < 40U; i++)
+  {
+    (void)snprintf (command, sizeof (command), "command %u with some arguments\r", i);
+    uartType (command);
+    runTask ();
+    flush ();
+
+    (void)snprintf (command, sizeof (command), "command %u with some arguments\r\n", i);
+    check ((LineNumber == (i + 1U)) && (strcmp (Lines[i], command) == 0), "command not received");
+  }
+
+  /* reset is executed once its echo has been sent */
+  EchoSentFirst = TRUE;
+  uartType ("reset\r");
+  runTask ();
+  check ((LineNumber == 41U) && (strcmp (Lines[40], "reset\r\n") == 0), "reset not received");
+  check (EchoSentFirst != FALSE, "command executed before its echo was sent");
+
+  /* A command typed while the previous one is pending is dropped */
+  CliUartGetStats (&stats);
+  dropped = stats.rx_dropped_bytes;
+  uartType ("first\r");
+  uartType ("second\r");
+  runTask ();
+  CliUartGetStats (&stats);
+  check ((LineNumber == 42U) && (strcmp (Lines[41], "first\r\n") == 0), "pending command not received");
+  check (stats.rx_dropped_bytes == (dropped + 8U), "command typed while pending not dropped");
+
+  /* A too long command is dropped, and the next one is read */
+  memset (command, 'y', sizeof (command) - 2U);
+  command[sizeof (command) - 2U] = '\r';
+  command[sizeof (command) - 1U] = '\0';
+  uartType (command);
+  uartType ("after\r");
+  runTask ();
+  CliUartGetStats (&stats);
+  check ((LineNumber == 43U) && (strcmp (Lines[42], "after\r\n") == 0), "command after a too long one not received");
+  check (stats.rx_dropped_bytes == (dropped + 8U + sizeof (command) - 1U), "too long command not dropped");
+  check (stats.rx_bytes != 0U, "RX counter wrong");
+}
+
+int main (void)
+{
+  p_Sink = malloc (SINK_SIZE);
+  p_Expected = malloc (SINK_SIZE);
+
+  /* Without scheduler first: the TX semaphore is created by the first enable
+     with a scheduler, and kept */
+  testStalledUart (FALSE);
+  testOutput ();
+  testStalledUart (TRUE);
+  testBusyAndError ();
+  testReceive ();
+
+  free (p_Sink);
+  free (p_Expected);
+
+  printf ("test_cli_uart: %s (%u failures)\n", (failures == 0U) ? "PASS" : "FAIL", failures);
+
+  return (failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,487 @@
+/**
+  ******************************************************************************
+  * @file    test_hw_rng.c
+  * @brief   Host test of the RNG pool under concurrent consumers
+  ******************************************************************************
+  * The RNG is a model that generates consecutive serial numbers into a FIFO of
+  * 4 words and raises its interrupt while data are ready and the interrupt is
+  * enabled. Consumers read the pool as the link layer interrupt and the tasks
+  * do, and the interrupts are run at the barriers of the driver and between
+  * the exclusive load and store of the claim. Checked:
+  *  - every word read from the RNG is delivered exactly once, in order, and the
+  *    words delivered by a read are the ones of its claim,
+  *  - the bytes of a read of any length are the ones of the words claimed,
+  *  - a read that finds too few words is reported with complemented stale
+  *    words, and counted in the statistics,
+  *  - the background process starts a refill below the threshold, the refill
+  *    stops once the pool is full, and recovers from an RNG seed error.
+  *
+  * The driver is included so that its private state can be checked.
+  ******************************************************************************
+  */
+
+static void interruptHook (void);
+
+#define CMSIS_TEST_BARRIER_HOOK( )    interruptHook ()
+#define CMSIS_TEST_EXCLUSIVE_HOOK( )  interruptHook ()
+
+/* The target gets hw.h through app_common.h */
+#include "hw.h"
+#include "hw_rng.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RNG_FIFO_SIZE       4U
+#define MAX_READ_WORDS      16U
+#define CONCURRENT_READS    200000U
+#define UNDERFLOW_MARK      0x80000000U   /* Serial numbers stay below, their complement above. */
+
+RNG_TypeDef RngRegisters;
+
+/* RNG model: the words are the serial numbers 1, 2, 3... */
+static uint32_t RngGeneratedNumber;
+static uint32_t RngReadNumber;
+static uint8_t RngFreeRunning;
+
+/* Delivered words, indexed by serial number */
+static uint8_t * p_Delivered;
+static uint32_t DeliveredNumber;
+static uint32_t UnderflowWordNumber;
+
+static uint8_t InInterrupt;
+static uint8_t HookEnabled;
+static uint32_t InterruptReadNumber;
+static uint32_t ClaimConflictNumber;
+
+static uint8_t ProcessPending;
+static uint32_t TimerResetNumber;
+
+static uint32_t RandomState = 0x3C6EF372U;
+
+static uint32_t failures;
+
+static void check (const uint8_t Condition, const char * const p_Text)
+{
+  if (Condition == FALSE)
+  {
+    printf ("%s\n", p_Text);
+    failures++;
+  }
+}
+
+static uint32_t nextRandom (void)
+{
+  RandomState ^= RandomState << 13;
+  RandomState ^= RandomState >> 17;
+  RandomState ^= RandomState << 5;
+
+  return RandomState;
+}
+
+static void rngUpdateStatus (void)
+{
+  if (RngGeneratedNumber != RngReadNumber)
+  {
+    SET_BIT (RngRegisters.SR, RNG_SR_DRDY);
+  }
+  else
+  {
+    CLEAR_BIT (RngRegisters.SR, RNG_SR_DRDY);
+  }
+}
+
+static void runInterrupt (void ( *p_Handler ) ( void ))
+{
+  uint8_t inInterrupt = InInterrupt;
+
+  InInterrupt = TRUE;
+  p_Handler ();
+  InInterrupt = inInterrupt;
+
+  /* The exception return clears the exclusive monitor */
+  __CLREX ();
+}
+
+/* The RNG generates words while it is enabled, up to the FIFO size, and raises
+   its interrupt for each */
+static void rngGenerate (uint32_t WordNumber)
+{
+  for (; WordNumber != 0U; WordNumber--)
+  {
+    if ((LL_RNG_IsEnabled (RNG) != 0U) && ((RngGeneratedNumber - RngReadNumber) < RNG_FIFO_SIZE))
+    {
+      RngGeneratedNumber++;
+      rngUpdateStatus ();
+    }
+
+    if ((LL_RNG_IsEnabledIT (RNG) != 0U) && (LL_RNG_IsActiveFlag_DRDY (RNG) != 0U))
+    {
+      runInterrupt (HW_RNG_IRQHandler);
+    }
+  }
+}
+
+uint32_t LL_RNG_ReadRandData32 (RNG_TypeDef *RNGx)
+{
+  UNUSED (RNGx);
+
+  /* A read of the data register without data ready gives no random number */
+  if (RngGeneratedNumber == RngReadNumber)
+  {
+    return 0U;
+  }
+
+  RngReadNumber++;
+
+  if (RngFreeRunning != FALSE)
+  {
+    RngGeneratedNumber++;
+  }
+
+  rngUpdateStatus ();
+
+  return RngReadNumber;
+}
+
+void HWCB_RNG_Process (void)
+{
+  ProcessPending = TRUE;
+}
+
+void Error_Handler (void)
+{
+  check (FALSE, "error handler called");
+}
+
+TimerHandle_t xTimerCreate (const char * const pcTimerName, const TickType_t xTimerPeriodInTicks,
+                            const BaseType_t xAutoReload, void * const pvTimerID,
+                            TimerCallbackFunction_t pxCallbackFunction)
+{
+  UNUSED (pcTimerName);
+  UNUSED (xTimerPeriodInTicks);
+  UNUSED (xAutoReload);
+  UNUSED (pvTimerID);
+  UNUSED (pxCallbackFunction);
+
+  return NULL;
+}
+
+BaseType_t xTimerReset (TimerHandle_t xTimer, TickType_t xTicksToWait)
+{
+  UNUSED (xTimer);
+  UNUSED (xTicksToWait);
+
+  TimerResetNumber++;
+
+  return pdTRUE;
+}
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  UNUSED (func);
+  UNUSED (argument);
+  UNUSED (attr);
+
+  return NULL;
+}
+
+osStatus_t osThreadSuspend (osThreadId_t thread_id)
+{
+  UNUSED (thread_id);
+  return osOK;
+}
+
+osStatus_t osThreadResume (osThreadId_t thread_id)
+{
+  UNUSED (thread_id);
+  return osOK;
+}
+
+/* Background task: runs the process requested by the driver */
+static int runProcess (void)
+{
+  int status = HW_OK;
+
+  while (ProcessPending != FALSE)
+  {
+    ProcessPending = FALSE;
+    status = HW_RNG_Process ();
+  }
+
+  return status;
+}
+
+/* Reads WordNumber words, and checks that they continue the words delivered
+   so far, followed by the complemented words of an underflow */
+static int readWords (const uint32_t WordNumber)
+{
+  uint32_t buffer[HW_RNG_POOL_SIZE];
+  uint32_t validNumber = 0U;
+  int status;
+
+  status = HW_RNG_GetBytes ((uint8_t *)buffer, 4U * WordNumber);
+
+  for (uint32_t i = 0U; i < WordNumber; i++)
+  {
+    if (buffer[i] >= UNDERFLOW_MARK)
+    {
+      UnderflowWordNumber++;
+      continue;
+    }
+
+    check (validNumber == i, "valid word after an underflow word");
+    check ((buffer[i] != 0U) && (buffer[i] <= RngReadNumber), "word not read from the RNG");
+    check ((i == 0U) || (buffer[i] == (buffer[i - 1U] + 1U)), "words of a read not consecutive");
+    check (p_Delivered[buffer[i]] == FALSE, "word delivered twice");
+
+    p_Delivered[buffer[i]] = TRUE;
+    DeliveredNumber++;
+    validNumber++;
+  }
+
+  check ((status == HW_OK) == (validNumber == WordNumber), "underflow status does not match the words");
+
+  return status;
+}
+
+/* Read of the link layer interrupt */
+static void linkLayerRead (void)
+{
+  InterruptReadNumber++;
+  (void)readWords (1U + (nextRandom () % 4U));
+}
+
+/* An interrupt at a barrier, or between the exclusive load and store of a
+   claim: a read of the link layer, or words from the RNG */
+static void interruptHook (void)
+{
+  uint32_t action;
+
+  if ((InInterrupt != FALSE) || (HookEnabled == FALSE))
+  {
+    return;
+  }
+
+  action = nextRandom () % 4U;
+
+  if (action == 0U)
+  {
+    if (*__exclusive_monitor () != 0U)
+    {
+      ClaimConflictNumber++;
+    }
+
+    runInterrupt (linkLayerRead);
+  }
+  else if (action == 1U)
+  {
+    rngGenerate (1U + (nextRandom () % 4U));
+  }
+}
+
+/* Refills the pool as the background task and the RNG interrupt do */
+static void refill (void)
+{
+  for (uint32_t i = 0U; (i < 1000U) && ((ProcessPending != FALSE) || (HW_RNG_var.run != FALSE)); i++)
+  {
+    (void)runProcess ();
+    rngGenerate (1U);
+  }
+
+  check ((HW_RNG_var.run == FALSE) && (LL_RNG_IsEnabledIT (RNG) == 0U), "refill not stopped");
+}
+
+static void checkAccounting (const char * const p_Text)
+{
+  HW_RNG_STATS_T stats;
+  uint8_t lost = FALSE;
+
+  HW_RNG_GetStats (&stats);
+
+  check ((DeliveredNumber + stats.level) == RngReadNumber, p_Text);
+  check (stats.refill_words == RngReadNumber, p_Text);
+  check (stats.underflow_words == UnderflowWordNumber, p_Text);
+
+  for (uint32_t serial = 1U; serial <= DeliveredNumber; serial++)
+  {
+    lost |= (p_Delivered[serial] == FALSE);
+  }
+
+  check (lost == FALSE, p_Text);
+}
+
+static void start (void)
+{
+  memset (p_Delivered, 0, RngReadNumber + 1U);
+  memset (&RngRegisters, 0, sizeof (RngRegisters));
+  RngGeneratedNumber = 0U;
+  RngReadNumber = 0U;
+  DeliveredNumber = 0U;
+  UnderflowWordNumber = 0U;
+  ProcessPending = FALSE;
+  TimerResetNumber = 0U;
+
+  /* As app_entry.c: the RNG runs freely while the pool is filled at reset */
+  HW_RNG_SetPoolThreshold (CFG_HW_RNG_POOL_THRESHOLD);
+  HW_RNG_Init ();
+  RngFreeRunning = TRUE;
+  rngGenerate (RNG_FIFO_SIZE);
+  HW_RNG_Start ();
+  RngFreeRunning = FALSE;
+}
+
+static void testStart (void)
+{
+  HW_RNG_STATS_T stats;
+
+  start ();
+  HW_RNG_GetStats (&stats);
+
+  check (stats.level == HW_RNG_POOL_SIZE, "pool not filled at start");
+  check ((stats.refill_count == 0U) && (stats.underflow_count == 0U), "statistics not reset at start");
+  check (TimerResetNumber == 1U, "disable timer not started at start");
+  checkAccounting ("accounting wrong at start");
+}
+
+static void testBytes (void)
+{
+  uint8_t buffer[4U * HW_RNG_POOL_SIZE + 1U];
+  uint8_t match = TRUE;
+
+  for (uint32_t len = 1U; len <= (4U * HW_RNG_POOL_SIZE); len++)
+  {
+    uint32_t wordNumber = (len + 3U) / 4U;
+    uint8_t belowThreshold = ((HW_RNG_POOL_SIZE - wordNumber) < CFG_HW_RNG_POOL_THRESHOLD);
+
+    start ();
+    buffer[len] = 0xA5U;
+
+    check (HW_RNG_GetBytes (buffer, len) == HW_OK, "read of a full pool failed");
+
+    /* The words are the serial numbers from 1, copied in the byte order of the target */
+    for (uint32_t i = 0U; i < len; i++)
+    {
+      match &= (buffer[i] == (uint8_t)((1U + (i / 4U)) >> (8U * (i % 4U))));
+    }
+
+    for (uint32_t serial = 1U; serial <= wordNumber; serial++)
+    {
+      p_Delivered[serial] = TRUE;
+    }
+
+    DeliveredNumber = wordNumber;
+
+    check (buffer[len] == 0xA5U, "read past the length");
+    check (HW_RNG_var.tail == wordNumber, "claim does not match the length");
+    check (ProcessPending == belowThreshold, "process not requested below the threshold");
+
+    refill ();
+    check (HW_RNG_var.stats.refill_count == belowThreshold, "refill not started below the threshold");
+    check ((HW_RNG_var.stats.refill_count == 0U) || (HW_RNG_Level (&HW_RNG_var) == HW_RNG_POOL_SIZE),
+           "pool not refilled");
+    check (TimerResetNumber == (1U + belowThreshold), "disable timer not started after the refill");
+    checkAccounting ("accounting wrong after a read of any length");
+  }
+
+  check (match != FALSE, "bytes do not match the words claimed");
+}
+
+static void testUnderflow (void)
+{
+  HW_RNG_STATS_T stats;
+
+  start ();
+
+  check (readWords (HW_RNG_POOL_SIZE) == HW_OK, "read of the full pool failed");
+  check (ProcessPending != FALSE, "process not requested on an empty pool");
+
+  /* No refill: both reads find too few words */
+  check (readWords (8U) == HW_RNG_UFLOW_ERROR, "underflow not reported");
+  check (readWords (MAX_READ_WORDS) == HW_RNG_UFLOW_ERROR, "underflow not reported");
+
+  HW_RNG_GetStats (&stats);
+  check ((stats.underflow_count == 2U) && (stats.underflow_words == (8U + MAX_READ_WORDS)), "underflow statistics wrong");
+
+  /* The underflow is reported by the process, which still starts the refill */
+  ProcessPending = FALSE;
+  check (HW_RNG_Process () == HW_RNG_UFLOW_ERROR, "underflow not reported by the process");
+  check (HW_RNG_var.run != FALSE, "refill not started after an underflow");
+
+  refill ();
+  HW_RNG_GetStats (&stats);
+  check ((stats.level == HW_RNG_POOL_SIZE) && (stats.refill_count == 1U), "pool not refilled after an underflow");
+  check (HW_RNG_var.error == HW_OK, "underflow reported twice");
+  checkAccounting ("accounting wrong after an underflow");
+}
+
+static void testSeedError (void)
+{
+  start ();
+
+  (void)readWords (HW_RNG_POOL_SIZE);
+  ProcessPending = FALSE;
+  check (HW_RNG_Process () == HW_OK, "refill not started");
+
+  /* A seed error during the refill stops it; the process reports it once,
+     then restarts the refill */
+  rngGenerate (2U);
+  SET_BIT (RngRegisters.SR, RNG_SR_SEIS);
+  runInterrupt (HW_RNG_IRQHandler);
+  check ((HW_RNG_var.run == FALSE) && (HW_RNG_var.error == HW_RNG_NOISE_ERROR), "seed error does not stop the refill");
+  check (LL_RNG_IsActiveFlag_SEIS (RNG) == 0U, "seed error not cleared");
+  check (ProcessPending != FALSE, "process not requested on a seed error");
+
+  ProcessPending = FALSE;
+  check (HW_RNG_Process () == HW_RNG_NOISE_ERROR, "seed error not reported by the process");
+  check (runProcess () == HW_OK, "refill not restarted after a seed error");
+
+  refill ();
+  check (HW_RNG_Level (&HW_RNG_var) == HW_RNG_POOL_SIZE, "pool not refilled after a seed error");
+  checkAccounting ("accounting wrong after a seed error");
+}
+
+static void testConcurrentReads (void)
+{
+  HW_RNG_STATS_T stats;
+
+  start ();
+  HookEnabled = TRUE;
+  InterruptReadNumber = 0U;
+  ClaimConflictNumber = 0U;
+
+  for (uint32_t i = 0U; i < CONCURRENT_READS; i++)
+  {
+    (void)readWords (1U + (nextRandom () % MAX_READ_WORDS));
+    (void)runProcess ();
+    rngGenerate (nextRandom () % 32U);
+  }
+
+  HookEnabled = FALSE;
+  HW_RNG_GetStats (&stats);
+
+  check (ClaimConflictNumber != 0U, "no read interrupted between the copy and the claim");
+  check (stats.underflow_count != 0U, "no underflow");
+  checkAccounting ("accounting wrong after the concurrent reads");
+
+  printf ("%u reads (%u from interrupts, %u between the copy and the claim of another): %u words delivered, "
+          "%u underflows of %u words, %u refills\n", CONCURRENT_READS + InterruptReadNumber, InterruptReadNumber,
+          ClaimConflictNumber, DeliveredNumber, stats.underflow_count, stats.underflow_words, stats.refill_count);
+}
+
+int main (void)
+{
+  p_Delivered = calloc (CONCURRENT_READS * MAX_READ_WORDS + 1U, 1U);
+
+  testStart ();
+  testBytes ();
+  testUnderflow ();
+  testSeedError ();
+  testConcurrentReads ();
+
+  free (p_Delivered);
+
+  printf ("test_hw_rng: %s (%u failures)\n", (failures == 0U) ? "PASS" : "FAIL", failures);
+
+  return (failures == 0U) ? 0 : 1;
+}
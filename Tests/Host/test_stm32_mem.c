@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file    test_stm32_mem.c
+  * @brief   Host test of the UTIL_MEM primitives
+  ******************************************************************************
+  * Checks UTIL_MEM_cpy_8, UTIL_MEM_cpyr_8 and UTIL_MEM_set_8 against a byte
+  * per byte reference for every source and destination alignment and for the
+  * sizes around the word and burst boundaries. The bytes around the
+  * destination shall stay untouched.
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "stm32_mem.h"
+
+#define BUFFER_SIZE     600U
+#define MAX_OFFSET      8U
+#define MAX_COPY_SIZE   300U
+#define GUARD_VALUE     0xAAU
+#define FILL_VALUE      0x5CU
+
+static uint8_t Source[BUFFER_SIZE];
+static uint8_t Result[BUFFER_SIZE];
+static uint8_t Expected[BUFFER_SIZE];
+
+static void resetBuffers (void)
+{
+  memset (Result, GUARD_VALUE, BUFFER_SIZE);
+  memset (Expected, GUARD_VALUE, BUFFER_SIZE);
+}
+
+int main (void)
+{
+  uint32_t failures = 0U;
+
+  for (uint32_t idx = 0U; idx < BUFFER_SIZE; idx++)
+  {
+    Source[idx] = (uint8_t)((idx * 7U) + 1U);
+  }
+
+  for (uint32_t srcOffset = 0U; srcOffset < MAX_OFFSET; srcOffset++)
+  {
+    for (uint32_t dstOffset = 0U; dstOffset < MAX_OFFSET; dstOffset++)
+    {
+      for (uint16_t size = 0U; size < MAX_COPY_SIZE; size++)
+      {
+        resetBuffers ();
+        UTIL_MEM_cpy_8 (&Result[dstOffset], &Source[srcOffset], size);
+        memcpy (&Expected[dstOffset], &Source[srcOffset], size);
+        if (memcmp (Result, Expected, BUFFER_SIZE) != 0)
+        {
+          printf ("UTIL_MEM_cpy_8 mismatch: src +%u dst +%u size %u\n", srcOffset, dstOffset, size);
+          failures++;
+        }
+
+        resetBuffers ();
+        UTIL_MEM_cpyr_8 (&Result[dstOffset], &Source[srcOffset], size);
+        for (uint16_t idx = 0U; idx < size; idx++)
+        {
+          Expected[dstOffset + size - 1U - idx] = Source[srcOffset + idx];
+        }
+        if (memcmp (Result, Expected, BUFFER_SIZE) != 0)
+        {
+          printf ("UTIL_MEM_cpyr_8 mismatch: src +%u dst +%u size %u\n", srcOffset, dstOffset, size);
+          failures++;
+        }
+
+        if (srcOffset == 0U)
+        {
+          resetBuffers ();
+          UTIL_MEM_set_8 (&Result[dstOffset], FILL_VALUE, size);
+          memset (&Expected[dstOffset], FILL_VALUE, size);
+          if (memcmp (Result, Expected, BUFFER_SIZE) != 0)
+          {
+            printf ("UTIL_MEM_set_8 mismatch: dst +%u size %u\n", dstOffset, size);
+            failures++;
+          }
+        }
+      }
+    }
+  }
+
+  printf ("test_stm32_mem: %s (%u failures)\n", (failures == 0U) ? "PASS" : "FAIL", failures);
+
+  return (failures == 0U) ? 0 : 1;
+}
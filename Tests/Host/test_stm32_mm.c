@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    test_stm32_mm.c
+  * @brief   Host stress test of the stm32_mm TLSF allocator
+  ******************************************************************************
+  * Checks the bit index macros of the segregated lists, then runs random
+  * allocations and releases of mixed small and large sizes on a pool with an
+  * unaligned start address. Every live buffer is filled with a pattern that
+  * is verified when it is released, so overlapping blocks are detected. Once
+  * everything is released, the free byte count shall be back to its initial
+  * value and the pool shall be a single block again.
+  *
+  * The module is included so that its private counters can be checked.
+  ******************************************************************************
+  */
+
+#include "stm32_mm.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#define POOL_SIZE       200003U
+#define POOL_OFFSET     3U
+#define SLOT_NUMBER     500U
+#define ITERATIONS      2000000U
+
+static uint8_t Pool[POOL_SIZE];
+static uint8_t * p_Slot[SLOT_NUMBER];
+static size_t SlotSize[SLOT_NUMBER];
+
+/* Small deterministic generator, the run does not depend on the C library */
+static uint32_t RandomState = 1U;
+
+static uint32_t nextRandom (void)
+{
+  RandomState ^= RandomState << 13;
+  RandomState ^= RandomState >> 17;
+  RandomState ^= RandomState << 5;
+
+  return RandomState;
+}
+
+int main (void)
+{
+  uint32_t failures = 0U;
+  uint32_t allocFailures = 0U;
+  size_t initialFree;
+  void * p_Whole;
+
+  /* Bit indexes of the segregated lists, on every single and two bit value */
+  for (uint32_t high = 0U; high < 32U; high++)
+  {
+    for (uint32_t low = 0U; low <= high; low++)
+    {
+      uint32_t value = (1UL << high) | (1UL << low);
+
+      if ((heapFLS (value) != high) || (heapFFS (value) != low))
+      {
+        printf ("bit index of 0x%08x: last %u, first %u\n", value, heapFLS (value), heapFFS (value));
+        failures++;
+      }
+    }
+  }
+
+  UTIL_MM_Init (&Pool[POOL_OFFSET], POOL_SIZE - POOL_OFFSET);
+  initialFree = xFreeBytesRemaining;
+
+  if ((UTIL_MM_GetBuffer (0U) != NULL) || (UTIL_MM_GetBuffer (POOL_SIZE) != NULL))
+  {
+    printf ("empty or oversized request was served\n");
+    failures++;
+  }
+
+  UTIL_MM_ReleaseBuffer (NULL);
+
+  for (uint32_t iteration = 0U; (iteration < ITERATIONS) && (failures == 0U); iteration++)
+  {
+    uint32_t slot = nextRandom () % SLOT_NUMBER;
+
+    if (p_Slot[slot] != NULL)
+    {
+      for (size_t idx = 0U; idx < SlotSize[slot]; idx++)
+      {
+        if (p_Slot[slot][idx] != (uint8_t)slot)
+        {
+          printf ("buffer %u corrupted at byte %zu\n", slot, idx);
+          failures++;
+          break;
+        }
+      }
+
+      UTIL_MM_ReleaseBuffer (p_Slot[slot]);
+      p_Slot[slot] = NULL;
+    }
+    else
+    {
+      /* One request out of four is large */
+      SlotSize[slot] = ((nextRandom () % 4U) == 0U) ? ((nextRandom () % 4000U) + 1U) : ((nextRandom () % 64U) + 1U);
+      p_Slot[slot] = UTIL_MM_GetBuffer (SlotSize[slot]);
+
+      if (p_Slot[slot] == NULL)
+      {
+        allocFailures++;
+      }
+      else if ((((uintptr_t)p_Slot[slot] & portBYTE_ALIGNMENT_MASK) != 0U)
+               || (p_Slot[slot] < &Pool[POOL_OFFSET])
+               || ((p_Slot[slot] + SlotSize[slot]) > &Pool[POOL_SIZE]))
+      {
+        printf ("buffer %p of %zu bytes misaligned or out of the pool\n", (void *)p_Slot[slot], SlotSize[slot]);
+        failures++;
+      }
+      else
+      {
+        memset (p_Slot[slot], (int)slot, SlotSize[slot]);
+      }
+    }
+  }
+
+  for (uint32_t slot = 0U; slot < SLOT_NUMBER; slot++)
+  {
+    UTIL_MM_ReleaseBuffer (p_Slot[slot]);
+    p_Slot[slot] = NULL;
+  }
+
+  if (xFreeBytesRemaining != initialFree)
+  {
+    printf ("free bytes %zu after releasing everything, %zu expected\n", xFreeBytesRemaining, initialFree);
+    failures++;
+  }
+
+  /* The pool shall have coalesced back into one block */
+  p_Whole = UTIL_MM_GetBuffer (initialFree - xHeapStructSize);
+  if (p_Whole == NULL)
+  {
+    printf ("pool did not coalesce into a single block\n");
+    failures++;
+  }
+  UTIL_MM_ReleaseBuffer (p_Whole);
+
+  printf ("test_stm32_mm: %s (%u failures, %u allocations refused on a full pool)\n",
+          (failures == 0U) ? "PASS" : "FAIL", failures, allocFailures);
+
+  return (failures == 0U) ? 0 : 1;
+}
@@ -22,7 +22,18 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private defines -----------------------------------------------------------*/
+
+/* Mask of the address bits below the 32bits word alignment */
+#define UTIL_MEM_WORD_MASK          ( 3U )
+
+/* Number of 32bits words moved per iteration of the burst loops */
+#define UTIL_MEM_BURST_WORDS        ( 4U )
+
 /* Private macros ------------------------------------------------------------*/
+
+/* Check whether an address is aligned on a 32bits word */
+#define UTIL_MEM_IS_WORD_ALIGNED( __ADDR__ )   ( ( ( uint32_t ) ( __ADDR__ ) & UTIL_MEM_WORD_MASK ) == 0U )
+
 /* Private variables ---------------------------------------------------------*/
 /* Global variables ----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
@@ -32,7 +43,45 @@ void UTIL_MEM_cpy_8( void *dst, const void *src, uint16_t size )
 {
   uint8_t* dst8= (uint8_t *) dst;
   uint8_t* src8= (uint8_t *) src;
+  uint32_t* dst32;
+  uint32_t* src32;
+
+  /* Word copy is only possible when both buffers share the same alignment */
+  if( ( ( (uint32_t) dst8 ^ (uint32_t) src8 ) & UTIL_MEM_WORD_MASK ) == 0U )
+  {
+    /* Copy the head bytes up to the first word boundary */
+    while( ( size != 0U ) && ( !UTIL_MEM_IS_WORD_ALIGNED( src8 ) ) )
+    {
+      *dst8++ = *src8++;
+      size--;
+    }
+
+    dst32 = (uint32_t *) dst8;
+    src32 = (uint32_t *) src8;
 
+    /* Burst copy, lets the compiler use LDM/STM */
+    while( size >= ( UTIL_MEM_BURST_WORDS * sizeof( uint32_t ) ) )
+    {
+      dst32[0] = src32[0];
+      dst32[1] = src32[1];
+      dst32[2] = src32[2];
+      dst32[3] = src32[3];
+      dst32 += UTIL_MEM_BURST_WORDS;
+      src32 += UTIL_MEM_BURST_WORDS;
+      size -= ( UTIL_MEM_BURST_WORDS * sizeof( uint32_t ) );
+    }
+
+    while( size >= sizeof( uint32_t ) )
+    {
+      *dst32++ = *src32++;
+      size -= sizeof( uint32_t );
+    }
+
+    dst8 = (uint8_t *) dst32;
+    src8 = (uint8_t *) src32;
+  }
+
+  /* Copy the tail bytes, or the whole buffer when not aligned alike */
   while( size-- )
     {
         *dst8++ = *src8++;
@@ -43,8 +92,31 @@ void UTIL_MEM_cpyr_8( void *dst, const void *src, uint16_t size )
 {
     uint8_t* dst8= (uint8_t *) dst;
     uint8_t* src8= (uint8_t *) src;
+    uint32_t word;
 
     dst8 = dst8 + ( size - 1 );
+
+    /* Copy the head bytes up to the first source word boundary */
+    while( ( size != 0U ) && ( !UTIL_MEM_IS_WORD_ALIGNED( src8 ) ) )
+    {
+        *dst8-- = *src8++;
+        size--;
+    }
+
+    /* Reversed word copy when the destination word is aligned too */
+    if( UTIL_MEM_IS_WORD_ALIGNED( dst8 - ( sizeof( uint32_t ) - 1U ) ) )
+    {
+        while( size >= sizeof( uint32_t ) )
+        {
+            word = *(uint32_t *) src8;
+            *(uint32_t *) ( dst8 - ( sizeof( uint32_t ) - 1U ) ) = __REV( word );
+            dst8 -= sizeof( uint32_t );
+            src8 += sizeof( uint32_t );
+            size -= sizeof( uint32_t );
+        }
+    }
+
+    /* Copy the tail bytes */
     while( size-- )
     {
         *dst8-- = *src8++;
@@ -54,6 +126,39 @@ void UTIL_MEM_cpyr_8( void *dst, const void *src, uint16_t size )
 void UTIL_MEM_set_8( void *dst, uint8_t value, uint16_t size )
 {
   uint8_t* dst8= (uint8_t *) dst;
+  uint32_t* dst32;
+  uint32_t value32;
+
+  /* Fill the head bytes up to the first word boundary */
+  while( ( size != 0U ) && ( !UTIL_MEM_IS_WORD_ALIGNED( dst8 ) ) )
+  {
+    *dst8++ = value;
+    size--;
+  }
+
+  /* Replicate the value on the four bytes of a word */
+  value32 = (uint32_t) value * 0x01010101U;
+  dst32 = (uint32_t *) dst8;
+
+  /* Burst fill, lets the compiler use STM */
+  while( size >= ( UTIL_MEM_BURST_WORDS * sizeof( uint32_t ) ) )
+  {
+    dst32[0] = value32;
+    dst32[1] = value32;
+    dst32[2] = value32;
+    dst32[3] = value32;
+    dst32 += UTIL_MEM_BURST_WORDS;
+    size -= ( UTIL_MEM_BURST_WORDS * sizeof( uint32_t ) );
+  }
+
+  while( size >= sizeof( uint32_t ) )
+  {
+    *dst32++ = value32;
+    size -= sizeof( uint32_t );
+  }
+
+  /* Fill the tail bytes */
+  dst8 = (uint8_t *) dst32;
   while( size-- )
   {
     *dst8++ = value;
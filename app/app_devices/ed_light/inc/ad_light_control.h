@@ -111,5 +111,28 @@ void ad_light_ctr_colorSet(uint8_t r, uint8_t g, uint8_t b);
  */
 void ad_light_ctr_init(ot_app_devDrv_t *devDrv);
 
+/**
+ * @brief Get the on/off state last set with @ref ad_light_ctr_onOff().
+ *
+ * @return 1 if the light is on, 0 if it is off.
+ */
+uint8_t ad_light_ctr_onOffGet(void);
+
+/**
+ * @brief Get the dimming level last set with @ref ad_light_ctr_dimSet().
+ *
+ * @return Dimming value in the range 0..255.
+ */
+uint32_t ad_light_ctr_dimGet(void);
+
+/**
+ * @brief Get the base RGB color last set with @ref ad_light_ctr_colorSet().
+ *
+ * @param r Output red component.
+ * @param g Output green component.
+ * @param b Output blue component.
+ */
+void ad_light_ctr_colorGet(uint8_t *r, uint8_t *g, uint8_t *b);
+
 /** @} */ /* end of group  */
 #endif /* AD_LIGHT_CONTROL_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file ad_light_group.h
+ * @author Jan Łukaszewicz
+ * @brief Multicast group control for the light device.
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @defgroup device_light_group Light Device Group Control
+ * @ingroup device_light
+ * @{
+ *
+ * Group lighting without this module costs one unicast exchange per lamp.
+ * With it, every light subscribes to the multicast address
+ * @ref AD_LIGHT_GROUP_ADDRESS and a controller reaches all lamps of the group
+ * with a single non‑confirmable request sent to that address on the usual
+ * light URIs.
+ *
+ * Request filtering (@ref ad_light_group_acceptRequest()):
+ * - Requests that are not sent to @ref AD_LIGHT_GROUP_ADDRESS are accepted
+ *   unchanged.
+ * - Confirmable group requests (not allowed by RFC 7252) are dropped.
+ * - Group requests are deduplicated per controller (source address and
+ *   port, the CoAP message ID space of an endpoint) by CoAP message ID.
+ *   IDs that are equal to or up to @ref AD_LIGHT_GROUP_SEQ_WINDOW behind the
+ *   last accepted ID are treated as duplicates or stale reordered commands.
+ * - A controller not heard from for @ref AD_LIGHT_GROUP_SENDER_LIFETIME_MS
+ *   is forgotten, so a controller that restarted with any message ID is
+ *   accepted again.
+ *
+ * Acknowledgement aggregation (@ref AD_LIGHT_GROUP_ACK_ENABLE):
+ * - Disabled by default: group commands are not answered.
+ * - When enabled, an applied group command schedules one non‑confirmable
+ *   2.04 response after a random delay up to @ref AD_LIGHT_GROUP_ACK_WINDOW_MS.
+ *   Commands that arrive from the same controller before the response is
+ *   sent are covered by it (the response uses the token of the newest one),
+ *   and the random delay spreads the responses of all lamps in the group.
+ */
+
+#ifndef AD_LIGHT_GROUP_H_
+#define AD_LIGHT_GROUP_H_
+
+#include <stdint.h>
+#include <openthread/coap.h>
+
+/**
+ * @brief Multicast group of the light device.
+ *
+ * Realm‑local (`ff03::/16`) or site‑local (`ff05::/16`) scope is expected.
+ */
+#ifndef AD_LIGHT_GROUP_ADDRESS
+#define AD_LIGHT_GROUP_ADDRESS      "ff03::1:11"
+#endif
+
+/** @brief Number of controllers tracked for group request deduplication. */
+#define AD_LIGHT_GROUP_MAX_SENDERS  (4)
+
+/** @brief Message ID distance behind the last accepted ID that is dropped. */
+#define AD_LIGHT_GROUP_SEQ_WINDOW   (32)
+
+/** @brief Time a controller is tracked after its last request (RFC 7252 NON_LIFETIME), in milliseconds. */
+#define AD_LIGHT_GROUP_SENDER_LIFETIME_MS (145000)
+
+/** @brief Set to 1 to answer applied group commands with an aggregated response. */
+#ifndef AD_LIGHT_GROUP_ACK_ENABLE
+#define AD_LIGHT_GROUP_ACK_ENABLE   (0)
+#endif
+
+/** @brief Maximum random delay of the aggregated group response, in milliseconds. */
+#define AD_LIGHT_GROUP_ACK_WINDOW_MS (500)
+
+/**
+ * @brief Check whether a received request should be processed.
+ *
+ * @param aMessage     Received CoAP request.
+ * @param aMessageInfo Message info of the received request.
+ *
+ * @return 1 if the request should be processed, 0 if it must be dropped.
+ */
+uint8_t ad_light_group_acceptRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo);
+
+/**
+ * @brief Notify the module that an accepted request was applied.
+ *
+ * For group requests with @ref AD_LIGHT_GROUP_ACK_ENABLE set, this schedules
+ * the aggregated response. Unicast requests are ignored.
+ *
+ * @param aMessage     Applied CoAP request.
+ * @param aMessageInfo Message info of the applied request.
+ */
+void ad_light_group_requestApplied(otMessage *aMessage, const otMessageInfo *aMessageInfo);
+
+/**
+ * @brief Send aggregated group responses whose delay expired.
+ *
+ * Called from the light device task (@ref ot_app_drv_task()).
+ */
+void ad_light_group_task(void);
+
+/**
+ * @brief Subscribe to the light multicast group.
+ *
+ * @param instance Pointer to the OpenThread instance.
+ */
+void ad_light_group_init(otInstance *instance);
+
+/** @} */ /* end of group device_light_group */
+
+#endif /* AD_LIGHT_GROUP_H_ */
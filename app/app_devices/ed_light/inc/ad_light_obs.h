@@ -0,0 +1,126 @@
+/**
+ * @file ad_light_obs.h
+ * @author Jan Łukaszewicz
+ * @brief CoAP Observe (RFC 7641) notifications for the light device state.
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @defgroup device_light_obs Light Device Observe
+ * @ingroup device_light
+ * @{
+ *
+ * This module lets controllers observe the light state instead of polling
+ * the `light/on_off`, `light/dimm` and `light/rgb` URIs.
+ *
+ * Registration:
+ * - A GET request carrying the Observe option with value 0 registers the
+ *   sender (peer address, port and token) for the requested resource and
+ *   is answered with a 2.05 response carrying the Observe option and the
+ *   current state.
+ * - A GET request with Observe value 1 and the registration token removes
+ *   the registration.
+ * - Observers are kept in a fixed‑size table of
+ *   @ref AD_LIGHT_OBS_MAX_OBSERVERS entries; when the table is full
+ *   the request is still served, but without the Observe option, so the
+ *   client knows it is not registered.
+ *
+ * Coalescing:
+ * - Every state change stores the latest value of the resource and opens
+ *   a notification window of @ref AD_LIGHT_OBS_COALESCE_MS if none is open.
+ * - When the window expires, @ref ad_light_obs_task() sends one notification
+ *   per observer carrying the newest value, so a fast dimming ramp produces
+ *   one notification per window instead of one per step.
+ * - Notifications are non‑confirmable; every @ref AD_LIGHT_OBS_CON_INTERVAL
+ *   notification is confirmable. An observer is removed from the table when
+ *   it resets a confirmable notification or when a notification to it cannot
+ *   be sent; a confirmable notification that times out keeps the observer.
+ */
+
+#ifndef AD_LIGHT_OBS_H_
+#define AD_LIGHT_OBS_H_
+
+#include <stdint.h>
+#include <openthread/coap.h>
+
+/** @brief Maximum number of observer registrations for all light resources. */
+#define AD_LIGHT_OBS_MAX_OBSERVERS  (8)
+
+/** @brief Coalescing window for state change notifications, in milliseconds. */
+#define AD_LIGHT_OBS_COALESCE_MS    (100)
+
+/** @brief Every n‑th notification of a resource is sent as confirmable. */
+#define AD_LIGHT_OBS_CON_INTERVAL   (16)
+
+/** @brief Maximum size of the resource state carried in a notification. */
+#define AD_LIGHT_OBS_STATE_MAX_SIZE (4)
+
+/**
+ * @brief Observable light resources.
+ */
+typedef enum {
+    AD_LIGHT_OBS_ON_OFF = 0,    ///< `light/on_off` – 1 byte on/off value
+    AD_LIGHT_OBS_DIMM,          ///< `light/dimm`   – 4 byte little‑endian dim value
+    AD_LIGHT_OBS_RGB,           ///< `light/rgb`    – 3 bytes B, G, R
+
+    AD_LIGHT_OBS_RESOURCE_COUNT
+} ad_light_obs_resource_t;
+
+/**
+ * @brief Register or deregister the sender of a request as an observer.
+ *
+ * Only GET requests that carry the Observe option with value 0 or 1 are
+ * handled, and answered here with the current state of @p resource; any
+ * other request is left to the caller. Re‑registration from the same peer
+ * and resource replaces the stored token.
+ *
+ * @param resource     Resource addressed by the request.
+ * @param aMessage     Received CoAP request.
+ * @param aMessageInfo Message info of the received request.
+ *
+ * @return 1 if the request was answered, 0 if the caller must process it.
+ */
+uint8_t ad_light_obs_processRequest(ad_light_obs_resource_t resource, otMessage *aMessage,
+                                    const otMessageInfo *aMessageInfo);
+
+/**
+ * @brief Record a new state of a resource and schedule a notification.
+ *
+ * The state is copied, so later changes within the same coalescing window
+ * overwrite it and only the newest value is sent.
+ *
+ * @param resource  Resource whose state has changed.
+ * @param state     Pointer to the new state in the URI payload format.
+ * @param stateSize Size of @p state (at most @ref AD_LIGHT_OBS_STATE_MAX_SIZE).
+ */
+void ad_light_obs_stateChanged(ad_light_obs_resource_t resource, const uint8_t *state, uint8_t stateSize);
+
+/**
+ * @brief Set the state of a resource without scheduling a notification.
+ *
+ * Used at initialization to serve the current state of the light to the
+ * first registrations.
+ *
+ * @param resource  Resource to set.
+ * @param state     Pointer to the state in the URI payload format.
+ * @param stateSize Size of @p state (at most @ref AD_LIGHT_OBS_STATE_MAX_SIZE).
+ */
+void ad_light_obs_stateSet(ad_light_obs_resource_t resource, const uint8_t *state, uint8_t stateSize);
+
+/**
+ * @brief Send notifications for resources whose coalescing window expired.
+ *
+ * Called from the light device task (@ref ot_app_drv_task()), which runs
+ * in the OpenThread task context.
+ */
+void ad_light_obs_task(void);
+
+/**
+ * @brief Initialize the observer table.
+ *
+ * @param instance Pointer to the OpenThread instance used to send notifications.
+ */
+void ad_light_obs_init(otInstance *instance);
+
+/** @} */ /* end of group device_light_obs */
+
+#endif /* AD_LIGHT_OBS_H_ */
@@ -25,6 +25,8 @@
 #include "string.h"
 #include "ot_app_drv.h"
 #include "ad_light_uri.h"
+#include "ad_light_obs.h"
+#include "ad_light_group.h"
 
 #define TAG "ad_light "
 
@@ -106,7 +108,8 @@ void ad_light_subscribedUrisCallback(oac_uri_dataPacket_t *data)
 
 void ad_light_task()
 {
-   
+    ad_light_obs_task();
+    ad_light_group_task();
 }
 
 //////////////////////
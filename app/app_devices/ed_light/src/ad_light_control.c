@@ -37,6 +37,7 @@ typedef struct {
     uint8_t RGB[AD_LIGHT_CTR_COLOR]; 
     uint8_t RGB_dim[AD_LIGHT_CTR_COLOR]; 
     uint32_t dim;
+    uint8_t onOff;
 }ad_light_ctr_t;
 
 static ad_light_ctr_t ctr;
@@ -55,22 +56,20 @@ static uint8_t *ad_light_ctr_rgbScaling(uint32_t dimValue)
 
 static void ad_light_ctr_dimSave(uint32_t dimValue)
 {
-    // ctr.dim = dimValue;
-	UNUSED(dimValue);
+    ctr.dim = dimValue;
 }
 
 static void ad_light_ctr_colorSave(uint8_t r, uint8_t g, uint8_t b)
 {
-    // ctr.RGB[AD_LIGHT_ID_R] = r;
-    // ctr.RGB[AD_LIGHT_ID_G] = g;
-    // ctr.RGB[AD_LIGHT_ID_B] = b;
-	UNUSED(r);
-	UNUSED(g);
-	UNUSED(b);
+    ctr.RGB[AD_LIGHT_ID_R] = r;
+    ctr.RGB[AD_LIGHT_ID_G] = g;
+    ctr.RGB[AD_LIGHT_ID_B] = b;
 }
 
 void ad_light_ctr_onOff(uint32_t ledState)
 {
+    ctr.onOff = (ledState != 0);
+
     // if(ledState)
     // {
     //     if(ctr.dim == 0)
@@ -85,25 +84,22 @@ void ad_light_ctr_onOff(uint32_t ledState)
     // {
     //     WS2812BFX_ForceAllColor(0, 0, 0, 0);
     // }
-	UNUSED(ledState);
 }
 
 void ad_light_ctr_dimSet(uint32_t dimValue)
 {
     // uint8_t *rgb;
 
-    // ad_light_ctr_dimSave(dimValue);  
+    ad_light_ctr_dimSave(dimValue);
     // rgb = ad_light_ctr_rgbScaling(dimValue);  
 
     // WS2812BFX_ForceAllColor(0, rgb[AD_LIGHT_ID_R], rgb[AD_LIGHT_ID_G], rgb[AD_LIGHT_ID_B]);
-
-	UNUSED(dimValue);
 }
 
 
 void ad_light_ctr_colorSet(uint8_t r, uint8_t g, uint8_t b)
 {   
-    // ad_light_ctr_colorSave(r, g, b);
+    ad_light_ctr_colorSave(r, g, b);
 
     // if(ctr.dim != 0)
     // {
@@ -113,27 +109,37 @@ void ad_light_ctr_colorSet(uint8_t r, uint8_t g, uint8_t b)
     // {
     //     WS2812BFX_ForceAllColor(0, r, g, b);
     // }
-
-	UNUSED(r);
-		UNUSED(g);
-		UNUSED(b);
 }
 
 void ad_light_ctr_init(ot_app_devDrv_t *devDrv)
 {
-    // if(devDrv == NULL) return;
-    // drv = devDrv;
-
-    // // todo load latest settings
-    // // color, dim, 
-    // ad_light_ctr_colorSave(0, 0, 5);
+    if(devDrv == NULL) return;
+    drv = devDrv;
 
-	UNUSED(devDrv);
+    // todo load latest settings
+    // color, dim, 
+    ad_light_ctr_colorSave(0, 0, 5);
 
 	UNUSED(drv);
-	UNUSED(ctr);
 	UNUSED(ad_light_ctr_rgbScaling);
-	UNUSED(ad_light_ctr_dimSave);
-	UNUSED(ad_light_ctr_colorSave);
 
 }
+
+uint8_t ad_light_ctr_onOffGet(void)
+{
+    return ctr.onOff;
+}
+
+uint32_t ad_light_ctr_dimGet(void)
+{
+    return ctr.dim;
+}
+
+void ad_light_ctr_colorGet(uint8_t *r, uint8_t *g, uint8_t *b)
+{
+    if(r == NULL || g == NULL || b == NULL) return;
+
+    *r = ctr.RGB[AD_LIGHT_ID_R];
+    *g = ctr.RGB[AD_LIGHT_ID_G];
+    *b = ctr.RGB[AD_LIGHT_ID_B];
+}
@@ -0,0 +1,235 @@
+/**
+ * @file ad_light_group.c
+ * @author Jan Łukaszewicz (pldevluk@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @copyright The MIT License (MIT) Copyright (c) 2025
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the “Software”),
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "ad_light_group.h"
+#include "string.h"
+#include "ot_app_drv.h"
+#include <openthread/ip6.h>
+#include <openthread/random_noncrypto.h>
+#include <openthread/platform/alarm-milli.h>
+
+#define TAG "ad_light_group "
+
+typedef struct {
+    uint8_t inUse;
+    uint8_t ackPending;
+    uint8_t tokenLength;
+    uint8_t token[OT_COAP_MAX_TOKEN_LENGTH];
+    uint16_t lastMessageId;
+    uint16_t peerPort;
+    otIp6Address peerAddr;
+    uint32_t lastSeen;
+    uint32_t ackTime;
+}ad_light_group_sender_t;
+
+static otInstance *groupInstance;
+static otIp6Address groupAddr;
+static ad_light_group_sender_t senders[AD_LIGHT_GROUP_MAX_SENDERS];
+
+static uint8_t ad_light_group_isGroupRequest(const otMessageInfo *aMessageInfo)
+{
+    return (groupInstance != NULL && otIp6IsAddressEqual(&aMessageInfo->mSockAddr, &groupAddr));
+}
+
+// a controller is identified by its endpoint, message IDs are per endpoint (RFC 7252, 4.4)
+static ad_light_group_sender_t *ad_light_group_findSender(const otMessageInfo *aMessageInfo)
+{
+    for (uint8_t i = 0; i < AD_LIGHT_GROUP_MAX_SENDERS; i++)
+    {
+        if(senders[i].inUse && senders[i].peerPort == aMessageInfo->mPeerPort &&
+           otIp6IsAddressEqual(&senders[i].peerAddr, &aMessageInfo->mPeerAddr))
+        {
+            return &senders[i];
+        }
+    }
+    return NULL;
+}
+
+// forgets the controllers not heard from for the sender lifetime
+static void ad_light_group_expireSenders(uint32_t now)
+{
+    for (uint8_t i = 0; i < AD_LIGHT_GROUP_MAX_SENDERS; i++)
+    {
+        if(senders[i].inUse && !senders[i].ackPending &&
+           (uint32_t)(now - senders[i].lastSeen) >= AD_LIGHT_GROUP_SENDER_LIFETIME_MS)
+        {
+            senders[i].inUse = 0;
+        }
+    }
+}
+
+// returns a free entry or, when the table is full, the least recently seen one
+static ad_light_group_sender_t *ad_light_group_allocSender(uint32_t now)
+{
+    ad_light_group_sender_t *oldest = &senders[0];
+
+    for (uint8_t i = 0; i < AD_LIGHT_GROUP_MAX_SENDERS; i++)
+    {
+        if(!senders[i].inUse)
+        {
+            return &senders[i];
+        }
+
+        if((uint32_t)(now - senders[i].lastSeen) > (uint32_t)(now - oldest->lastSeen))
+        {
+            oldest = &senders[i];
+        }
+    }
+    return oldest;
+}
+
+#if AD_LIGHT_GROUP_ACK_ENABLE
+static void ad_light_group_sendAck(ad_light_group_sender_t *sender)
+{
+    otError error = OT_ERROR_NONE;
+    otMessage *message = NULL;
+    otMessageInfo messageInfo;
+
+    message = otCoapNewMessage(groupInstance, NULL);
+    if(message == NULL) return;
+
+    otCoapMessageInit(message, OT_COAP_TYPE_NON_CONFIRMABLE, OT_COAP_CODE_CHANGED);
+
+    error = otCoapMessageSetToken(message, sender->token, sender->tokenLength);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = sender->peerAddr;
+    messageInfo.mPeerPort = sender->peerPort;
+
+    error = otCoapSendResponse(groupInstance, message, &messageInfo);
+
+exit:
+    if(error != OT_ERROR_NONE)
+    {
+        OTAPP_PRINTF(TAG, "ack error: %d \n", error);
+        otMessageFree(message);
+    }
+}
+#endif
+
+uint8_t ad_light_group_acceptRequest(otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    ad_light_group_sender_t *sender = NULL;
+    uint16_t messageId = 0;
+    uint32_t now = 0;
+
+    // unicast or other multicast request - handled as before
+    if(!ad_light_group_isGroupRequest(aMessageInfo)) return 1;
+    if(otCoapMessageGetType(aMessage) != OT_COAP_TYPE_NON_CONFIRMABLE) return 0;
+
+    messageId = otCoapMessageGetMessageId(aMessage);
+    now = otPlatAlarmMilliGetNow();
+    ad_light_group_expireSenders(now);
+    sender = ad_light_group_findSender(aMessageInfo);
+
+    if(sender != NULL)
+    {
+        uint16_t behind = (uint16_t)(sender->lastMessageId - messageId);
+
+        if(behind < AD_LIGHT_GROUP_SEQ_WINDOW)
+        {
+            OTAPP_PRINTF(TAG, "duplicate group request, mid: %d \n", messageId);
+            return 0;
+        }
+    }
+    else
+    {
+        sender = ad_light_group_allocSender(now);
+        memset(sender, 0, sizeof(ad_light_group_sender_t));
+        sender->inUse = 1;
+        sender->peerAddr = aMessageInfo->mPeerAddr;
+        sender->peerPort = aMessageInfo->mPeerPort;
+    }
+
+    sender->lastMessageId = messageId;
+    sender->lastSeen = now;
+
+    return 1;
+}
+
+void ad_light_group_requestApplied(otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+#if AD_LIGHT_GROUP_ACK_ENABLE
+    ad_light_group_sender_t *sender = NULL;
+
+    if(!ad_light_group_isGroupRequest(aMessageInfo)) return;
+
+    sender = ad_light_group_findSender(aMessageInfo);
+    if(sender == NULL) return;
+
+    // the newest request is answered, older ones in the window are covered by it
+    sender->tokenLength = otCoapMessageGetTokenLength(aMessage);
+    memcpy(sender->token, otCoapMessageGetToken(aMessage), sender->tokenLength);
+
+    if(!sender->ackPending)
+    {
+        sender->ackPending = 1;
+        sender->ackTime = otPlatAlarmMilliGetNow() + otRandomNonCryptoGetUint32InRange(0, AD_LIGHT_GROUP_ACK_WINDOW_MS);
+    }
+#else
+    (void)aMessage;
+    (void)aMessageInfo;
+#endif
+}
+
+void ad_light_group_task(void)
+{
+#if AD_LIGHT_GROUP_ACK_ENABLE
+    uint32_t now;
+
+    if(groupInstance == NULL) return;
+
+    now = otPlatAlarmMilliGetNow();
+
+    for (uint8_t i = 0; i < AD_LIGHT_GROUP_MAX_SENDERS; i++)
+    {
+        if(senders[i].inUse && senders[i].ackPending && (int32_t)(now - senders[i].ackTime) >= 0)
+        {
+            senders[i].ackPending = 0;
+            ad_light_group_sendAck(&senders[i]);
+        }
+    }
+#endif
+}
+
+void ad_light_group_init(otInstance *instance)
+{
+    otError error = OT_ERROR_NONE;
+
+    if(instance == NULL) return;
+
+    memset(senders, 0, sizeof(senders));
+
+    error = otIp6AddressFromString(AD_LIGHT_GROUP_ADDRESS, &groupAddr);
+    if(error == OT_ERROR_NONE)
+    {
+        error = otIp6SubscribeMulticastAddress(instance, &groupAddr);
+    }
+
+    if(error != OT_ERROR_NONE && error != OT_ERROR_ALREADY)
+    {
+        OTAPP_PRINTF(TAG, "group subscribe error: %d \n", error);
+        return;
+    }
+
+    groupInstance = instance;
+}
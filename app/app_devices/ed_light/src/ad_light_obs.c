@@ -0,0 +1,338 @@
+/**
+ * @file ad_light_obs.c
+ * @author Jan Łukaszewicz (pldevluk@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 18-10-2026
+ *
+ * @copyright The MIT License (MIT) Copyright (c) 2025
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the “Software”),
+ * to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "ad_light_obs.h"
+#include "string.h"
+#include "ot_app_drv.h"
+#include <openthread/platform/alarm-milli.h>
+
+#define TAG "ad_light_obs "
+
+#define AD_LIGHT_OBS_REGISTER       (0)
+#define AD_LIGHT_OBS_DEREGISTER     (1)
+#define AD_LIGHT_OBS_SEQ_MASK       (0x00FFFFFF) // Observe option value is 24 bits long
+
+typedef struct {
+    uint8_t inUse;
+    uint8_t resource;
+    uint8_t generation;     // distinguishes slot reuse in confirmable notification callbacks
+    uint8_t tokenLength;
+    uint8_t token[OT_COAP_MAX_TOKEN_LENGTH];
+    otIp6Address peerAddr;
+    uint16_t peerPort;
+}ad_light_obs_observer_t;
+
+typedef struct {
+    uint8_t state[AD_LIGHT_OBS_STATE_MAX_SIZE];
+    uint8_t stateSize;
+    uint8_t pending;
+    uint32_t windowStart;
+    uint32_t sequence;
+}ad_light_obs_state_t;
+
+static otInstance *obsInstance;
+static ad_light_obs_observer_t observers[AD_LIGHT_OBS_MAX_OBSERVERS];
+static ad_light_obs_state_t states[AD_LIGHT_OBS_RESOURCE_COUNT];
+
+static ad_light_obs_observer_t *ad_light_obs_find(uint8_t resource, const otMessageInfo *aMessageInfo)
+{
+    for (uint8_t i = 0; i < AD_LIGHT_OBS_MAX_OBSERVERS; i++)
+    {
+        if(observers[i].inUse && observers[i].resource == resource &&
+           observers[i].peerPort == aMessageInfo->mPeerPort &&
+           memcmp(&observers[i].peerAddr, &aMessageInfo->mPeerAddr, sizeof(otIp6Address)) == 0)
+        {
+            return &observers[i];
+        }
+    }
+    return NULL;
+}
+
+static ad_light_obs_observer_t *ad_light_obs_findFree(void)
+{
+    for (uint8_t i = 0; i < AD_LIGHT_OBS_MAX_OBSERVERS; i++)
+    {
+        if(!observers[i].inUse)
+        {
+            return &observers[i];
+        }
+    }
+    return NULL;
+}
+
+static void ad_light_obs_remove(ad_light_obs_observer_t *observer)
+{
+    observer->inUse = 0;
+    observer->generation++;
+}
+
+static uint8_t ad_light_obs_tokenMatch(const ad_light_obs_observer_t *observer, otMessage *aMessage)
+{
+    return (observer->tokenLength == otCoapMessageGetTokenLength(aMessage) &&
+            memcmp(observer->token, otCoapMessageGetToken(aMessage), observer->tokenLength) == 0);
+}
+
+// 2.05 response to an Observe GET, with the Observe option only when the registration is kept
+static void ad_light_obs_sendResponse(otMessage *aMessage, const otMessageInfo *aMessageInfo,
+                                      const ad_light_obs_state_t *state, uint8_t registered)
+{
+    otError error = OT_ERROR_NONE;
+    otMessage *response = NULL;
+    otCoapType type;
+
+    type = (otCoapMessageGetType(aMessage) == OT_COAP_TYPE_CONFIRMABLE) ? OT_COAP_TYPE_ACKNOWLEDGMENT
+                                                                         : OT_COAP_TYPE_NON_CONFIRMABLE;
+
+    response = otCoapNewMessage(obsInstance, NULL);
+    if(response == NULL) return;
+
+    error = otCoapMessageInitResponse(response, aMessage, type, OT_COAP_CODE_CONTENT);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    if(registered)
+    {
+        error = otCoapMessageAppendObserveOption(response, state->sequence & AD_LIGHT_OBS_SEQ_MASK);
+        if(error != OT_ERROR_NONE) goto exit;
+    }
+
+    error = otCoapMessageSetPayloadMarker(response);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    error = otMessageAppend(response, state->state, state->stateSize);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    error = otCoapSendResponse(obsInstance, response, aMessageInfo);
+
+exit:
+    if(error != OT_ERROR_NONE)
+    {
+        OTAPP_PRINTF(TAG, "response error: %d \n", error);
+        otMessageFree(response);
+    }
+}
+
+static void *ad_light_obs_handleToContext(const ad_light_obs_observer_t *observer)
+{
+    uintptr_t index = (uintptr_t)(observer - observers);
+
+    return (void *)((index << 8) | observer->generation);
+}
+
+static void ad_light_obs_conResponseHandler(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo,
+                                            otError aResult)
+{
+    uintptr_t context = (uintptr_t)aContext;
+    ad_light_obs_observer_t *observer = &observers[context >> 8];
+
+    (void)aMessage;
+    (void)aMessageInfo;
+
+    // only a reset means the client is no longer interested in notifications.
+    // A timeout is not a deregistration: the stack reports the acknowledged
+    // notification as timed out when the CoAP Observe API is not built in.
+    // The generation changes on every new token, so only the registration
+    // the notification was sent for is removed
+    if(aResult == OT_ERROR_ABORT && observer->inUse && observer->generation == (uint8_t)(context & 0xFF))
+    {
+        OTAPP_PRINTF(TAG, "observer reset \n");
+        ad_light_obs_remove(observer);
+    }
+}
+
+static void ad_light_obs_notify(ad_light_obs_observer_t *observer, const ad_light_obs_state_t *state)
+{
+    otError error = OT_ERROR_NONE;
+    otMessage *message = NULL;
+    otMessageInfo messageInfo;
+    uint8_t confirmable = ((state->sequence % AD_LIGHT_OBS_CON_INTERVAL) == 0);
+
+    message = otCoapNewMessage(obsInstance, NULL);
+    if(message == NULL) return;
+
+    otCoapMessageInit(message, confirmable ? OT_COAP_TYPE_CONFIRMABLE : OT_COAP_TYPE_NON_CONFIRMABLE,
+                      OT_COAP_CODE_CONTENT);
+
+    error = otCoapMessageSetToken(message, observer->token, observer->tokenLength);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    error = otCoapMessageAppendObserveOption(message, state->sequence & AD_LIGHT_OBS_SEQ_MASK);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    error = otCoapMessageSetPayloadMarker(message);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    error = otMessageAppend(message, state->state, state->stateSize);
+    if(error != OT_ERROR_NONE) goto exit;
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = observer->peerAddr;
+    messageInfo.mPeerPort = observer->peerPort;
+
+    if(confirmable)
+    {
+        error = otCoapSendRequest(obsInstance, message, &messageInfo, ad_light_obs_conResponseHandler,
+                                  ad_light_obs_handleToContext(observer));
+    }
+    else
+    {
+        error = otCoapSendResponse(obsInstance, message, &messageInfo);
+    }
+
+exit:
+    if(error != OT_ERROR_NONE)
+    {
+        // a notification that cannot be sent ends the registration, the
+        // client registers again when it stops receiving notifications
+        OTAPP_PRINTF(TAG, "notify error: %d, observer removed \n", error);
+        otMessageFree(message);
+        ad_light_obs_remove(observer);
+    }
+}
+
+uint8_t ad_light_obs_processRequest(ad_light_obs_resource_t resource, otMessage *aMessage,
+                                    const otMessageInfo *aMessageInfo)
+{
+    otCoapOptionIterator iterator;
+    uint64_t observe = 0;
+    uint8_t registered = 0;
+    ad_light_obs_observer_t *observer = NULL;
+
+    if(obsInstance == NULL || resource >= AD_LIGHT_OBS_RESOURCE_COUNT) return 0;
+    if(otCoapMessageGetCode(aMessage) != OT_COAP_CODE_GET) return 0;
+
+    if(otCoapOptionIteratorInit(&iterator, aMessage) != OT_ERROR_NONE) return 0;
+    if(otCoapOptionIteratorGetFirstOptionMatching(&iterator, OT_COAP_OPTION_OBSERVE) == NULL) return 0;
+    if(otCoapOptionIteratorGetOptionUintValue(&iterator, &observe) != OT_ERROR_NONE) return 0;
+    if(observe != AD_LIGHT_OBS_REGISTER && observe != AD_LIGHT_OBS_DEREGISTER) return 0;
+
+    observer = ad_light_obs_find(resource, aMessageInfo);
+
+    if(observe == AD_LIGHT_OBS_DEREGISTER)
+    {
+        // only the registration made with this token is cancelled
+        if(observer != NULL && ad_light_obs_tokenMatch(observer, aMessage))
+        {
+            ad_light_obs_remove(observer);
+        }
+    }
+    else if(observer != NULL)
+    {
+        // re-registration, a new token invalidates notifications still in flight
+        if(!ad_light_obs_tokenMatch(observer, aMessage))
+        {
+            observer->generation++;
+            observer->tokenLength = otCoapMessageGetTokenLength(aMessage);
+            memcpy(observer->token, otCoapMessageGetToken(aMessage), observer->tokenLength);
+        }
+        registered = 1;
+    }
+    else
+    {
+        observer = ad_light_obs_findFree();
+        if(observer != NULL)
+        {
+            observer->inUse = 1;
+            observer->resource = resource;
+            observer->peerAddr = aMessageInfo->mPeerAddr;
+            observer->peerPort = aMessageInfo->mPeerPort;
+            observer->tokenLength = otCoapMessageGetTokenLength(aMessage);
+            memcpy(observer->token, otCoapMessageGetToken(aMessage), observer->tokenLength);
+            registered = 1;
+        }
+        else
+        {
+            OTAPP_PRINTF(TAG, "observer table full \n");
+        }
+    }
+
+    // the current representation is served in every case, with the Observe
+    // option only when the client is registered (RFC 7641, 4.1)
+    ad_light_obs_sendResponse(aMessage, aMessageInfo, &states[resource], registered);
+
+    return 1;
+}
+
+void ad_light_obs_stateChanged(ad_light_obs_resource_t resource, const uint8_t *state, uint8_t stateSize)
+{
+    ad_light_obs_state_t *obsState;
+
+    if(resource >= AD_LIGHT_OBS_RESOURCE_COUNT || state == NULL) return;
+    if(stateSize > AD_LIGHT_OBS_STATE_MAX_SIZE) return;
+
+    obsState = &states[resource];
+
+    memcpy(obsState->state, state, stateSize);
+    obsState->stateSize = stateSize;
+
+    if(!obsState->pending)
+    {
+        obsState->pending = 1;
+        obsState->windowStart = otPlatAlarmMilliGetNow();
+    }
+}
+
+void ad_light_obs_task(void)
+{
+    uint32_t now;
+
+    if(obsInstance == NULL) return;
+
+    now = otPlatAlarmMilliGetNow();
+
+    for (uint8_t res = 0; res < AD_LIGHT_OBS_RESOURCE_COUNT; res++)
+    {
+        ad_light_obs_state_t *obsState = &states[res];
+
+        if(!obsState->pending || (uint32_t)(now - obsState->windowStart) < AD_LIGHT_OBS_COALESCE_MS)
+        {
+            continue;
+        }
+
+        obsState->pending = 0;
+        obsState->sequence++;
+
+        for (uint8_t i = 0; i < AD_LIGHT_OBS_MAX_OBSERVERS; i++)
+        {
+            if(observers[i].inUse && observers[i].resource == res)
+            {
+                ad_light_obs_notify(&observers[i], obsState);
+            }
+        }
+    }
+}
+
+void ad_light_obs_stateSet(ad_light_obs_resource_t resource, const uint8_t *state, uint8_t stateSize)
+{
+    if(resource >= AD_LIGHT_OBS_RESOURCE_COUNT || state == NULL) return;
+    if(stateSize > AD_LIGHT_OBS_STATE_MAX_SIZE) return;
+
+    memcpy(states[resource].state, state, stateSize);
+    states[resource].stateSize = stateSize;
+}
+
+void ad_light_obs_init(otInstance *instance)
+{
+    if(instance == NULL) return;
+    obsInstance = instance;
+
+    memset(observers, 0, sizeof(observers));
+    memset(states, 0, sizeof(states));
+}
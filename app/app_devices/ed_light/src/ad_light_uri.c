@@ -21,6 +21,9 @@
  */
 #include "ad_light_uri.h"
 #include "ad_light_control.h"
+#include "ad_light_obs.h"
+#include "ad_light_group.h"
+#include "app_thread.h"
 
 #define TAG "ad_light_uri "
 
@@ -35,6 +38,10 @@ void ad_light_uri_light_on_off_CoreHandle(void *aContext, otMessage *aMessage, c
 {
     int8_t result = 0;  
 
+    if(!ad_light_group_acceptRequest(aMessage, aMessageInfo)) return;
+
+    if(ad_light_obs_processRequest(AD_LIGHT_OBS_ON_OFF, aMessage, aMessageInfo)) return;
+
     result = drv->api.coap.processUriRequest(aMessage, aMessageInfo, OTAPP_LIGHTING_ON_OFF, coapBuffer, OAC_URI_OBS_BUFFER_SIZE);
 
     // if(result == OTAPP_COAP_OK_OBSERVER_REQUEST)
@@ -47,6 +54,8 @@ void ad_light_uri_light_on_off_CoreHandle(void *aContext, otMessage *aMessage, c
     {
         // handle uri request here       
         ad_light_ctr_onOff(coapBuffer[0]);
+        ad_light_group_requestApplied(aMessage, aMessageInfo);
+        ad_light_obs_stateChanged(AD_LIGHT_OBS_ON_OFF, coapBuffer, 1);
 
         OTAPP_PRINTF(TAG, "@ DEVICE URI light_on_off payload: \n");
         OTAPP_PRINTF(TAG, "  on_off value %d \n", coapBuffer[0]);
@@ -61,6 +70,10 @@ void ad_light_uri_light_dimm_CoreHandle(void *aContext, otMessage *aMessage, con
     int8_t result = 0;
     uint32_t dimm_ = 0;
 
+    if(!ad_light_group_acceptRequest(aMessage, aMessageInfo)) return;
+
+    if(ad_light_obs_processRequest(AD_LIGHT_OBS_DIMM, aMessage, aMessageInfo)) return;
+
     result = drv->api.coap.processUriRequest(aMessage, aMessageInfo, OTAPP_LIGHTING_DIMM, coapBuffer, OAC_URI_OBS_BUFFER_SIZE);
 
     if(result > 0 || result == OAC_URI_OBS_ADDED_NEW_DEVICE || result == OAC_URI_OBS_NO_NEED_UPDATE)
@@ -78,6 +91,8 @@ void ad_light_uri_light_dimm_CoreHandle(void *aContext, otMessage *aMessage, con
         dimm_   |= ((uint32_t)coapBuffer[3] << 24);
 
         ad_light_ctr_dimSet(dimm_);
+        ad_light_group_requestApplied(aMessage, aMessageInfo);
+        ad_light_obs_stateChanged(AD_LIGHT_OBS_DIMM, coapBuffer, sizeof(dimm_));
 
         OTAPP_PRINTF(TAG, "@ DEVICE URI light_dimm payload: \n");
         OTAPP_PRINTF(TAG, "   dimValue: %ld \n", dimm_);
@@ -94,6 +109,10 @@ void ad_light_uri_light_rgb_CoreHandle(void *aContext, otMessage *aMessage, cons
     uint8_t color_G_ = 0;
     uint8_t color_B_ = 0;
 
+    if(!ad_light_group_acceptRequest(aMessage, aMessageInfo)) return;
+
+    if(ad_light_obs_processRequest(AD_LIGHT_OBS_RGB, aMessage, aMessageInfo)) return;
+
     result = drv->api.coap.processUriRequest(aMessage, aMessageInfo, OTAPP_LIGHTING_RGB, coapBuffer, OAC_URI_OBS_BUFFER_SIZE);
 
     if(result > 0 || result == OAC_URI_OBS_ADDED_NEW_DEVICE || result == OAC_URI_OBS_NO_NEED_UPDATE)
@@ -109,6 +128,8 @@ void ad_light_uri_light_rgb_CoreHandle(void *aContext, otMessage *aMessage, cons
         color_B_ = coapBuffer[0];
 
         ad_light_ctr_colorSet(color_R_, color_G_, color_B_);
+        ad_light_group_requestApplied(aMessage, aMessageInfo);
+        ad_light_obs_stateChanged(AD_LIGHT_OBS_RGB, coapBuffer, 3);
 
         OTAPP_PRINTF(TAG, "@ DEVICE URI light_rgb payload: \n");
         OTAPP_PRINTF(TAG, "   R: %d, G: %d, B %d \n", color_R_, color_G_, color_B_);
@@ -173,11 +194,38 @@ void ad_light_uri_printResult(int8_t result)
     }
 }
 
+// serve the current light state to the first observers, in the URI payload format
+static void ad_light_uri_obsStateInit(void)
+{
+    uint8_t state[AD_LIGHT_OBS_STATE_MAX_SIZE];
+    uint32_t dimm_ = ad_light_ctr_dimGet();
+
+    state[0] = ad_light_ctr_onOffGet();
+    ad_light_obs_stateSet(AD_LIGHT_OBS_ON_OFF, state, 1);
+
+    state[0] = (uint8_t)(dimm_);
+    state[1] = (uint8_t)(dimm_ >> 8);
+    state[2] = (uint8_t)(dimm_ >> 16);
+    state[3] = (uint8_t)(dimm_ >> 24);
+    ad_light_obs_stateSet(AD_LIGHT_OBS_DIMM, state, sizeof(dimm_));
+
+    ad_light_ctr_colorGet(&state[2], &state[1], &state[0]);
+    ad_light_obs_stateSet(AD_LIGHT_OBS_RGB, state, 3);
+}
+
 void ad_light_uri_init(ot_app_devDrv_t *devDrv)
 {
+    otInstance *instance = NULL;
+
     if(devDrv == NULL) return;
     drv = devDrv;
 
     ad_light_ctr_init(drv);
 
+    // the instance created in Thread_Init(), which runs before the device init
+    instance = APP_THREAD_GetInstance();
+    ad_light_obs_init(instance);
+    ad_light_uri_obsStateInit();
+    ad_light_group_init(instance);
+
 }
\ No newline at end of file